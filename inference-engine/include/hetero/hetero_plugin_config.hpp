@@ -28,6 +28,12 @@ namespace HeteroConfigParams {
 #define DECLARE_HETERO_CONFIG_KEY(name) DECLARE_CONFIG_KEY(HETERO_##name)
 #define DECLARE_HETERO_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(HETERO_##name)
 
+/**
+ * @def HETERO_CONFIG_VALUE(name)
+ * @brief Shortcut for defining HETERO configuration values
+ */
+#define HETERO_CONFIG_VALUE(name) InferenceEngine::HeteroConfigParams::HETERO_##name
+
 /**
  * @brief The key for enabling of dumping the topology with details of layers and details how
  * this network would be executed on different devices to the disk in GraphViz format.
@@ -35,5 +41,48 @@ namespace HeteroConfigParams {
  */
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
+/**
+ * @brief The key to enable the pipelined execution of the subgraphs.
+ * The value is the number of the inference requests allowed to run every subgraph at once, the requests over the limit
+ * wait in the subgraph queue. So the subgraphs of the different requests run on their devices simultaneously and the
+ * throughput is limited by the slowest subgraph rather than by the sum of the subgraphs times.
+ * The EXCLUSIVE_ASYNC_REQUESTS is not applied to the devices in this mode.
+ * This option should be used with values: "0" (default, pipelining is disabled) or a positive integer
+ */
+DECLARE_HETERO_CONFIG_KEY(PIPELINE_DEPTH);
+
+/**
+ * @brief The key to select how the layers are assigned to the devices, when no affinities are set by the user.
+ * HETERO_PRIORITY (default) - every layer goes to the first device in the TARGET_FALLBACK list that supports it
+ * HETERO_COST_MODEL - the assignment minimizes the estimated latency: the cost of the layers on the devices
+ * (see the OPERATION_COSTS device metric), the cost of the data transfers between the subgraphs and the overhead
+ * of every subgraph. Small fragments are merged into the neighbouring subgraphs when this is cheaper.
+ */
+DECLARE_HETERO_CONFIG_KEY(PARTITIONING_POLICY);
+DECLARE_HETERO_CONFIG_VALUE(PRIORITY);
+DECLARE_HETERO_CONFIG_VALUE(COST_MODEL);
+
+/**
+ * @brief The key to limit the number of the connected single-device fragments produced by the HETERO_COST_MODEL
+ * partitioning. The network loading fails if the layers supported by the devices do not allow to meet the limit.
+ * This option should be used with values: "0" (default, no limit) or a positive integer
+ */
+DECLARE_HETERO_CONFIG_KEY(MAX_SUBGRAPHS);
+
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Executable network metric to get the layers to devices assignment chosen by the HETERO_COST_MODEL partitioning
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION, std::map<std::string, std::string>);
+
+/**
+ * @brief Executable network metric to get the latency estimated by the HETERO_COST_MODEL partitioning for the chosen
+ * assignment, in the OPERATION_COSTS units
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION_COST, float);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -10,6 +10,7 @@
  */
 #pragma once
 
+#include <map>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -153,6 +154,16 @@ DECLARE_EXEC_NETWORK_METRIC_KEY(NETWORK_NAME, std::string);
  */
 DECLARE_METRIC_KEY(DEVICE_THERMAL, float);
 
+/**
+ * @brief Metric to get a std::map<std::string, float> of the relative costs of the operations on the device.
+ *
+ * The key is an operation type name (e.g. "Convolution"), the value is the estimated cost of computing one element
+ * of the operation output, relative to a simple element-wise operation. The value for the "default" key, if any, is
+ * used for the types that are not listed. The metric is used by the HETERO plugin cost model partitioning.
+ * String value is "OPERATION_COSTS".
+ */
+DECLARE_METRIC_KEY(OPERATION_COSTS, std::map<std::string, float>);
+
 /**
  * @brief Metric to get an unsigned integer value of optimal number of executable network infer requests.
  */
@@ -375,5 +386,28 @@ DECLARE_CONFIG_KEY(ENFORCE_BF16);
 */
 DECLARE_CONFIG_KEY(CACHE_DIR);
 
+/**
+* @brief This key enables the in-process cache of the networks read by the Core::ReadNetwork
+*
+* It is a Core setting, so it can be set only without the device name:
+* ie.SetConfig({{CONFIG_KEY(READ_NETWORK_CACHE), CONFIG_VALUE(YES)}})
+* The networks read from files are identified by the paths, sizes and modification times of the model and the
+* weights, the networks read from memory by the content of the model and the weights. A repeated read returns a copy
+* of the cached network which shares the Constant data with it instead of parsing the model again.
+* Only the few most recently read networks are kept, the older ones are released.
+* The NO value (default) disables the cache and releases the cached networks.
+*/
+DECLARE_CONFIG_KEY(READ_NETWORK_CACHE);
+
+/**
+* @brief This key allows the Core::ReadNetwork to parse the layers of IR v10 models concurrently
+*
+* It is a Core setting, so it can be set only without the device name:
+* ie.SetConfig({{CONFIG_KEY(READ_NETWORK_PARALLEL), CONFIG_VALUE(YES)}})
+* The generic layer parameters and the attributes of all the layers are decoded by the threads of the TBB/OMP pool,
+* the Constants and the Parameters are created in the same pass. The NO value (default) parses the layers one by one.
+*/
+DECLARE_CONFIG_KEY(READ_NETWORK_PARALLEL);
+
 }  // namespace PluginConfigParams
 }  // namespace InferenceEngine
@@ -11,6 +11,9 @@
 
 #pragma once
 
+#include <map>
+#include <string>
+
 #include "ie_plugin_config.hpp"
 
 namespace InferenceEngine {
@@ -26,6 +29,12 @@ namespace MultiDeviceConfigParams {
  */
 #define MULTI_CONFIG_KEY(name) InferenceEngine::MultiDeviceConfigParams::_CONFIG_KEY(MULTI_##name)
 
+/**
+ * @def MULTI_CONFIG_VALUE(name)
+ * @brief A macro which provides a MULTI-mangled name for configuration value with name `name`
+ */
+#define MULTI_CONFIG_VALUE(name) InferenceEngine::MultiDeviceConfigParams::MULTI_##name
+
 #define DECLARE_MULTI_CONFIG_KEY(name) DECLARE_CONFIG_KEY(MULTI_##name)
 #define DECLARE_MULTI_CONFIG_VALUE(name) DECLARE_CONFIG_VALUE(MULTI_##name)
 
@@ -34,5 +43,31 @@ namespace MultiDeviceConfigParams {
  */
 DECLARE_MULTI_CONFIG_KEY(DEVICE_PRIORITIES);
 
+/**
+ * @brief The policy used to dispatch the inference requests to the devices.
+ * MULTI_PRIORITY (default) - a request goes to the first device (in the DEVICE_PRIORITIES order) with an idle request
+ * MULTI_LATENCY_AWARE - a request goes to the device with the smallest expected completion time, which is estimated
+ * from the device latency observed so far and from the number of requests already waiting for the device
+ */
+DECLARE_MULTI_CONFIG_KEY(SCHEDULING_POLICY);
+DECLARE_MULTI_CONFIG_VALUE(PRIORITY);
+DECLARE_MULTI_CONFIG_VALUE(LATENCY_AWARE);
+
 }  // namespace MultiDeviceConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric to get the live per-device statistics of the Multi-Device executable network.
+ * The outer map is keyed by the device name, the inner one contains the following values:
+ * LATENCY_MS - exponentially weighted moving average of the inference latency on the device, in milliseconds
+ * THROUGHPUT_FPS - exponentially weighted moving average of the device throughput, in frames per second
+ * IN_FLIGHT - number of the inference requests currently running on the device
+ * QUEUED - number of the inference requests waiting for the device
+ * REQUESTS - number of the device infer requests owned by the Multi-Device
+ * COMPLETED - total number of the inference requests completed by the device
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(MULTI_DEVICE_STATISTICS, std::map<std::string, std::map<std::string, float>>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
@@ -105,6 +105,29 @@ static const char shape_message[] = "Optional. Set shape for input. For example,
 static const char layout_message[] = "Optional. Prompts how network layouts should be treated by application. "
                                      "For example, \"input1[NCHW],input2[NC]\" or \"[NCHW]\" in case of one input size.";
 
+// @brief message for multi-model option
+static const char multi_model_message[] = "Optional. Run several models concurrently instead of -m, each one with its own device, streams, "
+                                          "infer requests and load. Format: \"<path1>[device=CPU;nstreams=2;nireq=4;qps=100],<path2>[device=GPU]\", "
+                                          "all options are optional. A model without qps is run in the closed-loop mode. "
+                                          "Per-model and aggregate throughput and latency are reported.";
+
+// @brief message for open-loop rate option
+static const char qps_message[] = "Optional. Target rate of queries per second. Enables open-loop load generation: queries are submitted "
+                                  "at the given rate independently of the completion of previous ones, a query that finds no idle "
+                                  "infer request is queued. Only for the async API.";
+
+// @brief message for arrival process option
+static const char arrival_message[] = "Optional. Arrival process of the open-loop load generator: \"poisson\" (default) for exponentially "
+                                      "distributed or \"fixed\" for constant inter-arrival times.";
+
+// @brief message for latency SLO option
+static const char latency_slo_message[] = "Optional. Latency SLO in milliseconds. After the measurement the application runs an open-loop "
+                                          "QPS sweep and reports the maximum throughput at which the -slo_percentile latency "
+                                          "(queueing plus compute) stays within the SLO. Each sweep step lasts -t seconds.";
+
+// @brief message for latency SLO percentile option
+static const char slo_percentile_message[] = "Optional. Latency percentile checked against -latency_slo. Default value is 99.";
+
 // @brief message for quantization bits
 static const char gna_qb_message[] = "Optional. Weight bits for quantization:  8 or 16 (default)";
 
@@ -195,6 +218,21 @@ DEFINE_string(shape, "", shape_message);
 /// @brief Define flag for layout shape <br>
 DEFINE_string(layout, "", layout_message);
 
+/// @brief Define models for the multi-model mode
+DEFINE_string(multi_model, "", multi_model_message);
+
+/// @brief Define target rate of the open-loop load generator
+DEFINE_double(qps, 0.0, qps_message);
+
+/// @brief Define arrival process of the open-loop load generator
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Define latency SLO for the QPS sweep
+DEFINE_double(latency_slo, 0.0, latency_slo_message);
+
+/// @brief Define latency percentile checked against the SLO
+DEFINE_double(slo_percentile, 99.0, slo_percentile_message);
+
 /// @brief Define flag for quantization bits (default 16)
 DEFINE_int32(qb, 16, gna_qb_message);
 
@@ -222,6 +260,12 @@ static void showUsage() {
     std::cout << "    -progress                 " << progress_message << std::endl;
     std::cout << "    -shape                    " << shape_message << std::endl;
     std::cout << "    -layout                   " << layout_message << std::endl;
+    std::cout << std::endl << "  Load generation options:" << std::endl;
+    std::cout << "    -multi_model \"<models>\"   " << multi_model_message << std::endl;
+    std::cout << "    -qps \"<double>\"           " << qps_message << std::endl;
+    std::cout << "    -arrival \"<mode>\"         " << arrival_message << std::endl;
+    std::cout << "    -latency_slo \"<double>\"   " << latency_slo_message << std::endl;
+    std::cout << "    -slo_percentile \"<double>\" " << slo_percentile_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -21,7 +21,7 @@
 typedef std::chrono::high_resolution_clock Time;
 typedef std::chrono::nanoseconds ns;
 
-typedef std::function<void(size_t id, const double latency)> QueueCallbackFunction;
+typedef std::function<void(size_t id, const double latency, const double queueingTime)> QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution time.
 class InferReqWrap final {
@@ -37,12 +37,20 @@ public:
         _request.SetCompletionCallback(
                 [&]() {
                     _endTime = Time::now();
-                    _callbackQueue(_id, getExecutionTimeInMilliseconds());
+                    _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingTimeInMilliseconds());
                 });
     }
 
     void startAsync() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
+        _request.StartAsync();
+    }
+
+    /// @brief Starts the request on behalf of a query that arrived at arrivalTime, the gap is accounted as queueing delay
+    void startAsync(const Time::time_point& arrivalTime) {
+        _startTime = Time::now();
+        _arrivalTime = std::min(arrivalTime, _startTime);
         _request.StartAsync();
     }
 
@@ -52,9 +60,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.Infer();
         _endTime = Time::now();
-        _callbackQueue(_id, getExecutionTimeInMilliseconds());
+        _callbackQueue(_id, getExecutionTimeInMilliseconds(), getQueueingTimeInMilliseconds());
     }
 
     std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> getPerformanceCounts() {
@@ -70,8 +79,14 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double getQueueingTimeInMilliseconds() const {
+        auto queueingTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueingTime.count()) * 0.000001;
+    }
+
 private:
     InferenceEngine::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -84,7 +99,8 @@ public:
         for (size_t id = 0; id < nireq; id++) {
             requests.push_back(std::make_shared<InferReqWrap>(net, id, std::bind(&InferRequestsQueue::putIdleRequest, this,
                                                                                  std::placeholders::_1,
-                                                                                 std::placeholders::_2)));
+                                                                                 std::placeholders::_2,
+                                                                                 std::placeholders::_3)));
             _idleIds.push(id);
         }
         resetTimes();
@@ -102,6 +118,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queueingTimes.clear();
     }
 
     double getDurationInMilliseconds() {
@@ -109,9 +126,11 @@ public:
     }
 
     void putIdleRequest(size_t id,
-                        const double latency) {
+                        const double latency,
+                        const double queueingTime) {
         std::unique_lock<std::mutex> lock(_mutex);
         _latencies.push_back(latency);
+        _queueingTimes.push_back(queueingTime);
         _idleIds.push(id);
         _endTime = std::max(Time::now(), _endTime);
         _cv.notify_one();
@@ -131,10 +150,26 @@ public:
         _cv.wait(lock, [this]{ return _idleIds.size() == requests.size(); });
     }
 
+    /// @brief Returns compute latencies, i.e. time from the request start to its completion
     std::vector<double> getLatencies() {
+        std::unique_lock<std::mutex> lock(_mutex);
         return _latencies;
     }
 
+    /// @brief Returns time each query waited for an idle request before being started
+    std::vector<double> getQueueingTimes() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        return _queueingTimes;
+    }
+
+    /// @brief Returns end-to-end latencies: queueing delay plus compute latency
+    std::vector<double> getTotalLatencies() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        std::vector<double> total(_latencies.size());
+        std::transform(_latencies.begin(), _latencies.end(), _queueingTimes.begin(), total.begin(), std::plus<double>());
+        return total;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -144,4 +179,5 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queueingTimes;
 };
@@ -0,0 +1,149 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "load_generator.hpp"
+
+ArrivalMode parseArrivalMode(const std::string& mode) {
+    if (mode == "poisson")
+        return ArrivalMode::POISSON;
+    if (mode == "fixed")
+        return ArrivalMode::FIXED;
+    throw std::logic_error("Incorrect arrival mode '" + mode + "'. Please set -arrival option to `poisson` or `fixed` value.");
+}
+
+ArrivalScheduler::ArrivalScheduler(double qps, ArrivalMode mode, uint32_t seed)
+    : _mode(mode),
+      _meanInterval(1.0 / qps),
+      _generator(seed),
+      _distribution(qps > 0.0 ? qps : 1.0) {
+    if (qps <= 0.0)
+        throw std::logic_error("Target QPS should be positive");
+    reset(Time::now());
+}
+
+void ArrivalScheduler::reset(const Time::time_point& startTime) {
+    _nextArrival = startTime;
+}
+
+Time::time_point ArrivalScheduler::next() {
+    auto arrival = _nextArrival;
+    std::chrono::duration<double> interval = _mode == ArrivalMode::POISSON ?
+        std::chrono::duration<double>(_distribution(_generator)) : _meanInterval;
+    _nextArrival += std::chrono::duration_cast<Time::duration>(interval);
+    return arrival;
+}
+
+namespace {
+
+LoadResult collectResult(InferRequestsQueue& queue, size_t iterations, double targetQps) {
+    LoadResult result;
+    result.targetQps = targetQps;
+    result.iterations = iterations;
+    result.durationMs = queue.getDurationInMilliseconds();
+    result.achievedQps = result.durationMs > 0.0 ? 1000.0 * iterations / result.durationMs : 0.0;
+    result.total = LatencyMetrics(queue.getTotalLatencies());
+    result.queueing = LatencyMetrics(queue.getQueueingTimes());
+    result.compute = LatencyMetrics(queue.getLatencies());
+    return result;
+}
+
+}  // namespace
+
+LoadResult runClosedLoop(InferRequestsQueue& queue, uint32_t niter, uint64_t durationNs) {
+    if (niter == 0 && durationNs == 0)
+        throw std::logic_error("Closed-loop run requires either iterations or duration limit");
+
+    queue.resetTimes();
+    auto startTime = Time::now();
+
+    size_t iteration = 0;
+    const size_t nireq = queue.requests.size();
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    while ((niter != 0 && iteration < niter) ||
+           (durationNs != 0 && static_cast<uint64_t>(execTime) < durationNs) ||
+           (iteration % nireq != 0)) {
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            THROW_IE_EXCEPTION << "No idle Infer Requests!";
+        }
+        inferRequest->wait();
+        inferRequest->startAsync();
+        iteration++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    }
+    queue.waitAll();
+
+    return collectResult(queue, iteration, 0.0);
+}
+
+LoadResult runOpenLoop(InferRequestsQueue& queue, double qps, ArrivalMode mode,
+                           uint32_t niter, uint64_t durationNs) {
+    if (niter == 0 && durationNs == 0)
+        throw std::logic_error("Open-loop run requires either iterations or duration limit");
+
+    queue.resetTimes();
+    ArrivalScheduler scheduler(qps, mode);
+    auto startTime = Time::now();
+    scheduler.reset(startTime);
+
+    size_t iteration = 0;
+    auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    while ((niter != 0 && iteration < niter) ||
+           (durationNs != 0 && static_cast<uint64_t>(execTime) < durationNs)) {
+        auto arrival = scheduler.next();
+        std::this_thread::sleep_until(arrival);
+
+        auto inferRequest = queue.getIdleRequest();
+        if (!inferRequest) {
+            THROW_IE_EXCEPTION << "No idle Infer Requests!";
+        }
+        // Rethrows possible exception of the previous run of the request
+        inferRequest->wait();
+        inferRequest->startAsync(arrival);
+        iteration++;
+
+        execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
+    }
+    queue.waitAll();
+
+    return collectResult(queue, iteration, qps);
+}
+
+LoadResult findMaxQpsUnderSlo(InferRequestsQueue& queue, double maxQps, double sloMs, double percentile,
+                                  ArrivalMode mode, uint64_t durationNs, size_t steps) {
+    auto probe = [&] (double qps, LoadResult& result) {
+        result = runOpenLoop(queue, qps, mode, 0, durationNs);
+        auto latencies = queue.getTotalLatencies();
+        std::sort(latencies.begin(), latencies.end());
+        double value = LatencyMetrics::percentile(latencies, percentile);
+        bool passed = value <= sloMs;
+        slog::info << "QPS sweep: target " << qps << " QPS, achieved " << result.achievedQps
+                   << " QPS, p" << percentile << " latency " << value << " ms -> "
+                   << (passed ? "within" : "violates") << " SLO" << slog::endl;
+        return passed;
+    };
+
+    LoadResult best;
+    LoadResult current;
+    if (probe(maxQps, current))
+        return current;
+
+    double low = 0.0, high = maxQps;
+    for (size_t step = 0; step < steps; step++) {
+        double mid = (low + high) / 2.0;
+        if (probe(mid, current)) {
+            low = mid;
+            best = current;
+        } else {
+            high = mid;
+        }
+    }
+    return best;
+}
@@ -0,0 +1,74 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "infer_request_wrap.hpp"
+#include "statistics_report.hpp"
+
+/// @brief Arrival process of the open-loop load generator
+enum class ArrivalMode {
+    FIXED,    //!< constant inter-arrival time of 1/qps
+    POISSON   //!< exponentially distributed inter-arrival times with the mean of 1/qps
+};
+
+ArrivalMode parseArrivalMode(const std::string& mode);
+
+/// @brief Generates arrival time points of queries for a given rate
+class ArrivalScheduler {
+public:
+    ArrivalScheduler(double qps, ArrivalMode mode, uint32_t seed = 0);
+
+    void reset(const Time::time_point& startTime);
+
+    /// @brief Returns the arrival time of the next query
+    Time::time_point next();
+
+private:
+    ArrivalMode _mode;
+    std::chrono::duration<double> _meanInterval;
+    std::mt19937 _generator;
+    std::exponential_distribution<double> _distribution;
+    Time::time_point _nextArrival;
+};
+
+/// @brief Results of a load generator run
+struct LoadResult {
+    double targetQps = 0.0;
+    double achievedQps = 0.0;
+    size_t iterations = 0;
+    double durationMs = 0.0;
+    LatencyMetrics total;      //!< queueing delay plus compute time
+    LatencyMetrics queueing;   //!< time a query waited for an idle infer request
+    LatencyMetrics compute;    //!< time from the request start to its completion
+};
+
+/**
+ * @brief Keeps all infer requests of the queue busy: every request is restarted as soon as it completes.
+ * @param niter Number of iterations, 0 means not limited
+ * @param durationNs Duration of the run in nanoseconds, 0 means not limited
+ */
+LoadResult runClosedLoop(InferRequestsQueue& queue, uint32_t niter, uint64_t durationNs);
+
+/**
+ * @brief Submits queries at the target rate regardless of completions of previous ones.
+ * A query that finds no idle infer request waits for one, and the waiting time is reported as queueing delay.
+ * @param niter Number of queries to submit, 0 means not limited
+ * @param durationNs Duration of the run in nanoseconds, 0 means not limited
+ */
+LoadResult runOpenLoop(InferRequestsQueue& queue, double qps, ArrivalMode mode,
+                           uint32_t niter, uint64_t durationNs);
+
+/**
+ * @brief Searches for the maximum rate at which the given latency percentile stays within the SLO.
+ * Bisection is done between 0 and maxQps, each probe is an open-loop run of durationNs.
+ * @return The best rate found and the results of the probe at that rate
+ */
+LoadResult findMaxQpsUnderSlo(InferRequestsQueue& queue, double maxQps, double sloMs, double percentile,
+                                  ArrivalMode mode, uint64_t durationNs, size_t steps = 8);
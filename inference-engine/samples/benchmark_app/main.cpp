@@ -23,6 +23,8 @@
 #include "progress_bar.hpp"
 #include "statistics_report.hpp"
 #include "inputs_filling.hpp"
+#include "load_generator.hpp"
+#include "multi_model.hpp"
 #include "utils.hpp"
 
 using namespace InferenceEngine;
@@ -47,11 +49,20 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_multi_model.empty()) {
         showUsage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
 
+    if (!FLAGS_m.empty() && !FLAGS_multi_model.empty()) {
+        throw std::logic_error("-m and -multi_model options are mutually exclusive.");
+    }
+
+    if (!FLAGS_multi_model.empty() && (FLAGS_api != "async" || FLAGS_niter != 0 || FLAGS_latency_slo > 0 || FLAGS_qps > 0)) {
+        throw std::logic_error("The multi-model mode supports only the async API limited by time, "
+                               "use per-model options instead of -qps.");
+    }
+
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
@@ -67,6 +78,20 @@ bool ParseAndCheckCommandLine(int argc, char *argv[]) {
         throw std::logic_error("only " + std::string(detailedCntReport) + " report type is supported for MULTI device");
     }
 
+    if (FLAGS_qps < 0 || FLAGS_latency_slo < 0) {
+        throw std::logic_error("-qps and -latency_slo values should be positive.");
+    }
+
+    if ((FLAGS_qps > 0 || FLAGS_latency_slo > 0) && FLAGS_api != "async") {
+        throw std::logic_error("Open-loop load generation (-qps and -latency_slo options) is supported only for the async API.");
+    }
+
+    if (FLAGS_slo_percentile <= 0 || FLAGS_slo_percentile > 100) {
+        throw std::logic_error("-slo_percentile value should be in (0, 100] range.");
+    }
+
+    parseArrivalMode(FLAGS_arrival);
+
     return true;
 }
 
@@ -118,7 +143,7 @@ int main(int argc, char *argv[]) {
             return 0;
         }
 
-        bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
+        bool isNetworkCompiled = !FLAGS_m.empty() && fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Network is compiled" << slog::endl;
         }
@@ -145,6 +170,19 @@ int main(int argc, char *argv[]) {
         // Parse devices
         auto devices = parseDevices(device_name);
 
+        // In the multi-model mode the devices are taken from the model descriptions
+        std::vector<benchmark_app::ModelSpec> model_specs;
+        if (!FLAGS_multi_model.empty()) {
+            model_specs = benchmark_app::parseModelSpecs(FLAGS_multi_model);
+            devices.clear();
+            for (auto& spec : model_specs) {
+                for (auto& device : parseDevices(spec.device)) {
+                    if (std::find(devices.begin(), devices.end(), device) == devices.end())
+                        devices.push_back(device);
+                }
+            }
+        }
+
         // Parse nstreams per device
         std::map<std::string, std::string> device_nstreams = parseNStreamsValuePerDevice(devices, FLAGS_nstreams);
 
@@ -185,7 +223,12 @@ int main(int argc, char *argv[]) {
 
         slog::info << "InferenceEngine: " << GetInferenceEngineVersion() << slog::endl;
         slog::info << "Device info: " << slog::endl;
-        std::cout << ie.GetVersions(device_name) << std::endl;
+        if (model_specs.empty()) {
+            std::cout << ie.GetVersions(device_name) << std::endl;
+        } else {
+            for (auto& device : devices)
+                std::cout << ie.GetVersions(device) << std::endl;
+        }
 
         // ----------------- 3. Setting device configuration -----------------------------------------------------------
         next_step();
@@ -317,6 +360,51 @@ int main(int argc, char *argv[]) {
             return std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001;
         };
 
+        if (!model_specs.empty()) {
+            // ----------------- 4-9. Reading and loading the models, creating infer requests ------------------------
+            next_step("multi-model mode, " + std::to_string(model_specs.size()) + " models");
+            slog::info << "Network files are read at the model loading step" << slog::endl;
+            next_step();
+            slog::info << "Skipping the step in the multi-model mode" << slog::endl;
+            next_step();
+            slog::info << "Skipping the step in the multi-model mode" << slog::endl;
+            next_step();
+            auto contexts = benchmark_app::loadModels(ie, model_specs);
+            next_step();
+            slog::info << "Per-model streams and infer requests are taken from -multi_model option" << slog::endl;
+            next_step();
+            slog::info << "Infer requests are created at the model loading step" << slog::endl;
+
+            // ----------------- 10. Measuring performance -----------------------------------------------------------
+            std::string all_devices;
+            for (auto& device : devices)
+                all_devices += device + ",";
+            uint32_t duration_seconds = FLAGS_t != 0 ? FLAGS_t : deviceDefaultDeviceDurationInSeconds(all_devices);
+            next_step("Start inference of " + std::to_string(contexts.size()) + " models concurrently, limits: " +
+                      std::to_string(getDurationInMilliseconds(duration_seconds)) + " ms duration");
+            auto results = benchmark_app::runModels(contexts, parseArrivalMode(FLAGS_arrival), getDurationInNanoseconds(duration_seconds));
+
+            // ----------------- 11. Dumping statistics report -------------------------------------------------------
+            next_step();
+            if (statistics) {
+                for (size_t i = 0; i < results.size(); i++) {
+                    const std::string prefix = "model " + std::to_string(i);
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              {
+                                                      {prefix + " path", results[i].spec.path},
+                                                      {prefix + " device", results[i].spec.device},
+                                                      {prefix + " number of parallel infer requests", std::to_string(results[i].nireq)},
+                                                      {prefix + " total number of iterations", std::to_string(results[i].load.iterations)},
+                                                      {prefix + " throughput", double_to_string(results[i].batchSize * results[i].load.achievedQps)},
+                                              });
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, results[i].load.total.toParameters(prefix + " latency"));
+                }
+                statistics->dump();
+            }
+            benchmark_app::printMultiModelResults(results);
+            return 0;
+        }
+
         size_t batchSize = FLAGS_b;
         Precision precision = Precision::UNSPECIFIED;
         std::string topology_name = "";
@@ -443,7 +531,8 @@ int main(int argc, char *argv[]) {
 
         // Iteration limit
         uint32_t niter = FLAGS_niter;
-        if ((niter > 0) && (FLAGS_api == "async")) {
+        const bool openLoop = FLAGS_qps > 0;
+        if ((niter > 0) && (FLAGS_api == "async") && !openLoop) {
             niter = ((niter + nireq - 1)/nireq)*nireq;
             if (FLAGS_niter != niter) {
                 slog::warn << "Number of iterations was aligned by request number from "
@@ -472,6 +561,8 @@ int main(int argc, char *argv[]) {
                                               {"batch size", std::to_string(batchSize)},
                                               {"number of iterations", std::to_string(niter)},
                                               {"number of parallel infer requests", std::to_string(nireq)},
+                                              {"load generation", openLoop ? "open-loop (" + FLAGS_arrival + ")" : "closed-loop"},
+                                              {"target QPS", openLoop ? double_to_string(FLAGS_qps) : "-"},
                                               {"duration (ms)", std::to_string(getDurationInMilliseconds(duration_seconds))},
                                       });
             for (auto& nstreams : device_nstreams) {
@@ -502,6 +593,9 @@ int main(int argc, char *argv[]) {
                 ss << ", ";
             }
             ss << nireq << " inference requests";
+            if (openLoop) {
+                ss << " fed by open-loop " << FLAGS_arrival << " arrivals at " << FLAGS_qps << " QPS";
+            }
             std::stringstream device_ss;
             for (auto& nstreams : device_nstreams) {
                 if (!device_ss.str().empty()) {
@@ -555,9 +649,16 @@ int main(int argc, char *argv[]) {
         /** to align number if iterations to guarantee that last infer requests are executed in the same conditions **/
         ProgressBar progressBar(progressBarTotalCount, FLAGS_stream_output, FLAGS_progress);
 
-        while ((niter != 0LL && iteration < niter) ||
-               (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+        LoadResult openLoopResult;
+        if (openLoop) {
+            openLoopResult = runOpenLoop(inferRequestsQueue, FLAGS_qps, parseArrivalMode(FLAGS_arrival), niter, duration_nanoseconds);
+            iteration = openLoopResult.iterations;
+        }
+
+        while (!openLoop &&
+               ((niter != 0LL && iteration < niter) ||
+                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
+                (FLAGS_api == "async" && iteration % nireq != 0))) {
             inferRequest = inferRequestsQueue.getIdleRequest();
             if (!inferRequest) {
                 THROW_IE_EXCEPTION << "No idle Infer Requests!";
@@ -594,11 +695,25 @@ int main(int argc, char *argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.waitAll();
 
-        double latency = getMedianValue<double>(inferRequestsQueue.getLatencies());
+        // In the closed-loop mode requests never wait for each other, so total latencies are equal to compute ones
+        LatencyMetrics latencyMetrics(inferRequestsQueue.getTotalLatencies());
+        double latency = getMedianValue<double>(inferRequestsQueue.getTotalLatencies());
         double totalDuration = inferRequestsQueue.getDurationInMilliseconds();
         double fps = (FLAGS_api == "sync") ? batchSize * 1000.0 / latency :
                      batchSize * 1000.0 * iteration / totalDuration;
 
+        progressBar.finish();
+
+        LoadResult sloResult;
+        if (FLAGS_latency_slo > 0) {
+            uint64_t sweep_step_nanoseconds = duration_seconds != 0 ? duration_nanoseconds :
+                getDurationInNanoseconds(deviceDefaultDeviceDurationInSeconds(device_name));
+            slog::info << "Searching for the maximum throughput with p" << FLAGS_slo_percentile << " latency within "
+                       << FLAGS_latency_slo << " ms" << slog::endl;
+            sloResult = findMaxQpsUnderSlo(inferRequestsQueue, fps / batchSize, FLAGS_latency_slo, FLAGS_slo_percentile,
+                                           parseArrivalMode(FLAGS_arrival), sweep_step_nanoseconds);
+        }
+
         if (statistics) {
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
@@ -610,15 +725,26 @@ int main(int argc, char *argv[]) {
                                           {
                                                   {"latency (ms)", double_to_string(latency)},
                                           });
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS, latencyMetrics.toParameters("latency"));
+                if (openLoop) {
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              openLoopResult.queueing.toParameters("queueing delay"));
+                    statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                              openLoopResult.compute.toParameters("compute time"));
+                }
             }
             statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                       {
                                               {"throughput", double_to_string(fps)}
                                       });
+            if (FLAGS_latency_slo > 0) {
+                statistics->addParameters(StatisticsReport::Category::EXECUTION_RESULTS,
+                                          {
+                                                  {"max throughput under latency SLO", double_to_string(sloResult.achievedQps * batchSize)}
+                                          });
+            }
         }
 
-        progressBar.finish();
-
         // ----------------- 11. Dumping statistics report -------------------------------------------------------------
         next_step();
 
@@ -659,9 +785,25 @@ int main(int argc, char *argv[]) {
 
         std::cout << "Count:      " << iteration << " iterations" << std::endl;
         std::cout << "Duration:   " << double_to_string(totalDuration) << " ms" << std::endl;
-        if (device_name.find("MULTI") == std::string::npos)
+        if (device_name.find("MULTI") == std::string::npos) {
             std::cout << "Latency:    " << double_to_string(latency) << " ms" << std::endl;
+            std::cout << "    Average: " << double_to_string(latencyMetrics.avg) << " ms, Min: " << double_to_string(latencyMetrics.min)
+                      << " ms, Max: " << double_to_string(latencyMetrics.max) << " ms" << std::endl;
+            std::cout << "    p50: " << double_to_string(latencyMetrics.p50) << " ms, p90: " << double_to_string(latencyMetrics.p90)
+                      << " ms, p99: " << double_to_string(latencyMetrics.p99) << " ms, p99.9: " << double_to_string(latencyMetrics.p999)
+                      << " ms" << std::endl;
+            if (openLoop) {
+                std::cout << "    Queueing delay: avg " << double_to_string(openLoopResult.queueing.avg) << " ms, p99 "
+                          << double_to_string(openLoopResult.queueing.p99) << " ms" << std::endl;
+                std::cout << "    Compute time:   avg " << double_to_string(openLoopResult.compute.avg) << " ms, p99 "
+                          << double_to_string(openLoopResult.compute.p99) << " ms" << std::endl;
+            }
+        }
         std::cout << "Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+        if (FLAGS_latency_slo > 0) {
+            std::cout << "Max throughput with p" << FLAGS_slo_percentile << " latency within " << FLAGS_latency_slo << " ms: "
+                      << double_to_string(sloResult.achievedQps * batchSize) << " FPS" << std::endl;
+        }
     } catch (const std::exception& ex) {
         slog::err << ex.what() << slog::endl;
 
@@ -0,0 +1,218 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "multi_model.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace benchmark_app {
+
+namespace {
+
+ModelSpec parseModelOptions(const std::string& path, const std::string& options) {
+    ModelSpec spec;
+    spec.path = path;
+    for (auto& option : split(options, ';')) {
+        if (option.empty())
+            continue;
+        auto pos = option.find('=');
+        if (pos == std::string::npos)
+            throw std::logic_error("Can't parse option '" + option + "' of model " + path + ", expected <key>=<value>");
+        auto key = option.substr(0, pos);
+        auto value = option.substr(pos + 1);
+        if (key == "device") {
+            spec.device = value;
+        } else if (key == "nstreams") {
+            spec.nstreams = value;
+        } else if (key == "nireq") {
+            spec.nireq = std::stoul(value);
+        } else if (key == "qps") {
+            spec.qps = std::stod(value);
+            if (spec.qps < 0)
+                throw std::logic_error("qps of model " + path + " should be positive");
+        } else {
+            throw std::logic_error("Unknown option '" + key + "' of model " + path +
+                                   ". Supported options are: device, nstreams, nireq, qps");
+        }
+    }
+    return spec;
+}
+
+}  // namespace
+
+std::vector<ModelSpec> parseModelSpecs(const std::string& specs) {
+    std::vector<ModelSpec> result;
+    std::string search_string = specs;
+    while (!search_string.empty()) {
+        auto options_begin = search_string.find_first_of("[,");
+        auto path = search_string.substr(0, options_begin);
+        std::string options;
+        if (options_begin != std::string::npos && search_string[options_begin] == '[') {
+            auto options_end = search_string.find_first_of(']', options_begin);
+            if (options_end == std::string::npos)
+                throw std::logic_error("Can't parse -multi_model string: " + specs);
+            options = search_string.substr(options_begin + 1, options_end - options_begin - 1);
+            search_string = search_string.substr(options_end + 1);
+        } else {
+            search_string = options_begin == std::string::npos ? std::string() : search_string.substr(options_begin);
+        }
+        if (path.empty())
+            throw std::logic_error("Model path is missing in -multi_model string: " + specs);
+        result.push_back(parseModelOptions(path, options));
+
+        if (!search_string.empty()) {
+            if (search_string.front() != ',')
+                throw std::logic_error("Can't parse -multi_model string: " + specs);
+            search_string = search_string.substr(1);
+        }
+    }
+    return result;
+}
+
+std::vector<ModelContext::Ptr> loadModels(Core& ie, const std::vector<ModelSpec>& specs) {
+    std::vector<ModelContext::Ptr> contexts;
+    for (auto& spec : specs) {
+        auto context = std::make_shared<ModelContext>();
+        context->spec = spec;
+
+        CNNNetwork network = ie.ReadNetwork(spec.path);
+        const InputsDataMap inputInfo(network.getInputsInfo());
+        bool reshape = false;
+        auto app_inputs_info = getInputsInfo<InferenceEngine::InputInfo::Ptr>("", "", 0, inputInfo, reshape);
+        for (auto& item : inputInfo) {
+            if (app_inputs_info.at(item.first).isImage()) {
+                app_inputs_info.at(item.first).precision = Precision::U8;
+                item.second->setPrecision(Precision::U8);
+            }
+        }
+
+        std::map<std::string, std::string> config;
+        auto devices = parseDevices(spec.device);
+        for (auto& device : devices) {
+            std::vector<std::string> supported_config_keys = ie.GetMetric(device, METRIC_KEY(SUPPORTED_CONFIG_KEYS));
+            const std::string key = device + "_THROUGHPUT_STREAMS";
+            if (std::find(supported_config_keys.begin(), supported_config_keys.end(), key) != supported_config_keys.end()) {
+                if (!spec.nstreams.empty()) {
+                    config[key] = spec.nstreams;
+                } else if (std::string::npos == device.find("MYRIAD")) {
+                    config[key] = device + "_THROUGHPUT_AUTO";
+                }
+            } else if (!spec.nstreams.empty()) {
+                throw std::logic_error("Device " + device + " doesn't support config key '" + key + "'!");
+            }
+        }
+        // MULTI and HETERO forward the keys supported by the underlying devices to them
+        auto startTime = Time::now();
+        context->exeNetwork = ie.LoadNetwork(network, spec.device, config);
+        slog::info << "Load network " << spec.path << " to " << spec.device << " took "
+                   << std::chrono::duration_cast<ns>(Time::now() - startTime).count() * 0.000001 << " ms" << slog::endl;
+
+        uint32_t nireq = spec.nireq;
+        if (nireq == 0) {
+            nireq = context->exeNetwork.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
+        }
+        context->queue.reset(new InferRequestsQueue(context->exeNetwork, nireq));
+        size_t batchSize = network.getBatchSize();
+        fillBlobs({}, batchSize, app_inputs_info, context->queue->requests);
+
+        context->result.spec = spec;
+        context->result.nireq = nireq;
+        context->result.batchSize = batchSize;
+        if (devices.size() == 1 && config.count(devices.front() + "_THROUGHPUT_STREAMS")) {
+            context->result.nstreams = context->exeNetwork.GetConfig(devices.front() + "_THROUGHPUT_STREAMS").as<std::string>();
+        }
+        contexts.push_back(context);
+    }
+    return contexts;
+}
+
+std::vector<ModelResult> runModels(const std::vector<ModelContext::Ptr>& contexts, ArrivalMode arrivalMode, uint64_t durationNs) {
+    // warming up - out of scope
+    for (auto& context : contexts) {
+        auto inferRequest = context->queue->getIdleRequest();
+        inferRequest->startAsync();
+        context->queue->waitAll();
+        // rethrows possible exception of the warm-up run
+        inferRequest->wait();
+    }
+
+    std::vector<std::exception_ptr> errors(contexts.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < contexts.size(); i++) {
+        threads.emplace_back([&contexts, &errors, i, arrivalMode, durationNs] {
+            auto& context = contexts[i];
+            try {
+                context->result.load = context->spec.qps > 0 ?
+                    runOpenLoop(*context->queue, context->spec.qps, arrivalMode, 0, durationNs) :
+                    runClosedLoop(*context->queue, 0, durationNs);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    std::vector<ModelResult> results;
+    for (size_t i = 0; i < contexts.size(); i++) {
+        if (errors[i])
+            std::rethrow_exception(errors[i]);
+        results.push_back(contexts[i]->result);
+    }
+    return results;
+}
+
+void printMultiModelResults(const std::vector<ModelResult>& results) {
+    auto double_to_string = [] (const double number) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << number;
+        return ss.str();
+    };
+
+    double totalFps = 0.0;
+    double maxP99 = 0.0;
+    for (size_t i = 0; i < results.size(); i++) {
+        auto& result = results[i];
+        double fps = result.batchSize * result.load.achievedQps;
+        totalFps += fps;
+        maxP99 = std::max(maxP99, result.load.total.p99);
+
+        std::cout << "Model " << i << ": " << result.spec.path << " on " << result.spec.device
+                  << " (" << result.nireq << " infer requests"
+                  << (result.nstreams.empty() ? "" : ", " + result.nstreams + " streams")
+                  << (result.spec.qps > 0 ? ", open-loop " + double_to_string(result.spec.qps) + " QPS" : ", closed-loop")
+                  << ")" << std::endl;
+        std::cout << "    Count:      " << result.load.iterations << " iterations" << std::endl;
+        std::cout << "    Duration:   " << double_to_string(result.load.durationMs) << " ms" << std::endl;
+        std::cout << "    Latency:    p50 " << double_to_string(result.load.total.p50)
+                  << " ms, p90 " << double_to_string(result.load.total.p90)
+                  << " ms, p99 " << double_to_string(result.load.total.p99)
+                  << " ms, p99.9 " << double_to_string(result.load.total.p999) << " ms" << std::endl;
+        if (result.spec.qps > 0) {
+            std::cout << "    Queueing:   avg " << double_to_string(result.load.queueing.avg)
+                      << " ms, p99 " << double_to_string(result.load.queueing.p99) << " ms" << std::endl;
+        }
+        std::cout << "    Throughput: " << double_to_string(fps) << " FPS" << std::endl;
+    }
+
+    std::cout << "Aggregate:" << std::endl;
+    std::cout << "    Throughput:  " << double_to_string(totalFps) << " FPS" << std::endl;
+    std::cout << "    Worst p99 latency among models: " << double_to_string(maxP99) << " ms" << std::endl;
+}
+
+}  // namespace benchmark_app
@@ -0,0 +1,68 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <inference_engine.hpp>
+
+#include "load_generator.hpp"
+
+namespace benchmark_app {
+
+/// @brief Description of a single model of the multi-model benchmark
+struct ModelSpec {
+    std::string path;
+    std::string device = "CPU";
+    std::string nstreams;    //!< empty means the device default for the throughput mode
+    uint32_t nireq = 0;      //!< 0 means OPTIMAL_NUMBER_OF_INFER_REQUESTS of the executable network
+    double qps = 0.0;        //!< 0 means closed-loop load
+};
+
+/**
+ * @brief Parses the -multi_model option value.
+ * Format: "<path1>[device=CPU;nstreams=2;nireq=4;qps=100],<path2>[device=MULTI:CPU,GPU]", all options are optional.
+ */
+std::vector<ModelSpec> parseModelSpecs(const std::string& specs);
+
+/// @brief Per-model results of the multi-model benchmark
+struct ModelResult {
+    ModelSpec spec;
+    std::string nstreams;
+    uint32_t nireq = 0;
+    size_t batchSize = 1;
+    LoadResult load;
+};
+
+/// @brief Executable network and infer requests of one model of the multi-model benchmark
+struct ModelContext {
+    using Ptr = std::shared_ptr<ModelContext>;
+
+    ModelSpec spec;
+    InferenceEngine::ExecutableNetwork exeNetwork;
+    std::unique_ptr<InferRequestsQueue> queue;
+    ModelResult result;
+};
+
+/**
+ * @brief Reads and loads all models, creates and fills their infer requests.
+ * Device configuration common for all models is expected to be set to the Core beforehand.
+ */
+std::vector<ModelContext::Ptr> loadModels(InferenceEngine::Core& ie, const std::vector<ModelSpec>& specs);
+
+/**
+ * @brief Runs all models concurrently, each one from its own thread and with its own infer requests.
+ * Models share the Core and so the executors of the devices they are loaded to.
+ * @param durationNs Duration of the run in nanoseconds
+ */
+std::vector<ModelResult> runModels(const std::vector<ModelContext::Ptr>& contexts, ArrivalMode arrivalMode, uint64_t durationNs);
+
+/// @brief Prints per-model and aggregate throughput and latency
+void printMultiModelResults(const std::vector<ModelResult>& results);
+
+}  // namespace benchmark_app
@@ -7,9 +7,52 @@
 #include <utility>
 #include <map>
 #include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
 
 #include "statistics_report.hpp"
 
+LatencyMetrics::LatencyMetrics(const std::vector<double>& latencies) {
+    if (latencies.empty())
+        return;
+    std::vector<double> sorted(latencies);
+    std::sort(sorted.begin(), sorted.end());
+    avg = std::accumulate(sorted.begin(), sorted.end(), 0.0) / sorted.size();
+    min = sorted.front();
+    max = sorted.back();
+    p50 = percentile(sorted, 50.0);
+    p90 = percentile(sorted, 90.0);
+    p99 = percentile(sorted, 99.0);
+    p999 = percentile(sorted, 99.9);
+}
+
+double LatencyMetrics::percentile(const std::vector<double>& sortedLatencies, double percent) {
+    if (sortedLatencies.empty())
+        return 0.0;
+    auto rank = static_cast<size_t>(std::ceil(percent / 100.0 * sortedLatencies.size()));
+    rank = std::min(std::max<size_t>(rank, 1), sortedLatencies.size());
+    return sortedLatencies[rank - 1];
+}
+
+std::vector<std::pair<std::string, std::string>> LatencyMetrics::toParameters(const std::string& prefix) const {
+    auto to_string = [] (const double number) {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(2) << number;
+        return ss.str();
+    };
+    return {
+        {prefix + " avg (ms)", to_string(avg)},
+        {prefix + " min (ms)", to_string(min)},
+        {prefix + " max (ms)", to_string(max)},
+        {prefix + " p50 (ms)", to_string(p50)},
+        {prefix + " p90 (ms)", to_string(p90)},
+        {prefix + " p99 (ms)", to_string(p99)},
+        {prefix + " p99.9 (ms)", to_string(p999)},
+    };
+}
+
 void StatisticsReport::addParameters(const Category &category, const Parameters& parameters) {
     if (_parameters.count(category) == 0)
         _parameters[category] = parameters;
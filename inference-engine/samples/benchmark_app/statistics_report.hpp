@@ -19,6 +19,25 @@ static constexpr char noCntReport[] = "no_counters";
 static constexpr char averageCntReport[] = "average_counters";
 static constexpr char detailedCntReport[] = "detailed_counters";
 
+/// @brief Aggregated latency statistics (in milliseconds) over a set of inference requests
+struct LatencyMetrics {
+    LatencyMetrics() = default;
+    explicit LatencyMetrics(const std::vector<double>& latencies);
+
+    /// @brief Returns the value below which the given percent of the samples falls (nearest-rank method)
+    static double percentile(const std::vector<double>& sortedLatencies, double percent);
+
+    std::vector<std::pair<std::string, std::string>> toParameters(const std::string& prefix) const;
+
+    double avg = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+    double p999 = 0.0;
+};
+
 /// @brief Responsible for collecting of statistics and dumping to .csv file
 class StatisticsReport {
 public:
@@ -18,24 +18,45 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const InferRequestInternal::Ptr
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(InferRequest* inferRequest) : _inferRequest{inferRequest} {
+            explicit RequestExecutor(InferRequest* inferRequest, const HeteroStageQueue::Ptr& stageQueue) :
+                _inferRequest{inferRequest}, _stageQueue{stageQueue} {
                 _inferRequest->SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
                 [this] (InferRequest, StatusCode sts) mutable {
                     _status = sts;
+                    // let the next request waiting for the subgraph start it before this one moves to the next subgraph
+                    if (nullptr != _stageQueue) {
+                        _stageQueue->Release();
+                    }
                     auto capturedTask = std::move(_task);
                     capturedTask();
                 });
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                if (nullptr == _stageQueue) {
+                    _inferRequest->StartAsync();
+                    return;
+                }
+                _stageQueue->Run([this] {
+                    try {
+                        _inferRequest->StartAsync();
+                    } catch (...) {
+                        // a queued start runs on the thread of another request, so the error is reported via the status
+                        _status = StatusCode::GENERAL_ERROR;
+                        _stageQueue->Release();
+                        auto capturedTask = std::move(_task);
+                        capturedTask();
+                    }
+                });
             };
-            InferRequest*   _inferRequest = nullptr;
-            StatusCode      _status = StatusCode::OK;
-            Task            _task;
+            InferRequest*           _inferRequest = nullptr;
+            HeteroStageQueue::Ptr   _stageQueue;
+            StatusCode              _status = StatusCode::OK;
+            Task                    _task;
         };
 
-        auto reuestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request.get());
+        auto& subRequestDesc = _heteroInferRequest->_inferRequests[requestId];
+        auto reuestExecutor = std::make_shared<RequestExecutor>(subRequestDesc._request.get(), subRequestDesc._stageQueue);
         _pipeline.emplace_back(reuestExecutor, [reuestExecutor] {
             if (StatusCode::OK != reuestExecutor->_status) {
                 THROW_IE_EXCEPTION << InferenceEngine::details::as_status << reuestExecutor->_status;
@@ -49,6 +70,16 @@ void HeteroAsyncInferRequest::StartAsync_ThreadUnsafe() {
     RunFirstStage(_pipeline.begin(), _pipeline.end());
 }
 
+void HeteroAsyncInferRequest::Infer_ThreadUnsafe() {
+    if (_heteroInferRequest->_inferRequests.front()._stageQueue == nullptr) {
+        AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+    } else {
+        // the synchronous inference goes through the subgraph queues as well to respect the pipeline depth
+        _heteroInferRequest->updateInOutIfNeeded();
+        RunFirstStage(_pipeline.begin(), _pipeline.end(), _syncCallbackExecutor);
+    }
+}
+
 StatusCode HeteroAsyncInferRequest::Wait(int64_t millis_timeout) {
     auto waitStatus = StatusCode::OK;
     try {
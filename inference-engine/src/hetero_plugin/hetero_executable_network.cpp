@@ -10,7 +10,6 @@
 #include <caseless.hpp>
 
 #include <vector>
-#include <deque>
 #include <map>
 #include <utility>
 #include <fstream>
@@ -27,6 +26,8 @@
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "hetero/hetero_plugin_config.hpp"
 #include "hetero_plugin.hpp"
+#include "hetero_partitioner.hpp"
+#include <threading/ie_executor_manager.hpp>
 
 #include <ngraph/function.hpp>
 #include <ngraph/variant.hpp>
@@ -81,7 +82,11 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     if (queryNetworkResult.supportedLayersMap.empty()) {
         auto it = _config.find("TARGET_FALLBACK");
         if (it != _config.end()) {
-            queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+            if (Engine::UseCostModelPartitioning(_config)) {
+                queryNetworkResult.supportedLayersMap = PartitionByCostModel(network, orderedOps);
+            } else {
+                queryNetworkResult = _heteroPlugin->QueryNetwork(network, _config);
+            }
         } else {
             THROW_IE_EXCEPTION << "The 'TARGET_FALLBACK' option was not defined for heterogeneous plugin";
         }
@@ -91,10 +96,6 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     using NodeSet = std::unordered_set<ngraph::Node*>;
     using InputSet = std::set<Input>;
 
-    auto InputNode  = [] (const ngraph::Input<ngraph::Node>& input) {
-        return input.get_source_output().get_node();
-    };
-
     // Set results, constants and parameters affinity
     for (auto&& node : clonedFunction->get_ops()) {
         if (ngraph::op::is_constant(node) || ngraph::op::is_output(node) || ngraph::op::is_parameter(node)) {
@@ -176,115 +177,14 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
     }
 
 
-    NodeMap<InputSet> nodeInputDependencies;
     NodeSet graphInputNodes;
-    InputSet subgraphInputs;
-    // Get all subgraph inputs using just node affinities. Also collect transitive closure
     for (auto&& node : orderedOps) {
         if (ngraph::op::is_parameter(node) || ngraph::op::is_constant(node)) {
             graphInputNodes.insert(node.get());
-            subgraphInputs.insert(Input{node.get(), 0});
-            nodeInputDependencies[node.get()].insert(Input{node.get(), 0});
-        } else {
-            auto inputs = node->inputs();
-            auto& nodeInputDependency = nodeInputDependencies[node.get()];
-            for (auto&& input : inputs) {
-                nodeInputDependency.insert(input);
-                auto& inputDependency = nodeInputDependencies[InputNode(input)];
-                nodeInputDependency.insert(inputDependency.begin(), inputDependency.end());
-                if (affinities[node.get()] != affinities[InputNode(input)]) {
-                    subgraphInputs.insert(input);
-                }
-            }
-        }
-    }
-
-    // Assign each node subgraph ID
-    auto CollectSubgraphs = [&] {
-        std::deque<int> subgraphIds;
-        NodeMap<int*> subgraphIdPtrs;
-        for (auto&& node : orderedOps) {
-            auto allNodeInputs = node->inputs();
-            std::vector<Input> inputs;
-            for (auto&& input : allNodeInputs) {
-                if (!contains(subgraphInputs, input)) {
-                    inputs.emplace_back(std::move(input));
-                }
-            }
-            if (inputs.empty()) {
-                subgraphIds.push_back(subgraphIds.size());
-                subgraphIdPtrs.emplace(node.get(), &(subgraphIds.back()));
-            } else {
-                auto firstInputSubgraphIdPtr = subgraphIdPtrs[InputNode(inputs.front())];
-                for (auto&& input : inputs) {
-                    auto inputId = *subgraphIdPtrs[InputNode(input)];
-                    for (auto& subgraphId : subgraphIds) {
-                        if (subgraphId == inputId) {
-                            subgraphId = *firstInputSubgraphIdPtr;
-                        }
-                    }
-                }
-                subgraphIdPtrs.emplace(node.get(), firstInputSubgraphIdPtr);
-            }
-        }
-        NodeMap<int> result;
-        for (auto&& subgraphIdPtr : subgraphIdPtrs) {
-            result.emplace(subgraphIdPtr.first, *(subgraphIdPtr.second));
-        }
-        return result;
-    };
-
-    // Split cyclic dependencies.
-    for (std::size_t prevSubgraphs = 0, cyclicSplitStep = 0; prevSubgraphs != subgraphInputs.size(); ++cyclicSplitStep) {
-        IE_ASSERT(cyclicSplitStep < orderedOps.size());
-        prevSubgraphs = subgraphInputs.size();
-        auto subgraphIds = CollectSubgraphs();
-        // All inputs that belong to the same subgraph as node
-        std::unordered_map<ngraph::Node*, InputSet> nodeSubgraphInputDependencies;
-        // All inputs that depends on the same subgraph as node
-        std::unordered_map<ngraph::Node*, InputSet> nodeSubgraphCyclicInputDependencies;
-        for (auto&& node : orderedOps) {
-            auto& nodeSubgraphInputDependency = nodeSubgraphInputDependencies[node.get()];
-            auto allNodeSubgraphInputs = Intersection(nodeInputDependencies[node.get()], subgraphInputs);
-            for (auto&& subgraphInput : allNodeSubgraphInputs) {
-                if (subgraphIds[node.get()] == subgraphIds[subgraphInput.get_node()]) {
-                    nodeSubgraphInputDependency.emplace(subgraphInput);
-                }
-            }
-            auto& nodeSubgraphCyclicInputDependency = nodeSubgraphCyclicInputDependencies[node.get()];
-            for (auto&& subgraphInput : allNodeSubgraphInputs) {
-                if (!ngraph::op::is_parameter(subgraphInput.get_node()) &&
-                    !ngraph::op::is_constant(subgraphInput.get_node()) &&
-                    subgraphIds[node.get()] == subgraphIds[InputNode(subgraphInput)]) {
-                    nodeSubgraphCyclicInputDependency.emplace(subgraphInput);
-                }
-            }
-        }
-
-        for (auto&& node : orderedOps) {
-            auto& nodeSubgraphCyclicInputDependency = nodeSubgraphCyclicInputDependencies[node.get()];
-            if (!nodeSubgraphCyclicInputDependency.empty()) {
-                // Collect all subgraph inputs that cyclic subgraph output depends on
-                InputSet cyclicInputsDependencies;
-                for (auto&& cyclicInput : nodeSubgraphCyclicInputDependency) {
-                    for (auto&& input : nodeSubgraphInputDependencies[InputNode(cyclicInput)]) {
-                        cyclicInputsDependencies.emplace(input);
-                    }
-                }
-                for (auto&& input : node->inputs()) {
-                    auto& inputNodeSubgraphCyclicInputDependency = nodeSubgraphCyclicInputDependencies[InputNode(input)];
-                    auto& inputNodeSubgraphInputDependency = nodeSubgraphInputDependencies[InputNode(input)];
-                    if (!Intersects(nodeSubgraphCyclicInputDependency,
-                                    inputNodeSubgraphCyclicInputDependency) &&
-                        Intersects(cyclicInputsDependencies, inputNodeSubgraphInputDependency)) {
-                        subgraphInputs.insert(input);
-                    }
-                }
-            }
         }
     }
-
-    auto subgraphIds = CollectSubgraphs();
+    InputSet subgraphInputs;
+    auto subgraphIds = SplitSubgraphs(orderedOps, affinities, subgraphInputs);
     // Break graph using insertion of result parameter split
     NodeMap<ngraph::Node*> subgraphParameterToPrevResult;
     std::vector<std::shared_ptr<ngraph::op::Result>> results;
@@ -413,11 +313,33 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
                 }
             }}.run_on_function(ngraph::clone_function(*function));
     }
+    _pipelineDepth = Engine::GetPipelineDepth(_config);
+    if (_pipelineDepth > 0) {
+        // the exclusive execution would serialize the subgraphs of the different requests and defeat the pipelining
+        _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
+    }
+    // the subgraphs are independent, so they are compiled in parallel
+    std::vector<Task> loads;
     for (auto&& network : networks) {
-        auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
-        network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
-            network._device, metaDevices[network._device]);
+        loads.push_back([&] {
+            auto metaDevices = _heteroPlugin->GetDevicePlugins(network._device, _config);
+            network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
+                network._device, metaDevices[network._device]);
+        });
     }
+    if (loads.size() > 1) {
+        auto executor = ExecutorManager::getInstance()->getIdleCPUStreamsExecutor(
+            IStreamsExecutor::Config{"HeteroAsyncLoad",
+                                     static_cast<int>(loads.size()),
+                                     1 /*single thread per stream*/,
+                                     IStreamsExecutor::ThreadBindingType::NONE});
+        executor->runAndWait(loads);
+    } else {
+        for (auto&& load : loads) {
+            load();
+        }
+    }
+    InitStageQueues();
 }
 
 HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&                               heteroModel,
@@ -465,6 +387,10 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     for (auto&& config : configs) {
         importedConfigs[config.first] = config.second;
     }
+    _pipelineDepth = Engine::GetPipelineDepth(importedConfigs);
+    if (_pipelineDepth > 0) {
+        importedConfigs[KEY_EXCLUSIVE_ASYNC_REQUESTS] = NO;
+    }
 
     std::vector<NetworkDesc> descs;
     pugi::xml_node subnetworksNode = heteroNode.child("subnetworks");
@@ -543,6 +469,38 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream&
     this->_config = importedConfigs;
     this->networks = std::move(descs);
     this->SetPointerToPlugin(_heteroPlugin->shared_from_this());
+    InitStageQueues();
+}
+
+std::map<std::string, std::string> HeteroExecutableNetwork::PartitionByCostModel(
+        const InferenceEngine::CNNNetwork&                  network,
+        const std::vector<std::shared_ptr<ngraph::Node>>&   orderedOps) {
+    std::map<std::string, std::string> affinities;
+    std::vector<HeteroPartitioner::DeviceDesc> devices;
+    // the priority based assignment is the starting point of the partitioning
+    for (auto&& queryResult : _heteroPlugin->QueryNetworkPerDevice(network, _config)) {
+        HeteroPartitioner::DeviceDesc device;
+        device._name = queryResult.first;
+        for (auto&& layer : queryResult.second.supportedLayersMap) {
+            device._supportedLayers.emplace(layer.first);
+            affinities.emplace(layer.first, queryResult.first);
+        }
+        device._operationCosts = _heteroPlugin->GetOperationCosts(queryResult.first);
+        devices.emplace_back(std::move(device));
+    }
+    HeteroPartitioner partitioner{std::move(devices), Engine::GetMaxSubgraphs(_config)};
+    _partitionCost = partitioner.Run(orderedOps, affinities);
+    _partition = affinities;
+    return affinities;
+}
+
+void HeteroExecutableNetwork::InitStageQueues() {
+    _stageQueues.clear();
+    if (_pipelineDepth > 0) {
+        for (std::size_t i = 0; i < networks.size(); ++i) {
+            _stageQueues.push_back(std::make_shared<HeteroStageQueue>(_pipelineDepth));
+        }
+    }
 }
 
 void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
@@ -615,21 +573,26 @@ void HeteroExecutableNetwork::ExportImpl(std::ostream& heteroModel) {
             }
 
             // Note: custom ngraph extensions are not supported
-            std::stringstream xmlFile, binFile;
-            ngraph::pass::Serialize serializer(xmlFile, binFile,
-                ngraph::pass::Serialize::Version::IR_V10);
+            // the constants are written directly from the function buffers, their size precedes the data
+            std::stringstream xmlFile;
+            std::vector<std::pair<const char*, std::size_t>> constants;
+            std::uint64_t constantsSize = 0;
+            ngraph::pass::Serialize serializer(xmlFile, [&] (const char* data, std::size_t size) {
+                    constants.emplace_back(data, size);
+                    constantsSize += size;
+                }, ngraph::pass::Serialize::Version::IR_V10);
             serializer.run_on_function(subnet.getFunction());
 
-            auto m_constants = binFile.str();
             auto m_model = xmlFile.str();
 
             auto dataSize = static_cast<std::uint64_t>(m_model.size());
             heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
             heteroModel.write(m_model.c_str(), dataSize);
 
-            dataSize = static_cast<std::uint64_t>(m_constants.size());
-            heteroModel.write(reinterpret_cast<char*>(&dataSize), sizeof(dataSize));
-            heteroModel.write(reinterpret_cast<char*>(&m_constants[0]), dataSize);
+            heteroModel.write(reinterpret_cast<char*>(&constantsSize), sizeof(constantsSize));
+            for (auto&& constant : constants) {
+                heteroModel.write(constant.first, constant.second);
+            }
         }
     }
 }
@@ -642,7 +605,11 @@ InferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
     for (auto&& subnetwork : networks) {
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
-        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index));
+        if (!_stageQueues.empty()) {
+            desc._stageQueue = _stageQueues[index];
+        }
+        ++index;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs,
@@ -669,6 +636,13 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetConfig(const std::string
         auto it = _config.find(name);
         IE_ASSERT(it != _config.end());
         result = it->second == YES ? true : false;
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        result = static_cast<int>(_pipelineDepth);
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(name);
+        result = it != _config.end() ? it->second : std::string{HETERO_CONFIG_VALUE(PRIORITY)};
+    } else if (name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        result = static_cast<int>(Engine::GetMaxSubgraphs(_config));
     } else {
         // find config key among plugin config keys
         for (auto&& desc : networks) {
@@ -732,6 +706,10 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)
         };
+        if (!_partition.empty()) {
+            heteroMetrics.push_back(METRIC_KEY(HETERO_PARTITION));
+            heteroMetrics.push_back(METRIC_KEY(HETERO_PARTITION_COST));
+        }
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -753,6 +731,9 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         std::vector<std::string> heteroConfigKeys = {
             "TARGET_FALLBACK",
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)
         };
 
@@ -774,11 +755,17 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, heteroConfigKeys);
     } else if (EXEC_NETWORK_METRIC_KEY(NETWORK_NAME) == name) {
         IE_SET_METRIC_RETURN(NETWORK_NAME, _name);
+    } else if (!_partition.empty() && EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION) == name) {
+        IE_SET_METRIC_RETURN(HETERO_PARTITION, _partition);
+    } else if (!_partition.empty() && EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION_COST) == name) {
+        IE_SET_METRIC_RETURN(HETERO_PARTITION_COST, static_cast<float>(_partitionCost));
     } else if (EXEC_NETWORK_METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS) == name) {
         unsigned int value = 0u;
         for (auto&& desc : networks) {
             value = std::max(value, desc._network.GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
         }
+        // every subgraph should have its own requests in flight to keep all the pipeline stages busy
+        value = std::max(value, _pipelineDepth * static_cast<unsigned int>(networks.size()));
         IE_SET_METRIC_RETURN(OPTIMAL_NUMBER_OF_INFER_REQUESTS, value);
     } else {
         // find metric key among plugin metrics
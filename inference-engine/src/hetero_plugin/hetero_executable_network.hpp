@@ -63,6 +63,9 @@ public:
 private:
     void InitCNNImpl(const InferenceEngine::CNNNetwork&    network);
     void InitNgraph(const InferenceEngine::CNNNetwork&     network);
+    void InitStageQueues();
+    std::map<std::string, std::string> PartitionByCostModel(const InferenceEngine::CNNNetwork&                  network,
+                                                            const std::vector<std::shared_ptr<ngraph::Node>>&   orderedOps);
 
     struct NetworkDesc {
         std::string                                 _device;
@@ -75,6 +78,10 @@ private:
     std::string                         _name;
     std::map<std::string, std::string>  _config;
     std::unordered_map<std::string, std::string> _blobNameMap;
+    unsigned int                        _pipelineDepth = 0;
+    std::vector<HeteroStageQueue::Ptr>  _stageQueues;
+    std::map<std::string, std::string>  _partition;
+    double                              _partitionCost = 0.0;
 };
 
 }  // namespace HeteroPlugin
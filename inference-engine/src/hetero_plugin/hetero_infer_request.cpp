@@ -11,11 +11,38 @@
 #include <cassert>
 #include <map>
 #include <string>
+#include <utility>
 
 using namespace HeteroPlugin;
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
 
+void HeteroStageQueue::Run(Task task) {
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_inFlight == _depth) {
+            _tasks.push(std::move(task));
+            return;
+        }
+        ++_inFlight;
+    }
+    task();
+}
+
+void HeteroStageQueue::Release() {
+    Task task;
+    {
+        std::lock_guard<std::mutex> lock{_mutex};
+        if (_tasks.empty()) {
+            --_inFlight;
+            return;
+        }
+        task = std::move(_tasks.front());
+        _tasks.pop();
+    }
+    task();
+}
+
 HeteroInferRequest::HeteroInferRequest(InferenceEngine::InputsDataMap networkInputs,
                                        InferenceEngine::OutputsDataMap networkOutputs,
                                        const SubRequestsList& inferRequests,
@@ -13,15 +13,40 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <mutex>
+#include <queue>
 #include <unordered_map>
 #include <ie_common.h>
 #include <cpp_interfaces/impl/ie_infer_request_internal.hpp>
 #include <cpp_interfaces/impl/ie_executable_network_internal.hpp>
 #include <cpp/ie_infer_request.hpp>
 #include <cpp/ie_executable_network.hpp>
+#include <threading/ie_itask_executor.hpp>
 
 namespace HeteroPlugin {
 
+/**
+ * @brief Limits the number of the inference requests running a subgraph at once in the pipelined mode.
+ * The requests over the limit wait in the queue and are started when a running one completes the subgraph
+ */
+class HeteroStageQueue {
+public:
+    using Ptr = std::shared_ptr<HeteroStageQueue>;
+
+    explicit HeteroStageQueue(unsigned int depth) : _depth{depth} {}
+
+    // runs the task right away if there is a vacant slot, otherwise queues it. The task must not throw
+    void Run(InferenceEngine::Task task);
+    // frees the slot taken by the Run, or passes it to the first queued task
+    void Release();
+
+private:
+    std::mutex                          _mutex;
+    std::queue<InferenceEngine::Task>   _tasks;
+    unsigned int                        _inFlight = 0;
+    const unsigned int                  _depth;
+};
+
 class HeteroInferRequest : public InferenceEngine::InferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
@@ -30,6 +55,7 @@ public:
         InferenceEngine::ExecutableNetwork  _network;
         InferenceEngine::InferRequest::Ptr  _request;
         openvino::itt::handle_t             _profilingTask;
+        HeteroStageQueue::Ptr               _stageQueue;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
@@ -0,0 +1,402 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hetero_partitioner.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+
+#include <details/ie_exception.hpp>
+#include <ie_algorithm.hpp>
+#include <ngraph/op/util/op_types.hpp>
+
+using namespace HeteroPlugin;
+using namespace InferenceEngine::details;
+
+template<typename T>
+using NodeMap = std::unordered_map<ngraph::Node*, T>;
+
+namespace {
+
+// cost of passing one tensor element from one device to another
+constexpr double transferCostPerElement = 1.0;
+// overhead of every subgraph (the infer request dispatch, the blobs setup), about 10us of element-wise work
+constexpr double subgraphOverhead = 1e4;
+
+bool IsPartitionedNode(const ngraph::Node* node) {
+    return !ngraph::op::is_constant(node) && !ngraph::op::is_parameter(node) && !ngraph::op::is_output(node);
+}
+
+double ElementsCount(const ngraph::PartialShape& shape) {
+    return shape.is_static() ? static_cast<double>(ngraph::shape_size(shape.to_shape())) : 1.0;
+}
+
+}  // namespace
+
+std::unordered_map<ngraph::Node*, int> HeteroPlugin::SplitSubgraphs(
+        const std::vector<std::shared_ptr<ngraph::Node>>&       orderedOps,
+        const std::unordered_map<ngraph::Node*, std::string>&   affinities,
+        std::set<ngraph::Input<ngraph::Node>>&                  subgraphInputs) {
+    using Input = ngraph::Input<ngraph::Node>;
+    using InputSet = std::set<Input>;
+
+    auto InputNode  = [] (const ngraph::Input<ngraph::Node>& input) {
+        return input.get_source_output().get_node();
+    };
+    auto Affinity = [&] (ngraph::Node* node) {
+        auto itAffinity = affinities.find(node);
+        return itAffinity == affinities.end() ? std::string{} : itAffinity->second;
+    };
+
+    NodeMap<InputSet> nodeInputDependencies;
+    // Get all subgraph inputs using just node affinities. Also collect transitive closure
+    for (auto&& node : orderedOps) {
+        if (ngraph::op::is_parameter(node) || ngraph::op::is_constant(node)) {
+            subgraphInputs.insert(Input{node.get(), 0});
+            nodeInputDependencies[node.get()].insert(Input{node.get(), 0});
+        } else {
+            auto inputs = node->inputs();
+            auto& nodeInputDependency = nodeInputDependencies[node.get()];
+            for (auto&& input : inputs) {
+                nodeInputDependency.insert(input);
+                auto& inputDependency = nodeInputDependencies[InputNode(input)];
+                nodeInputDependency.insert(inputDependency.begin(), inputDependency.end());
+                if (Affinity(node.get()) != Affinity(InputNode(input))) {
+                    subgraphInputs.insert(input);
+                }
+            }
+        }
+    }
+
+    // Assign each node subgraph ID
+    auto CollectSubgraphs = [&] {
+        std::deque<int> subgraphIds;
+        NodeMap<int*> subgraphIdPtrs;
+        for (auto&& node : orderedOps) {
+            auto allNodeInputs = node->inputs();
+            std::vector<Input> inputs;
+            for (auto&& input : allNodeInputs) {
+                if (!contains(subgraphInputs, input)) {
+                    inputs.emplace_back(std::move(input));
+                }
+            }
+            if (inputs.empty()) {
+                subgraphIds.push_back(subgraphIds.size());
+                subgraphIdPtrs.emplace(node.get(), &(subgraphIds.back()));
+            } else {
+                auto firstInputSubgraphIdPtr = subgraphIdPtrs[InputNode(inputs.front())];
+                for (auto&& input : inputs) {
+                    auto inputId = *subgraphIdPtrs[InputNode(input)];
+                    for (auto& subgraphId : subgraphIds) {
+                        if (subgraphId == inputId) {
+                            subgraphId = *firstInputSubgraphIdPtr;
+                        }
+                    }
+                }
+                subgraphIdPtrs.emplace(node.get(), firstInputSubgraphIdPtr);
+            }
+        }
+        NodeMap<int> result;
+        for (auto&& subgraphIdPtr : subgraphIdPtrs) {
+            result.emplace(subgraphIdPtr.first, *(subgraphIdPtr.second));
+        }
+        return result;
+    };
+
+    // Split cyclic dependencies.
+    for (std::size_t prevSubgraphs = 0, cyclicSplitStep = 0; prevSubgraphs != subgraphInputs.size(); ++cyclicSplitStep) {
+        IE_ASSERT(cyclicSplitStep < orderedOps.size());
+        prevSubgraphs = subgraphInputs.size();
+        auto subgraphIds = CollectSubgraphs();
+        // All inputs that belong to the same subgraph as node
+        std::unordered_map<ngraph::Node*, InputSet> nodeSubgraphInputDependencies;
+        // All inputs that depends on the same subgraph as node
+        std::unordered_map<ngraph::Node*, InputSet> nodeSubgraphCyclicInputDependencies;
+        for (auto&& node : orderedOps) {
+            auto& nodeSubgraphInputDependency = nodeSubgraphInputDependencies[node.get()];
+            auto allNodeSubgraphInputs = Intersection(nodeInputDependencies[node.get()], subgraphInputs);
+            for (auto&& subgraphInput : allNodeSubgraphInputs) {
+                if (subgraphIds[node.get()] == subgraphIds[subgraphInput.get_node()]) {
+                    nodeSubgraphInputDependency.emplace(subgraphInput);
+                }
+            }
+            auto& nodeSubgraphCyclicInputDependency = nodeSubgraphCyclicInputDependencies[node.get()];
+            for (auto&& subgraphInput : allNodeSubgraphInputs) {
+                if (!ngraph::op::is_parameter(subgraphInput.get_node()) &&
+                    !ngraph::op::is_constant(subgraphInput.get_node()) &&
+                    subgraphIds[node.get()] == subgraphIds[InputNode(subgraphInput)]) {
+                    nodeSubgraphCyclicInputDependency.emplace(subgraphInput);
+                }
+            }
+        }
+
+        for (auto&& node : orderedOps) {
+            auto& nodeSubgraphCyclicInputDependency = nodeSubgraphCyclicInputDependencies[node.get()];
+            if (!nodeSubgraphCyclicInputDependency.empty()) {
+                // Collect all subgraph inputs that cyclic subgraph output depends on
+                InputSet cyclicInputsDependencies;
+                for (auto&& cyclicInput : nodeSubgraphCyclicInputDependency) {
+                    for (auto&& input : nodeSubgraphInputDependencies[InputNode(cyclicInput)]) {
+                        cyclicInputsDependencies.emplace(input);
+                    }
+                }
+                for (auto&& input : node->inputs()) {
+                    auto& inputNodeSubgraphCyclicInputDependency = nodeSubgraphCyclicInputDependencies[InputNode(input)];
+                    auto& inputNodeSubgraphInputDependency = nodeSubgraphInputDependencies[InputNode(input)];
+                    if (!Intersects(nodeSubgraphCyclicInputDependency,
+                                    inputNodeSubgraphCyclicInputDependency) &&
+                        Intersects(cyclicInputsDependencies, inputNodeSubgraphInputDependency)) {
+                        subgraphInputs.insert(input);
+                    }
+                }
+            }
+        }
+    }
+
+    return CollectSubgraphs();
+}
+
+HeteroPartitioner::HeteroPartitioner(std::vector<DeviceDesc> devices, std::size_t maxSubgraphs) :
+    _devices{std::move(devices)},
+    _maxSubgraphs{maxSubgraphs} {
+}
+
+double HeteroPartitioner::OperationCost(const ngraph::Node& node, const DeviceDesc& device) const {
+    double elements = 0.0;
+    for (std::size_t i = 0; i < node.get_output_size(); ++i) {
+        elements += ElementsCount(node.get_output_partial_shape(i));
+    }
+    auto& costs = device._operationCosts;
+    auto itCost = costs.find(node.get_type_name());
+    if (itCost == costs.end()) {
+        itCost = costs.find("default");
+    }
+    const double costPerElement = itCost == costs.end() ? 1.0 : itCost->second;
+    return costPerElement * std::max(elements, 1.0);
+}
+
+double HeteroPartitioner::Run(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                              std::map<std::string, std::string>& affinities) const {
+    const auto infinity = std::numeric_limits<double>::infinity();
+    const auto numDevices = _devices.size();
+    std::unordered_map<std::string, std::size_t> deviceIds;
+    for (std::size_t d = 0; d < numDevices; ++d) {
+        deviceIds.emplace(_devices[d]._name, d);
+    }
+
+    // the layers that are not supported by any device are left as is, they are reported by the caller
+    std::vector<const ngraph::Node*> ops;
+    std::unordered_map<const ngraph::Node*, std::size_t> opIds;
+    std::vector<std::size_t> assignment;
+    for (auto&& node : orderedOps) {
+        if (!IsPartitionedNode(node.get())) {
+            continue;
+        }
+        auto itAffinity = affinities.find(node->get_friendly_name());
+        if (itAffinity == affinities.end()) {
+            continue;
+        }
+        auto itDevice = deviceIds.find(itAffinity->second);
+        IE_ASSERT(itDevice != deviceIds.end());
+        opIds.emplace(node.get(), ops.size());
+        ops.push_back(node.get());
+        assignment.push_back(itDevice->second);
+    }
+
+    std::vector<std::vector<double>> computeCosts(ops.size(), std::vector<double>(numDevices, infinity));
+    for (std::size_t op = 0; op < ops.size(); ++op) {
+        for (std::size_t d = 0; d < numDevices; ++d) {
+            if (_devices[d]._supportedLayers.count(ops[op]->get_friendly_name()) != 0) {
+                computeCosts[op][d] = OperationCost(*ops[op], _devices[d]);
+            }
+        }
+    }
+
+    struct Edge {
+        std::size_t _src;
+        std::size_t _dst;
+        double      _cost;
+    };
+    std::vector<Edge> edges;
+    std::vector<std::vector<std::size_t>> opEdges(ops.size());
+    for (std::size_t op = 0; op < ops.size(); ++op) {
+        for (auto&& input : ops[op]->inputs()) {
+            auto source = input.get_source_output();
+            auto itSource = opIds.find(source.get_node());
+            if (itSource == opIds.end()) {
+                continue;
+            }
+            opEdges[itSource->second].push_back(edges.size());
+            opEdges[op].push_back(edges.size());
+            edges.push_back({itSource->second, op, transferCostPerElement * ElementsCount(source.get_partial_shape())});
+        }
+    }
+
+    // parameters and constants follow their first consumer, results follow their producer
+    auto Neighbour = [&] (const std::shared_ptr<ngraph::Node>& node) -> const ngraph::Node* {
+        if (ngraph::op::is_output(node)) {
+            return node->input_value(0).get_node();
+        }
+        for (auto&& input : node->output(0).get_target_inputs()) {
+            if (opIds.count(input.get_node()) != 0) {
+                return input.get_node();
+            }
+        }
+        return nullptr;
+    };
+
+    // the subgraphs the executable network creates from the current assignment
+    auto CountSubgraphs = [&] {
+        std::unordered_map<ngraph::Node*, std::string> nodeAffinities;
+        for (auto&& node : orderedOps) {
+            auto itOp = opIds.find(IsPartitionedNode(node.get()) ? node.get() : Neighbour(node));
+            if (itOp != opIds.end()) {
+                nodeAffinities.emplace(node.get(), _devices[assignment[itOp->second]]._name);
+            } else {
+                auto itAffinity = affinities.find(node->get_friendly_name());
+                if (itAffinity != affinities.end()) {
+                    nodeAffinities.emplace(node.get(), itAffinity->second);
+                }
+            }
+        }
+        std::set<ngraph::Input<ngraph::Node>> subgraphInputs;
+        std::unordered_set<int> subgraphs;
+        for (auto&& subgraphId : SplitSubgraphs(orderedOps, nodeAffinities, subgraphInputs)) {
+            subgraphs.insert(subgraphId.second);
+        }
+        return subgraphs.size();
+    };
+
+    // fragments are the connected components of the layers assigned to the same device
+    std::vector<std::size_t> fragmentIds(ops.size());
+    std::vector<std::vector<std::size_t>> fragments;
+    auto CollectFragments = [&] {
+        std::vector<std::size_t> parents(ops.size());
+        std::iota(parents.begin(), parents.end(), 0);
+        auto Find = [&] (std::size_t id) {
+            while (parents[id] != id) {
+                parents[id] = parents[parents[id]];
+                id = parents[id];
+            }
+            return id;
+        };
+        for (auto&& edge : edges) {
+            if (assignment[edge._src] == assignment[edge._dst]) {
+                parents[Find(edge._src)] = Find(edge._dst);
+            }
+        }
+        fragments.clear();
+        std::unordered_map<std::size_t, std::size_t> rootToFragment;
+        for (std::size_t op = 0; op < ops.size(); ++op) {
+            auto itFragment = rootToFragment.emplace(Find(op), fragments.size());
+            if (itFragment.second) {
+                fragments.emplace_back();
+            }
+            fragmentIds[op] = itFragment.first->second;
+            fragments[fragmentIds[op]].push_back(op);
+        }
+    };
+
+    // every step moves a whole fragment to another device. The moves either reduce the estimated cost,
+    // or, while the subgraphs are over the limit, reduce the number of the subgraphs with the least cost increase
+    const std::size_t maxSteps = std::max<std::size_t>(ops.size(), 1) * std::max<std::size_t>(numDevices, 1);
+    for (std::size_t step = 0; step < maxSteps; ++step) {
+        CollectFragments();
+        const std::size_t subgraphsCount = _maxSubgraphs != 0 ? CountSubgraphs() : fragments.size();
+        const bool overLimit = _maxSubgraphs != 0 && subgraphsCount > _maxSubgraphs;
+        std::size_t bestFragment = 0, bestDevice = 0;
+        double bestDelta = infinity;
+        bool bestMerges = false;
+        for (std::size_t fragment = 0; fragment < fragments.size(); ++fragment) {
+            const auto device = assignment[fragments[fragment].front()];
+            for (std::size_t d = 0; d < numDevices; ++d) {
+                if (d == device) {
+                    continue;
+                }
+                double delta = 0.0;
+                for (auto op : fragments[fragment]) {
+                    delta += computeCosts[op][d] - computeCosts[op][device];
+                }
+                if (!std::isfinite(delta)) {
+                    continue;
+                }
+                std::unordered_set<std::size_t> mergedFragments;
+                for (auto op : fragments[fragment]) {
+                    for (auto edgeId : opEdges[op]) {
+                        auto& edge = edges[edgeId];
+                        const auto other = edge._src == op ? edge._dst : edge._src;
+                        if (fragmentIds[other] == fragment) {
+                            continue;
+                        }
+                        const auto otherDevice = assignment[other];
+                        delta += (static_cast<int>(otherDevice != d) - static_cast<int>(otherDevice != device)) * edge._cost;
+                        if (otherDevice == d) {
+                            mergedFragments.insert(fragmentIds[other]);
+                        }
+                    }
+                }
+                bool merges = !mergedFragments.empty();
+                if (overLimit) {
+                    // the overhead is taken from the subgraphs the move actually leaves after the cycles split
+                    for (auto op : fragments[fragment]) {
+                        assignment[op] = d;
+                    }
+                    const auto movedSubgraphsCount = CountSubgraphs();
+                    for (auto op : fragments[fragment]) {
+                        assignment[op] = device;
+                    }
+                    merges = movedSubgraphsCount < subgraphsCount;
+                    delta -= (static_cast<double>(subgraphsCount) - static_cast<double>(movedSubgraphsCount)) *
+                             subgraphOverhead;
+                } else {
+                    delta -= static_cast<double>(mergedFragments.size()) * subgraphOverhead;
+                }
+                if ((merges || !overLimit) && delta < bestDelta) {
+                    bestFragment = fragment;
+                    bestDevice = d;
+                    bestDelta = delta;
+                    bestMerges = merges;
+                }
+            }
+        }
+        if (!(bestDelta < 0.0 || (overLimit && bestMerges))) {
+            break;
+        }
+        for (auto op : fragments[bestFragment]) {
+            assignment[op] = bestDevice;
+        }
+    }
+    const auto subgraphsCount = CountSubgraphs();
+    if (_maxSubgraphs != 0 && subgraphsCount > _maxSubgraphs) {
+        THROW_IE_EXCEPTION << "HETERO cost model partitioning cannot fit the network into " << _maxSubgraphs
+                           << " subgraphs, the best found partition has " << subgraphsCount << " subgraphs";
+    }
+
+    double cost = static_cast<double>(subgraphsCount) * subgraphOverhead;
+    for (std::size_t op = 0; op < ops.size(); ++op) {
+        cost += computeCosts[op][assignment[op]];
+        affinities[ops[op]->get_friendly_name()] = _devices[assignment[op]]._name;
+    }
+    for (auto&& edge : edges) {
+        if (assignment[edge._src] != assignment[edge._dst]) {
+            cost += edge._cost;
+        }
+    }
+
+    for (auto&& node : orderedOps) {
+        if (IsPartitionedNode(node.get())) {
+            continue;
+        }
+        auto itNeighbour = opIds.find(Neighbour(node));
+        if (itNeighbour != opIds.end()) {
+            affinities[node->get_friendly_name()] = _devices[assignment[itNeighbour->second]]._name;
+        }
+    }
+    return cost;
+}
@@ -0,0 +1,75 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief a header file for the cost model based assignment of the layers to the devices
+ * @file hetero_partitioner.hpp
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ngraph/node.hpp>
+
+namespace HeteroPlugin {
+
+/**
+ * @brief Splits the network into the subgraphs of the connected layers with the same affinity, the subgraphs with
+ * the cyclic dependencies between each other are split further
+ * @param orderedOps The network operations in the topological order
+ * @param affinities The device of every operation
+ * @param subgraphInputs Filled with the inputs of the operations which get the data from another subgraph or from
+ * a Parameter or a Constant
+ * @return The subgraph id of every operation
+ */
+std::unordered_map<ngraph::Node*, int> SplitSubgraphs(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+                                                      const std::unordered_map<ngraph::Node*, std::string>& affinities,
+                                                      std::set<ngraph::Input<ngraph::Node>>& subgraphInputs);
+
+/**
+ * @class HeteroPartitioner
+ * @brief Assigns the layers to the devices minimizing the estimated latency of the network.
+ * The latency is estimated as the sum of the layers costs on the assigned devices, the costs of the data transfers
+ * between the layers on different devices and a fixed overhead of every subgraph. The moves of the layers are chosen
+ * on the connected single-device fragments, the limit of the subgraphs and the overhead of the result are checked on
+ * the subgraphs created by SplitSubgraphs, which also splits the cyclic dependencies of the fragments
+ */
+class HeteroPartitioner {
+public:
+    struct DeviceDesc {
+        std::string                         _name;
+        std::unordered_set<std::string>     _supportedLayers;
+        std::map<std::string, float>        _operationCosts;
+    };
+
+    /**
+     * @param devices The devices in the priority order
+     * @param maxSubgraphs The maximal number of subgraphs, 0 means no limit
+     */
+    HeteroPartitioner(std::vector<DeviceDesc> devices, std::size_t maxSubgraphs);
+
+    /**
+     * @brief Refines the layers to devices assignment by moving whole fragments to the other devices
+     * @param orderedOps The network operations in the topological order
+     * @param affinities The layer name to device name map, the initial assignment on input
+     * @return The estimated cost of the resulting assignment
+     * @throws If the subgraphs cannot be merged down to the maxSubgraphs limit
+     */
+    double Run(const std::vector<std::shared_ptr<ngraph::Node>>& orderedOps,
+               std::map<std::string, std::string>& affinities) const;
+
+private:
+    double OperationCost(const ngraph::Node& node, const DeviceDesc& device) const;
+
+    std::vector<DeviceDesc> _devices;
+    std::size_t             _maxSubgraphs = 0;
+};
+
+}  // namespace HeteroPlugin
@@ -25,6 +25,9 @@ Engine::Engine() {
     _pluginName = "HETERO";
     _config[KEY_EXCLUSIVE_ASYNC_REQUESTS] = YES;
     _config[HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)] = NO;
+    _config[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "0";
+    _config[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_CONFIG_VALUE(PRIORITY);
+    _config[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "0";
 }
 
 namespace {
@@ -111,15 +114,64 @@ Engine::DeviceMetaInformationMap Engine::GetDevicePlugins(const std::string& tar
     return metaDevices;
 }
 
+unsigned int Engine::GetUnsignedConfig(const Configs& config, const std::string& key) {
+    auto it = config.find(key);
+    if (it == config.end()) {
+        return 0;
+    }
+    int value = -1;
+    try {
+        value = std::stoi(it->second);
+    } catch (...) {
+    }
+    if (value < 0) {
+        THROW_IE_EXCEPTION << "Wrong value " << it->second << " for the " << key
+                           << " config, a non-negative integer is expected";
+    }
+    return static_cast<unsigned int>(value);
+}
+
+unsigned int Engine::GetPipelineDepth(const Configs& config) {
+    return GetUnsignedConfig(config, HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+}
+
+unsigned int Engine::GetMaxSubgraphs(const Configs& config) {
+    return GetUnsignedConfig(config, HETERO_CONFIG_KEY(MAX_SUBGRAPHS));
+}
+
+bool Engine::UseCostModelPartitioning(const Configs& config) {
+    auto it = config.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+    if (it == config.end() || it->second == HETERO_CONFIG_VALUE(PRIORITY)) {
+        return false;
+    } else if (it->second == HETERO_CONFIG_VALUE(COST_MODEL)) {
+        return true;
+    } else {
+        THROW_IE_EXCEPTION << "Wrong value " << it->second << " for the " << HETERO_CONFIG_KEY(PARTITIONING_POLICY)
+                           << " config. Supported values are " << HETERO_CONFIG_VALUE(PRIORITY)
+                           << " and " << HETERO_CONFIG_VALUE(COST_MODEL);
+    }
+}
+
+std::map<std::string, float> Engine::GetOperationCosts(const std::string& deviceWithID) const {
+    const auto deviceName = DeviceIDParser(deviceWithID).getDeviceName();
+    std::vector<std::string> supportedMetrics = GetCore()->GetMetric(deviceName, METRIC_KEY(SUPPORTED_METRICS));
+    if (std::find(supportedMetrics.begin(), supportedMetrics.end(), METRIC_KEY(OPERATION_COSTS)) == supportedMetrics.end()) {
+        return {};
+    }
+    return GetCore()->GetMetric(deviceName, METRIC_KEY(OPERATION_COSTS)).as<std::map<std::string, float>>();
+}
+
 void Engine::SetConfig(const Configs &configs) {
+    GetPipelineDepth(configs);
+    GetMaxSubgraphs(configs);
+    UseCostModelPartitioning(configs);
     for (auto&& config : configs) {
         _config[config.first] = config.second;
     }
 }
 
-QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
-    QueryNetworkResult qr;
-
+std::vector<std::pair<std::string, QueryNetworkResult>>
+Engine::QueryNetworkPerDevice(const CNNNetwork &network, const Configs& config) const {
     if (GetCore() == nullptr) {
         THROW_IE_EXCEPTION << "Please, work with HETERO device via InferencEngine::Core object";
     }
@@ -147,8 +199,18 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs
     //  WARNING: Here is devices with user set priority
     auto fallbackDevices = InferenceEngine::DeviceIDParser::getHeteroDevices(fallbackDevicesStr);
 
+    std::vector<std::pair<std::string, QueryNetworkResult>> orderedResults;
     for (auto&& deviceName : fallbackDevices) {
-        for (auto&& layerQueryResult : queryResults[deviceName].supportedLayersMap) {
+        orderedResults.emplace_back(deviceName, queryResults[deviceName]);
+    }
+    return orderedResults;
+}
+
+QueryNetworkResult Engine::QueryNetwork(const CNNNetwork &network, const Configs& config) const {
+    QueryNetworkResult qr;
+
+    for (auto&& queryResult : QueryNetworkPerDevice(network, config)) {
+        for (auto&& layerQueryResult : queryResult.second.supportedLayersMap) {
             qr.supportedLayersMap.emplace(layerQueryResult);
         }
     }
@@ -168,6 +230,9 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
     } else if (METRIC_KEY(SUPPORTED_CONFIG_KEYS) == name) {
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, std::vector<std::string>{
             HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+            HETERO_CONFIG_KEY(PIPELINE_DEPTH),
+            HETERO_CONFIG_KEY(PARTITIONING_POLICY),
+            HETERO_CONFIG_KEY(MAX_SUBGRAPHS),
             "TARGET_FALLBACK",
             CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS),
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)});
@@ -184,6 +249,16 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         IE_ASSERT(it != _config.end());
         bool dump = it->second == YES;
         return { dump };
+    } else if (name == HETERO_CONFIG_KEY(PIPELINE_DEPTH)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PIPELINE_DEPTH));
+        IE_ASSERT(it != _config.end());
+        return { static_cast<int>(GetPipelineDepth(_config)) };
+    } else if (name == HETERO_CONFIG_KEY(PARTITIONING_POLICY)) {
+        auto it = _config.find(HETERO_CONFIG_KEY(PARTITIONING_POLICY));
+        IE_ASSERT(it != _config.end());
+        return { it->second };
+    } else if (name == HETERO_CONFIG_KEY(MAX_SUBGRAPHS)) {
+        return { static_cast<int>(GetMaxSubgraphs(_config)) };
     } else if (name == "TARGET_FALLBACK") {
         auto it = _config.find("TARGET_FALLBACK");
         if (it == _config.end()) {
@@ -42,7 +42,21 @@ public:
     DeviceMetaInformationMap GetDevicePlugins(const std::string& targetFallback,
         const Configs & localConfig) const;
 
+    /**
+     * @brief Queries the network on every device from the TARGET_FALLBACK
+     * @return The query results in the devices priority order
+     */
+    std::vector<std::pair<std::string, InferenceEngine::QueryNetworkResult>>
+    QueryNetworkPerDevice(const InferenceEngine::CNNNetwork &network, const Configs& config) const;
+
+    std::map<std::string, float> GetOperationCosts(const std::string& deviceWithID) const;
+
+    static unsigned int GetPipelineDepth(const Configs& config);
+    static unsigned int GetMaxSubgraphs(const Configs& config);
+    static bool UseCostModelPartitioning(const Configs& config);
+
 private:
     Configs GetSupportedConfig(const Configs& config, const std::string & deviceName) const;
+    static unsigned int GetUnsignedConfig(const Configs& config, const std::string& key);
 };
 }  // namespace HeteroPlugin
@@ -8,6 +8,12 @@
 #include <vector>
 #include <istream>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <list>
+#include <sys/stat.h>
 
 #include <ie_core.hpp>
 #include <multi-device/multi_device_config.hpp>
@@ -23,6 +29,7 @@
 #include "file_utils.h"
 #include "ie_network_reader.hpp"
 #include "xml_parse_utils.h"
+#include "ie_ngraph_utils.hpp"
 
 using namespace InferenceEngine::PluginConfigParams;
 
@@ -93,6 +100,59 @@ void allowNotImplemented(F && f) {
     } catch (const NotImplemented & ex) { }
 }
 
+// FNV-1a hash of the first and the last bytes of the data, a cheap key of the in-memory models in the cache of the
+// read networks. The key is not unique, the cached entries keep the model and the weights to verify a hit
+void hashBytesSample(std::uint64_t& hash, const char* data, std::size_t size) {
+    constexpr std::size_t sampleSize = 4096;
+    auto hashRange = [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            hash ^= static_cast<std::uint8_t>(data[i]);
+            hash *= 0x100000001b3ull;
+        }
+    };
+    if (size <= 2 * sampleSize) {
+        hashRange(0, size);
+    } else {
+        hashRange(0, sampleSize);
+        hashRange(size - sampleSize, size);
+    }
+}
+
+constexpr std::uint64_t hashSeed = 0xcbf29ce484222325ull;
+
+/**
+ * @brief Identifies the file by its path, size and modification time, so the cache of the read networks does not
+ * have to go through the content of the model and the weights on every read. The modification time has nanosecond
+ * resolution where the file system provides it, _stat64 on Windows reports seconds only
+ */
+bool fileIdentity(const std::string& path, std::string& identity) {
+#if defined(ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
+    struct _stat64 info;
+    if (_wstat64(FileUtils::multiByteCharToWString(path.c_str()).c_str(), &info) != 0) {
+        return false;
+    }
+#elif defined(_WIN32)
+    struct _stat64 info;
+    if (_stat64(path.c_str(), &info) != 0) {
+        return false;
+    }
+#else
+    struct stat info;
+    if (stat(path.c_str(), &info) != 0) {
+        return false;
+    }
+#endif
+    identity += path + "|" + std::to_string(static_cast<long long>(info.st_size)) +
+                "|" + std::to_string(static_cast<long long>(info.st_mtime));
+#if defined(__APPLE__)
+    identity += "." + std::to_string(static_cast<long long>(info.st_mtimespec.tv_nsec));
+#elif !defined(_WIN32)
+    identity += "." + std::to_string(static_cast<long long>(info.st_mtim.tv_nsec));
+#endif
+    identity += "|";
+    return true;
+}
+
 }  // namespace
 
 DeviceIDParser::DeviceIDParser(const std::string& deviceNameWithID) {
@@ -157,6 +217,8 @@ class Core::Impl : public ICore {
     ITaskExecutor::Ptr _taskExecutor = nullptr;
 
     mutable std::map<std::string, InferencePlugin> plugins;
+    // to load the plugins of the different devices concurrently
+    mutable std::map<std::string, std::shared_ptr<std::mutex>> pluginLoadMutexes;
 
     struct PluginDescriptor {
         FileUtils::FilePath libraryLocation;
@@ -170,6 +232,79 @@ class Core::Impl : public ICore {
     std::map<std::string, PluginDescriptor> pluginRegistry;
     mutable std::mutex pluginsMutex;  // to lock parallel access to pluginRegistry and plugins
 
+    // the networks read recently, keyed by the identity of the model and the weights files or by the sizes and the
+    // sampled content of the in-memory models; the least recently used network is dropped when the cache is full
+    static constexpr std::size_t readNetworkCacheCapacity = 8;
+    struct ReadNetworkCacheEntry {
+        std::string key;
+        CNNNetwork network;
+        // the in-memory model and weights, compared with the read ones on a hit since their key is not unique
+        std::string model;
+        Blob::CPtr weights;
+    };
+    std::atomic<bool> readNetworkCacheEnabled{false};
+    std::atomic<bool> readNetworkParallel{false};
+    mutable std::list<ReadNetworkCacheEntry> readNetworkCache;
+    mutable std::unordered_map<std::string, std::list<ReadNetworkCacheEntry>::iterator> readNetworkCacheIndex;
+    mutable std::mutex readNetworkCacheMutex;
+
+    void ClearReadNetworkCache() const {
+        std::lock_guard<std::mutex> lock(readNetworkCacheMutex);
+        readNetworkCache.clear();
+        readNetworkCacheIndex.clear();
+    }
+
+    static bool IsSameContent(const ReadNetworkCacheEntry& entry, const std::string& model, const Blob::CPtr& weights) {
+        if (entry.model != model)
+            return false;
+        if (!entry.weights || !weights)
+            return !entry.weights && !weights;
+        if (entry.weights->byteSize() != weights->byteSize())
+            return false;
+        auto cachedData = entry.weights->cbuffer().as<const char*>();
+        auto data = weights->cbuffer().as<const char*>();
+        return cachedData == data || std::memcmp(cachedData, data, weights->byteSize()) == 0;
+    }
+
+    /**
+     * @brief Returns a copy of the cached network or reads and caches a new one.
+     * The copies share the Constant data buffers with the cached network, only the graph structure is copied
+     * @param model The in-memory model compared with the cached one on a hit, empty for the model files
+     * @param weights The in-memory weights compared with the cached ones on a hit
+     */
+    template <typename Reader>
+    CNNNetwork ReadNetworkCached(const std::string& key, const Reader& read,
+                                 const std::string& model = {}, const Blob::CPtr& weights = nullptr) const {
+        {
+            std::lock_guard<std::mutex> lock(readNetworkCacheMutex);
+            auto it = readNetworkCacheIndex.find(key);
+            if (it != readNetworkCacheIndex.end() && IsSameContent(*it->second, model, weights)) {
+                readNetworkCache.splice(readNetworkCache.begin(), readNetworkCache, it->second);
+                return details::cloneNetwork(it->second->network);
+            }
+        }
+        auto network = read();
+        if (network.getFunction() == nullptr) {
+            return network;
+        }
+        {
+            std::lock_guard<std::mutex> lock(readNetworkCacheMutex);
+            // an entry with the same key and another content is replaced by the network read last
+            auto it = readNetworkCacheIndex.find(key);
+            if (it != readNetworkCacheIndex.end()) {
+                readNetworkCache.erase(it->second);
+                readNetworkCacheIndex.erase(it);
+            }
+            readNetworkCache.push_front({key, network, model, weights});
+            readNetworkCacheIndex.emplace(key, readNetworkCache.begin());
+            if (readNetworkCache.size() > readNetworkCacheCapacity) {
+                readNetworkCacheIndex.erase(readNetworkCache.back().key);
+                readNetworkCache.pop_back();
+            }
+        }
+        return details::cloneNetwork(network);
+    }
+
 public:
     Impl();
     ~Impl() override;
@@ -251,12 +386,76 @@ public:
 
     CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPED_TASK(itt::domains::IE);
-        return details::ReadNetwork(modelPath, binPath, extensions);
+        auto read = [&] {
+            return details::ReadNetwork(modelPath, binPath, extensions, readNetworkParallel);
+        };
+        if (!readNetworkCacheEnabled) {
+            return read();
+        }
+
+        std::string key;
+        if (!fileIdentity(modelPath, key)) {
+            // let the reader report the error
+            return read();
+        }
+        auto weightsPath = binPath;
+        if (weightsPath.empty()) {
+            weightsPath = modelPath.substr(0, modelPath.rfind('.')) + ".bin";
+        }
+        fileIdentity(weightsPath, key);
+        return ReadNetworkCached(key + binPath, read);
     }
 
     CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights) const override {
         OV_ITT_SCOPED_TASK(itt::domains::IE, "Core::Impl::ReadNetwork");
-        return details::ReadNetwork(model, weights, extensions);
+        auto read = [&] {
+            return details::ReadNetwork(model, weights, extensions, readNetworkParallel);
+        };
+        if (!readNetworkCacheEnabled) {
+            return read();
+        }
+
+        std::uint64_t hash = hashSeed;
+        hashBytesSample(hash, model.data(), model.size());
+        std::size_t weightsSize = 0;
+        if (weights) {
+            weightsSize = weights->byteSize();
+            hashBytesSample(hash, weights->cbuffer().as<const char*>(), weightsSize);
+        }
+        auto key = "memory|" + std::to_string(model.size()) + "|" + std::to_string(weightsSize) + "|" +
+                   std::to_string(hash);
+        return ReadNetworkCached(key, read, model, weights);
+    }
+
+    /**
+     * @brief Enables or disables the cache of the read networks, disabling drops the cached networks
+     * @param value The YES or NO value of the READ_NETWORK_CACHE config key
+     */
+    void SetReadNetworkCache(const std::string& value) {
+        if (value == CONFIG_VALUE(YES)) {
+            readNetworkCacheEnabled = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            readNetworkCacheEnabled = false;
+            ClearReadNetworkCache();
+        } else {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << CONFIG_KEY(READ_NETWORK_CACHE)
+                               << ". Expected only YES or NO";
+        }
+    }
+
+    /**
+     * @brief Enables or disables the concurrent parsing of the model layers by the readers
+     * @param value The YES or NO value of the READ_NETWORK_PARALLEL config key
+     */
+    void SetReadNetworkParallel(const std::string& value) {
+        if (value == CONFIG_VALUE(YES)) {
+            readNetworkParallel = true;
+        } else if (value == CONFIG_VALUE(NO)) {
+            readNetworkParallel = false;
+        } else {
+            THROW_IE_EXCEPTION << "Wrong value " << value << " for property key " << CONFIG_KEY(READ_NETWORK_PARALLEL)
+                               << ". Expected only YES or NO";
+        }
     }
 
     ExecutableNetwork LoadNetwork(const CNNNetwork& network, const std::string& deviceName,
@@ -346,59 +545,100 @@ public:
     InferencePlugin GetCPPPluginByName(const std::string& deviceName) const {
         OV_ITT_SCOPED_TASK(itt::domains::IE_LT, "Core::Impl::GetCPPPluginByName");
 
-        std::lock_guard<std::mutex> lock(pluginsMutex);
+        std::shared_ptr<std::mutex> pluginLoadMutex;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
 
-        auto it = pluginRegistry.find(deviceName);
-        if (it == pluginRegistry.end()) {
-            THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            auto it = pluginRegistry.find(deviceName);
+            if (it == pluginRegistry.end()) {
+                THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+
+            auto itPlugin = plugins.find(deviceName);
+            if (itPlugin != plugins.end()) {
+                return itPlugin->second;
+            }
+
+            auto& loadMutex = pluginLoadMutexes[deviceName];
+            if (loadMutex == nullptr) {
+                loadMutex = std::make_shared<std::mutex>();
+            }
+            pluginLoadMutex = loadMutex;
         }
 
-        // Plugin is in registry, but not created, let's create
+        // Plugin is in registry, but not created, let's create.
+        // Only the loads of the same device are serialized, the different plugins are loaded concurrently
+        std::lock_guard<std::mutex> loadLock(*pluginLoadMutex);
+
+        PluginDescriptor desc;
+        std::vector<IExtensionPtr> loadExtensions;
+        {
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            auto itPlugin = plugins.find(deviceName);
+            if (itPlugin != plugins.end()) {
+                return itPlugin->second;
+            }
+            auto it = pluginRegistry.find(deviceName);
+            if (it == pluginRegistry.end()) {
+                THROW_IE_EXCEPTION << "Device with \"" << deviceName << "\" name is not registered in the InferenceEngine";
+            }
+            desc = it->second;
+            loadExtensions = extensions;
+        }
 
-        if (plugins.find(deviceName) == plugins.end()) {
-            PluginDescriptor desc = it->second;
+        try {
+            InferencePlugin plugin(desc.libraryLocation);
 
-            try {
-                InferencePlugin plugin(desc.libraryLocation);
+            {
+                plugin.SetName(deviceName);
 
-                {
-                    plugin.SetName(deviceName);
+                // Set Inference Engine class reference to plugins
+                ICore* mutableCore = const_cast<ICore*>(static_cast<const ICore*>(this));
+                plugin.SetCore(mutableCore);
+            }
 
-                    // Set Inference Engine class reference to plugins
-                    ICore* mutableCore = const_cast<ICore*>(static_cast<const ICore*>(this));
-                    plugin.SetCore(mutableCore);
+            // Add registered extensions to new plugin
+            allowNotImplemented([&](){
+                for (const auto& ext : loadExtensions) {
+                    plugin.AddExtension(ext);
                 }
+            });
 
-                // Add registered extensions to new plugin
-                allowNotImplemented([&](){
-                    for (const auto& ext : extensions) {
-                        plugin.AddExtension(ext);
+            // configuring
+            {
+                allowNotImplemented([&]() {
+                    plugin.SetConfig(desc.defaultConfig);
+                });
+
+                allowNotImplemented([&]() {
+                    for (auto&& extensionLocation : desc.listOfExtentions) {
+                        plugin.AddExtension(make_so_pointer<IExtension>(extensionLocation));
                     }
                 });
+            }
 
-                // configuring
-                {
-                    allowNotImplemented([&]() {
-                        plugin.SetConfig(desc.defaultConfig);
-                    });
-
-                    allowNotImplemented([&]() {
-                        for (auto&& extensionLocation : desc.listOfExtentions) {
-                            plugin.AddExtension(make_so_pointer<IExtension>(extensionLocation));
-                        }
-                    });
+            std::lock_guard<std::mutex> lock(pluginsMutex);
+            // catch up with the extensions and the config that were set while the plugin was loading
+            allowNotImplemented([&]() {
+                for (auto ext = extensions.begin() + loadExtensions.size(); ext != extensions.end(); ++ext) {
+                    plugin.AddExtension(*ext);
                 }
-
-                plugins[deviceName] = plugin;
-            } catch (const details::InferenceEngineException& ex) {
-                THROW_IE_EXCEPTION << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
-                                   << "\n"
-                                   << "Please, check your environment\n"
-                                   << ex.what() << "\n";
+            });
+            auto it = pluginRegistry.find(deviceName);
+            if (it != pluginRegistry.end() && it->second.defaultConfig != desc.defaultConfig) {
+                allowNotImplemented([&]() {
+                    plugin.SetConfig(it->second.defaultConfig);
+                });
             }
-        }
 
-        return plugins[deviceName];
+            plugins[deviceName] = plugin;
+            return plugin;
+        } catch (const details::InferenceEngineException& ex) {
+            THROW_IE_EXCEPTION << "Failed to create plugin " << FileUtils::fromFilePath(desc.libraryLocation) << " for device " << deviceName
+                               << "\n"
+                               << "Please, check your environment\n"
+                               << ex.what() << "\n";
+        }
     }
 
     /**
@@ -413,6 +653,7 @@ public:
         }
 
         plugins.erase(deviceName);
+        pluginLoadMutexes.erase(deviceName);
     }
 
     /**
@@ -503,14 +744,19 @@ public:
         for (const auto& it : opsets) {
             if (opsetNames.find(it.first) != opsetNames.end())
                 THROW_IE_EXCEPTION << "Cannot add opset with name: " << it.first << ". Opset with the same name already exists.";
-            opsetNames.insert(it.first);
         }
 
-        // add extensions for already created plugins
+        // the extensions change the way the networks are read
+        ClearReadNetworkCache();
+
+        // add extensions for already created plugins, the plugins without the extensions support are skipped
         for (auto& plugin : plugins) {
-            try {
+            allowNotImplemented([&]() {
                 plugin.second.AddExtension(extension);
-            } catch (...) {}
+            });
+        }
+        for (const auto& it : opsets) {
+            opsetNames.insert(it.first);
         }
         extensions.emplace_back(extension);
     }
@@ -714,7 +960,19 @@ void Core::SetConfig(const std::map<std::string, std::string>& config, const std
     }
 
     if (deviceName.empty()) {
-        _impl->SetConfigForPlugins(config, std::string());
+        // the Core own settings are not passed to the plugins
+        auto pluginsConfig = config;
+        auto readNetworkCache = pluginsConfig.find(CONFIG_KEY(READ_NETWORK_CACHE));
+        if (readNetworkCache != pluginsConfig.end()) {
+            _impl->SetReadNetworkCache(readNetworkCache->second);
+            pluginsConfig.erase(readNetworkCache);
+        }
+        auto readNetworkParallel = pluginsConfig.find(CONFIG_KEY(READ_NETWORK_PARALLEL));
+        if (readNetworkParallel != pluginsConfig.end()) {
+            _impl->SetReadNetworkParallel(readNetworkParallel->second);
+            pluginsConfig.erase(readNetworkParallel);
+        }
+        _impl->SetConfigForPlugins(pluginsConfig, std::string());
     } else {
         auto parsed = parseDeviceNameIntoConfig(deviceName, config);
         _impl->SetConfigForPlugins(parsed._config, parsed._deviceName);
@@ -33,6 +33,11 @@ public:
 
 }  // namespace details
 
+int ParallelReadStreamIndex() {
+    static const int index = std::ios_base::xalloc();
+    return index;
+}
+
 /**
  * @brief This class is a wrapper for reader interfaces
  */
@@ -130,6 +135,11 @@ void registerReaders() {
     if (irReaderv7)
         readers.emplace("xml", irReaderv7);
 
+    // try to load binary IR reader if library exists
+    auto irBinaryReader = create_if_exists("IRBinary", std::string("inference_engine_ir_binary_reader") + std::string(IE_BUILD_POSTFIX));
+    if (irBinaryReader)
+        readers.emplace("irb", irBinaryReader);
+
     initialized = true;
 }
 
@@ -154,7 +164,8 @@ void assertIfIRv7LikeModel(std::istream & modelStream) {
 
 }  // namespace
 
-CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                                bool parallel) {
     OV_ITT_SCOPED_TASK(itt::domains::IE, "details::ReadNetwork");
     // Register readers if it is needed
     registerReaders();
@@ -173,6 +184,7 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
     modelStream.pword(0) = const_cast<char*>(path_to_save_in_stream.c_str());
     if (!modelStream.is_open())
         THROW_IE_EXCEPTION << "Model file " << modelPath << " cannot be opened!";
+    modelStream.iword(ParallelReadStreamIndex()) = parallel;
 
     assertIfIRv7LikeModel(modelStream);
 
@@ -233,11 +245,13 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath, const std::string&
         ". Please check that reader library exists in your PATH.";
 }
 
-CNNNetwork details::ReadNetwork(const std::string& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) {
+CNNNetwork details::ReadNetwork(const std::string& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts,
+                                bool parallel) {
     OV_ITT_SCOPED_TASK(itt::domains::IE, "details::ReadNetwork");
     // Register readers if it is needed
     registerReaders();
     std::istringstream modelStream(model);
+    modelStream.iword(ParallelReadStreamIndex()) = parallel;
 
     assertIfIRv7LikeModel(modelStream);
 
@@ -18,20 +18,24 @@ namespace details {
  * @param binPath path to bin file, if path is empty, will try to read bin file with the same name as xml and
  * if bin file with the same name was not found, will load IR without weights.
  * @param exts vector with extensions
+ * @param parallel allows the reader to parse the model layers concurrently
  * @return CNNNetwork
  */
-CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts);
+CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath, const std::vector<IExtensionPtr>& exts,
+                       bool parallel = false);
 /**
  * @brief Reads IR xml and bin (with the same name) files
  * @param model string with IR
  * @param weights shared pointer to constant blob with weights
  * @param exts vector with extensions
+ * @param parallel allows the reader to parse the model layers concurrently
  * @note Reading ONNX models doesn't support loading weights from data blobs.
          If you are using an ONNX model with external data files, please use the
          ReadNetwork function overload which takes a filesystem path to the model.
  * @return CNNNetwork
  */
-CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts);
+CNNNetwork ReadNetwork(const std::string& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts,
+                       bool parallel = false);
 
 }  // namespace details
 }  // namespace InferenceEngine
@@ -89,6 +89,28 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 lpTransformsMode = LPTransformsMode::On;
             else
                 THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE;
+        } else if (key == PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT) {
+            if (val == PluginConfigParams::YES)
+                layoutAssignment = true;
+            else if (val == PluginConfigParams::NO)
+                layoutAssignment = false;
+            else
+                THROW_IE_EXCEPTION << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT
+                                   << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_RNN_BATCH_LIMIT ||
+                   key == PluginConfigInternalParams::KEY_CPU_RNN_BATCH_TIMEOUT) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only integer numbers";
+            }
+            if (val_i < 0)
+                THROW_IE_EXCEPTION << "Wrong value for property key " << key << ". Expected only non negative numbers";
+            if (key == PluginConfigInternalParams::KEY_CPU_RNN_BATCH_LIMIT)
+                rnnBatchLimit = val_i;
+            else
+                rnnBatchTimeout = val_i;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_DOT) == 0) {
             dumpQuantizedGraphToDot = val;
         } else if (key.compare(PluginConfigParams::KEY_DUMP_QUANTIZED_GRAPH_AS_IR) == 0) {
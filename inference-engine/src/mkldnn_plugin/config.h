@@ -21,10 +21,13 @@ struct Config {
     bool collectPerfCounters = false;
     bool exclusiveAsyncRequests = false;
     bool enableDynamicBatch = false;
+    bool layoutAssignment = false;
     std::string dumpToDot = "";
     std::string dumpQuantizedGraphToDot = "";
     std::string dumpQuantizedGraphToIr = "";
     int batchLimit = 0;
+    int rnnBatchLimit = 0;
+    int rnnBatchTimeout = 100;  // us
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
 
 #if defined(__arm__) || defined(__aarch64__)
@@ -12,6 +12,8 @@
 #include "mkldnn_memory_state.h"
 #include "mkldnn_itt.h"
 #include "nodes/mkldnn_memory_node.hpp"
+#include "nodes/mkldnn_rnn.h"
+#include "utils/general_utils.h"
 #include <legacy/ie_util_internal.hpp>
 #include <legacy/graph_tools.hpp>
 #include <threading/ie_executor_manager.hpp>
@@ -256,6 +258,10 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
         }
 
         graph->CreateGraph(localNetwork, extensionManager, numaNodesWeights[numaNode]);
+
+        // Batch 1 RNN calls of concurrent requests are gathered only if they can run in different streams
+        if (_cfg.rnnBatchLimit > 1 && _cfg.streamExecutorConfig._streams > 1)
+            setRNNBatchers(*graph, numaNode);
         return graph;
     }};
 
@@ -282,6 +288,24 @@ MKLDNNExecNetwork::MKLDNNExecNetwork(const InferenceEngine::CNNNetwork &network,
     }
 }
 
+void MKLDNNExecNetwork::setRNNBatchers(MKLDNNGraph &graph, int numaNode) {
+    std::lock_guard<std::mutex> lock{_rnnBatchersMutex};
+    for (auto &node : graph.GetNodes()) {
+        if (!one_of(node->getType(), RNNCell, RNNSeq))
+            continue;
+
+        auto rnnNode = dynamic_cast<MKLDNNRNN*>(node.get());
+        if (rnnNode == nullptr || !rnnNode->canBeBatched())
+            continue;
+
+        // Graphs of the streams are identical, so the layer name identifies the same RNN in all of them
+        auto &batcher = _rnnBatchers[{numaNode, node->getName()}];
+        if (!batcher)
+            batcher = std::make_shared<RNNBatcher>(_cfg.rnnBatchLimit, std::chrono::microseconds(_cfg.rnnBatchTimeout));
+        rnnNode->setBatcher(batcher);
+    }
+}
+
 void MKLDNNExecNetwork::setProperty(const std::map<std::string, std::string> &properties) {
     {
         std::lock_guard<std::mutex> lock{_cfgMutex};
@@ -8,6 +8,7 @@
 
 #include "mkldnn_graph.h"
 #include "mkldnn_extension_mngr.h"
+#include "nodes/common/rnn_batcher.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -56,9 +57,13 @@ protected:
     Config                                      _cfg;
     std::atomic_int                             _numRequests = {0};
     std::string                                 _name;
+    std::mutex                                  _rnnBatchersMutex;
+    std::map<std::pair<int, std::string>, RNNBatcher::Ptr> _rnnBatchers;  // by NUMA node and layer name
 
 
     bool CanProcessDynBatch(const InferenceEngine::CNNNetwork &network) const;
+
+    void setRNNBatchers(MKLDNNGraph &graph, int numaNode);
 };
 
 }  // namespace MKLDNNPlugin
@@ -340,6 +340,9 @@ void MKLDNNGraph::InitGraph() {
 
     InitDescriptors();
 
+    if (config.layoutAssignment)
+        optimizer.ApplyLayoutAssignment(*this);
+
     InitOptimalPrimitiveDescriptors();
 
     InitEdges();
@@ -755,7 +758,7 @@ void MKLDNNGraph::CreatePrimitives() {
     }
 }
 
-void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
+void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean) {
     if (!IsReady()) THROW_IE_EXCEPTION<< "Wrong state. Topology not ready.";
 
     auto input = inputNodes.find(name);
@@ -775,7 +778,7 @@ void MKLDNNGraph::PushInputData(const std::string& name, const InferenceEngine::
         }
 
         // todo: make sure 'name' exists in this map...
-        if (_meanImages.find(name) != _meanImages.end()) {
+        if (subtractMean && _meanImages.find(name) != _meanImages.end()) {
             if (in->getTensorDesc().getPrecision() == InferenceEngine::Precision::FP32) {
                 _meanImages[name].Subtract(outDims, reinterpret_cast<float *>(inter_data_ptr), in->getTensorDesc().getLayout());
             } else {
@@ -56,7 +56,7 @@ public:
         return _meanImages.find(name) != _meanImages.end();
     }
 
-    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in);
+    void PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in, bool subtractMean = true);
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(MKLDNNInferRequest* request = nullptr, int batch = -1);
@@ -13,10 +13,9 @@
 #include "nodes/mkldnn_conv_node.h"
 #include "nodes/mkldnn_bin_conv_node.h"
 #include "nodes/mkldnn_quantize_node.h"
-#include "nodes/mkldnn_mvn_node.h"
 #include <nodes/mkldnn_permute_node.h>
-#include "nodes/mkldnn_interpolate_node.h"
 #include "nodes/mkldnn_input_node.h"
+#include "nodes/mkldnn_rnn.h"
 
 #include "mkldnn/ie_mkldnn.h"
 
@@ -39,6 +38,7 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <unordered_set>
 #include <algorithm>
 
 #include "mkldnn_itt.h"
@@ -64,6 +64,9 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseScaleShiftAndQuantize(graph);
     graph.RemoveDroppedNodes();
 
+    FuseQuantizeAndRNN(graph);
+    graph.RemoveDroppedNodes();
+
     MergeGroupConvolution(graph);
     graph.RemoveDroppedNodes();
 
@@ -115,13 +118,7 @@ void MKLDNNGraphOptimizer::ApplyCommonGraphOptimizations(MKLDNNGraph &graph) {
     FuseFullyConnectedAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
-    FuseMVNAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseInterpolateAndSimpleOperation(graph);
-    graph.RemoveDroppedNodes();
-
-    FuseNormalizeAndSimpleOperation(graph);
+    FuseNodeAndSimpleOperations(graph);
     graph.RemoveDroppedNodes();
 
     FuseEltwiseAndSimple(graph);
@@ -148,6 +145,142 @@ void MKLDNNGraphOptimizer::ApplyImplSpecificGraphOptimizations(MKLDNNGraph &grap
     graph.RemoveDroppedEdges();
 }
 
+// The nodes select their primitive descriptors one by one in the topological order, matching the formats of the
+// parents only, so a choice is never revised when it forces reorders to the children. Here the formats are assigned
+// over the whole graph: the cost of an edge is the amount of bytes its reorder would move, and every node takes the
+// descriptor of the already selected implementation type that minimizes the cost of all its input and output edges,
+// while the other nodes keep theirs. A node changes the descriptor only when the cost strictly decreases, so the total
+// cost of the graph decreases monotonically and the forward and backward sweeps converge in a few iterations.
+void MKLDNNGraphOptimizer::ApplyLayoutAssignment(MKLDNNGraph &graph) {
+    OV_ITT_SCOPED_TASK(itt::domains::MKLDNN_LT, "MKLDNNGraphOptimizer::ApplyLayoutAssignment");
+
+    auto& graphNodes = graph.GetNodes();
+
+    // these nodes either have their formats bound to the user blobs or select the descriptors with in-place rules
+    auto isAssignable = [](const MKLDNNNodePtr& node) {
+        switch (node->getType()) {
+            case Input:
+            case Output:
+            case MemoryInput:
+            case MemoryOutput:
+            case Reorder:
+            case Split:
+            case Concatenation:
+            case TensorIterator:
+                return false;
+            default:
+                return node->getSelectedPrimitiveDescriptor() != nullptr && node->getSupportedPrimitiveDescriptors().size() > 1;
+        }
+    };
+
+    auto reorderCost = [](const TensorDesc& src, const TensorDesc& dst) -> size_t {
+        if (MKLDNNExtensionUtils::initTensorsAreEqual(src, dst))
+            return 0;
+        size_t size = std::max(src.getPrecision().size(), dst.getPrecision().size());
+        for (auto dim : src.getDims())
+            size *= dim;
+        return size;
+    };
+
+    auto getCost = [&](const MKLDNNNodePtr& node, const InferenceEngine::LayerConfig& config) -> size_t {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size() && i < config.inConfs.size(); i++) {
+            auto parentEdge = node->getParentEdgeAt(i);
+            auto parent = parentEdge->getParent();
+            auto parentSpd = parent->getSelectedPrimitiveDescriptor();
+            // reorders of the constant inputs are executed once on the network loading
+            if (parent->isConstant() || parentSpd == nullptr || parentSpd->getConfig().outConfs.empty())
+                continue;
+            int inNum = parentEdge->getInputNum();
+            if (inNum < 0 || inNum >= parentSpd->getConfig().outConfs.size())
+                inNum = 0;
+            cost += reorderCost(parentSpd->getConfig().outConfs[inNum].desc, config.inConfs[i].desc);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto childEdge = node->getChildEdgeAt(i);
+            auto childSpd = childEdge->getChild()->getSelectedPrimitiveDescriptor();
+            int outNum = childEdge->getInputNum();
+            int childInNum = childEdge->getOutputNum();
+            if (childSpd == nullptr || outNum < 0 || outNum >= config.outConfs.size() ||
+                    childInNum < 0 || childInNum >= childSpd->getConfig().inConfs.size())
+                continue;
+            cost += reorderCost(config.outConfs[outNum].desc, childSpd->getConfig().inConfs[childInNum].desc);
+        }
+        return cost;
+    };
+
+    auto hasSameInPlace = [](const InferenceEngine::LayerConfig& config1, const InferenceEngine::LayerConfig& config2) {
+        if (config1.inConfs.size() != config2.inConfs.size() || config1.outConfs.size() != config2.outConfs.size())
+            return false;
+        for (size_t i = 0; i < config1.inConfs.size(); i++) {
+            if (config1.inConfs[i].inPlace != config2.inConfs[i].inPlace)
+                return false;
+        }
+        for (size_t i = 0; i < config1.outConfs.size(); i++) {
+            if (config1.outConfs[i].inPlace != config2.outConfs[i].inPlace)
+                return false;
+        }
+        return true;
+    };
+
+    // a descriptor with other precisions would change the computation of the node, not only its layout
+    auto hasSamePrecisions = [](const InferenceEngine::LayerConfig& config1, const InferenceEngine::LayerConfig& config2) {
+        if (config1.inConfs.size() != config2.inConfs.size() || config1.outConfs.size() != config2.outConfs.size())
+            return false;
+        for (size_t i = 0; i < config1.inConfs.size(); i++) {
+            if (config1.inConfs[i].desc.getPrecision() != config2.inConfs[i].desc.getPrecision())
+                return false;
+        }
+        for (size_t i = 0; i < config1.outConfs.size(); i++) {
+            if (config1.outConfs[i].desc.getPrecision() != config2.outConfs[i].desc.getPrecision())
+                return false;
+        }
+        return true;
+    };
+
+    auto assignLayout = [&](const MKLDNNNodePtr& node) {
+        if (!isAssignable(node))
+            return false;
+
+        const auto& supportedPds = node->getSupportedPrimitiveDescriptors();
+        const auto* selectedPd = node->getSelectedPrimitiveDescriptor();
+        const auto& selectedConfig = selectedPd->getConfig();
+        size_t bestCost = getCost(node, selectedConfig);
+        int bestIndex = -1;
+        for (size_t i = 0; i < supportedPds.size() && bestCost > 0; i++) {
+            const auto& config = supportedPds[i].getConfig();
+            if (&supportedPds[i] == selectedPd ||
+                    supportedPds[i].getImplementationType() != selectedPd->getImplementationType() ||
+                    config.inConfs.size() > node->getParentEdges().size() ||
+                    !hasSameInPlace(config, selectedConfig) ||
+                    !hasSamePrecisions(config, selectedConfig))
+                continue;
+
+            size_t cost = getCost(node, config);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestIndex = static_cast<int>(i);
+            }
+        }
+
+        if (bestIndex < 0)
+            return false;
+        node->selectPrimitiveDescriptorByIndex(bestIndex);
+        return true;
+    };
+
+    const int maxSweeps = 8;
+    for (int sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (auto it = graphNodes.begin(); it != graphNodes.end(); ++it)
+            changed |= assignLayout(*it);
+        for (auto it = graphNodes.rbegin(); it != graphNodes.rend(); ++it)
+            changed |= assignLayout(*it);
+        if (!changed)
+            break;
+    }
+}
+
 void MKLDNNGraphOptimizer::FuseConvolutionAndZeroPoints(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1351,89 +1484,17 @@ void MKLDNNGraphOptimizer::FuseConvolutionSumAndConvolutionSumActivation(MKLDNNG
     }
 }
 
-void MKLDNNGraphOptimizer::FuseMVNAndSimpleOperation(MKLDNNGraph &graph) {
+void MKLDNNGraphOptimizer::FuseNodeAndSimpleOperations(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableMVN = (node->getType() == MVN) && (node->inDims[0].ndims() == 4 || node->inDims[0].ndims() == 5);
-
-        if (isSutableMVN) {
-            auto *mvnLayer = dynamic_cast<MVNLayer *>(node->getCnnLayer().get());
-            if (mvnLayer == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get MVN layer " << node->getName();
-
-            return node->getChildEdges().size() == 1 && mvnLayer->across_channels == 0 && mvnLayer->normalize == 1;
-        } else {
-            return false;
-        }
+        return node->getChildEdges().size() == 1;
     };
 
-    auto isSutableChildNode = [](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Eltwise) {
-            auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get eltwise node " << node->getName();
-
-            return ((eltwiseNode->getOpType() == MulAdd) ||
-                    (eltwiseNode->getOpType() == Prelu) ||
-                     eltwiseNode->getOpType() == Relu);
-        }
-
-        return false;
-    };
-
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
-
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == MVN)
-                    continue;
-
-                removeEdge(graph, p_edge);
-            }
-        }
-
-        graph.DropNode(childNode);
-    }
-}
-
-void MKLDNNGraphOptimizer::FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
-
-    auto isSuitableParentNode = [](MKLDNNNodePtr node) {
-        bool isSuitable = (node->getType() == Interpolate);
-        if (isSuitable) {
-            return node->getChildEdges().size() == 1;
-        } else {
+    auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
+        if (!childNode->getCnnLayer() || !childNode->getFusedWith().empty())
             return false;
-        }
-    };
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
         // Avoid cycle dependencies
         for (auto &childParentEdge : childNode->getParentEdges()) {
             for (auto &parentParentEdge : parentNode->getParentEdges()) {
@@ -1441,16 +1502,15 @@ void MKLDNNGraphOptimizer::FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph)
                     return false;
             }
         }
-        if (!childNode->getFusedWith().empty())
-            return false;
-        auto interpolateNode = dynamic_cast<MKLDNNInterpolateNode*>(parentNode.get());
-        return interpolateNode->canFuse(childNode);
+
+        return parentNode->canFuseSimpleOperation(childNode);
     };
 
+    // the parent is checked again after a fusion, so a whole chain of simple operations is fused into it
     auto parent = graphNodes.begin();
     while (parent != graphNodes.end()) {
         auto parentNode = *parent;
-        if (!isSuitableParentNode(parentNode)) {
+        if (!isSutableParentNode(parentNode)) {
             parent++;
             continue;
         }
@@ -1463,203 +1523,193 @@ void MKLDNNGraphOptimizer::FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph)
 
         parentNode->fuseWith(childNode);
 
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Interpolate)
-                    continue;
+        auto parentEdges = childNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getParent() == parentNode)
+                continue;
 
-                removeEdge(graph, p_edge);
-            }
+            removeEdge(graph, p_edge);
         }
 
         graph.DropNode(childNode);
     }
 }
 
-void MKLDNNGraphOptimizer::FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph) {
+void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
     auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        bool isSutableNormalize = node->getType() == Normalize;
-
-        if (isSutableNormalize) {
-            return node->getChildEdges().size() == 1;
-        } else {
-            return false;
-        }
+        return node->getType() == Eltwise && !node->getChildEdges().empty() && node->getFusedWith().empty();
     };
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr node) {
-        if (!node->getCnnLayer())
-            return false;
-
-        if (node->getType() == Quantize) {
-            auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
-            if (quantizeNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-            return !quantizeNode->isBinarization();
-        } else if (node->getType() == Eltwise) {
-            auto *eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
-            if (eltwiseNode == nullptr)
-                THROW_IE_EXCEPTION << "Cannot get Eltwise node " << node->getName();
-            return IsOneOf(eltwiseNode->getOpType(), {Relu, Gelu, Elu, Logistic, BoundedRelu, Clamp, Tanh, Swish,
-                                                      Hswish, Mish, Hsigmoid, Round, Linear, Abs, Square, Sqrt}) ||
-                    ((eltwiseNode->getOpType() == MulAdd && eltwiseNode->getCnnLayer()->blobs.size() == 2) ||
-                     (eltwiseNode->getOpType() == Prelu));
+    // Avoid cycle dependencies: an external input of the subgraph must not be computed from its results. Every node of
+    // the subgraph is reachable from its head, so the check is a lookup in the set of the head descendants.
+    auto collectDescendants = [](const MKLDNNNodePtr& node) {
+        std::unordered_set<MKLDNNNode*> descendants;
+        std::vector<MKLDNNNode*> nodesToVisit = {node.get()};
+        while (!nodesToVisit.empty()) {
+            auto current = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            for (size_t i = 0; i < current->getChildEdges().size(); i++) {
+                auto child = current->getChildEdgeAt(i)->getChild().get();
+                if (descendants.insert(child).second)
+                    nodesToVisit.push_back(child);
+            }
         }
-
-        return false;
+        return descendants;
     };
 
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
-
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(childNode)) {
-            parent++;
+    // Tokenizer: starting from an Eltwise node it greedily collects the Eltwise and Quantize nodes whose operands are
+    // the results of the already collected ones or independent external inputs, so the subgraph may be any single
+    // output DAG (e.g. x * sigmoid(x) or (x + b) * sigmoid(x + b)) rather than a linear chain only. The subgraph is
+    // fused up to its longest prefix which has no intermediate results consumed outside, and it's computed by
+    // a single Eltwise JIT kernel keeping the intermediate results in vector registers.
+    for (auto& headNode : graphNodes) {
+        if (!isSutableParentNode(headNode))
             continue;
-        }
 
-        parentNode->fuseWith(childNode);
+        auto eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(headNode.get());
+
+        std::vector<MKLDNNNodePtr> subgraph = {headNode};
+        std::vector<std::vector<int>> subgraphInputs;
+        // External inputs of the fused node as (parent node, parent output port) in the input ports order
+        std::vector<std::pair<MKLDNNNode*, int>> inputs;
+        for (size_t i = 0; i < headNode->getParentEdges().size(); i++) {
+            auto parentEdge = headNode->getParentEdgesAtPort(i)[0];
+            inputs.emplace_back(parentEdge->getParent().get(), parentEdge->getInputNum());
+        }
+        std::set<int> savedResults;
+        size_t fusedNum = 0;
+        // The graph is not changed until the subgraph is fused, so the reachability is computed once for the head
+        std::unordered_set<MKLDNNNode*> headDescendants;
+        bool isHeadDescendantsCollected = false;
+        auto dependsOnSubgraph = [&](const MKLDNNNodePtr& node) {
+            if (!isHeadDescendantsCollected) {
+                headDescendants = collectDescendants(headNode);
+                isHeadDescendantsCollected = true;
+            }
+            return headDescendants.count(node.get()) != 0;
+        };
+
+        auto isSubgraphClosed = [&]() {
+            for (size_t i = 0; i < subgraph.size() - 1; i++) {
+                for (size_t j = 0; j < subgraph[i]->getChildEdges().size(); j++) {
+                    auto child = subgraph[i]->getChildEdgeAt(j)->getChild();
+                    if (std::find(subgraph.begin(), subgraph.end(), child) == subgraph.end())
+                        return false;
+                }
+            }
+            return true;
+        };
 
-        if (childNode->getType() == Quantize || childNode->getType() == Eltwise) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Normalize)
-                    continue;
+        bool isCandidateFound = true;
+        while (isCandidateFound) {
+            isCandidateFound = false;
 
-                removeEdge(graph, p_edge);
-            }
-        }
+            // Continuation of the last operation is preferred to keep the previous result in place
+            for (int k = subgraph.size() - 1; k >= 0 && !isCandidateFound; k--) {
+                for (size_t i = 0; i < subgraph[k]->getChildEdges().size() && !isCandidateFound; i++) {
+                    auto childNode = subgraph[k]->getChildEdgeAt(i)->getChild();
+                    if (std::find(subgraph.begin(), subgraph.end(), childNode) != subgraph.end() || !childNode->getFusedWith().empty())
+                        continue;
 
-        graph.DropNode(childNode);
-    }
-}
+                    std::vector<int> childInputs;
+                    auto childInputsList = inputs;
+                    auto childSavedResults = savedResults;
+                    bool isFirstSrcFound = false;
+                    bool isSutable = childNode->getType() == Eltwise || childNode->getType() == Quantize;
+                    for (size_t port = 0; port < childNode->getParentEdges().size() && isSutable; port++) {
+                        auto parentEdge = childNode->getParentEdgesAtPort(port)[0];
+                        auto parent = parentEdge->getParent();
+
+                        auto subgraphIt = std::find(subgraph.begin(), subgraph.end(), parent);
+                        if (subgraphIt != subgraph.end()) {
+                            int result = subgraphIt - subgraph.begin();
+                            // Quantization parameters are hidden inside the post operation, so they have to be constant
+                            if (childNode->getType() == Quantize && port > 0) {
+                                isSutable = false;
+                            } else {
+                                // The first operand is taken from the register with the previous result
+                                if (isFirstSrcFound || result != static_cast<int>(subgraph.size()) - 1)
+                                    childSavedResults.insert(result);
+                                isFirstSrcFound = true;
+                                childInputs.push_back(-result - 1);
+                            }
+                        } else if (childNode->getType() == Eltwise) {
+                            // WA to prevent unsupported reorder exception issue in some cases
+                            if (parent->getType() == Split || dependsOnSubgraph(parent)) {
+                                isSutable = false;
+                            } else {
+                                auto input = std::make_pair(parent.get(), parentEdge->getInputNum());
+                                auto inputIt = std::find(childInputsList.begin(), childInputsList.end(), input);
+                                childInputs.push_back(inputIt - childInputsList.begin());
+                                if (inputIt == childInputsList.end())
+                                    childInputsList.push_back(input);
+                            }
+                        }
+                    }
 
-void MKLDNNGraphOptimizer::FuseEltwiseAndSimple(MKLDNNGraph &graph) {
-    auto& graphNodes = graph.GetNodes();
+                    if (!isSutable || childInputsList.size() + childSavedResults.size() > MAX_ELTWISE_INPUTS)
+                        continue;
 
-    auto isSutableParentNode = [](MKLDNNNodePtr node) {
-        return node->getType() == Eltwise && node->getChildEdges().size() == 1;
-    };
+                    if (!eltwiseNode->canFuse(childNode, childInputs[0] < 0))
+                        continue;
 
-    auto isSutableChildNode = [&](MKLDNNNodePtr parentNode, MKLDNNNodePtr childNode) {
-        for (auto &childParentEdge : childNode->getParentEdges()) {
-            // WA to prevent unsupported reorder exception issue in some cases
-            if (childParentEdge.lock()->getParent()->getType() == Split) {
-                return false;
+                    subgraph.push_back(childNode);
+                    subgraphInputs.push_back(childInputs);
+                    inputs = childInputsList;
+                    savedResults = childSavedResults;
+                    isCandidateFound = true;
+                }
             }
 
-            // Avoid cycle dependencies
-            for (auto &parentParentEdge : parentNode->getParentEdges()) {
-                if (childParentEdge.lock()->getParent() == parentParentEdge.lock()->getParent())
-                    return false;
-            }
+            if (isCandidateFound && isSubgraphClosed())
+                fusedNum = subgraph.size() - 1;
         }
 
-        if (!childNode->getFusedWith().empty())
-            return false;
+        for (size_t i = 1; i <= fusedNum; i++) {
+            auto childNode = subgraph[i];
+            const auto& childInputs = subgraphInputs[i - 1];
 
-        auto eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(parentNode.get());
-        return eltwiseNode->canFuse(childNode);
-    };
+            eltwiseNode->fuseSubgraphOperation(childNode, childInputs);
 
-    auto parent = graphNodes.begin();
-    while (parent != graphNodes.end()) {
-        auto parentNode = *parent;
-        if (!isSutableParentNode(parentNode)) {
-            parent++;
-            continue;
-        }
+            std::vector<MKLDNNEdgePtr> parentEdges;
+            for (size_t port = 0; port < childNode->getParentEdges().size(); port++)
+                parentEdges.push_back(childNode->getParentEdgesAtPort(port)[0]);
 
-        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSutableChildNode(parentNode, childNode)) {
-            parent++;
-            continue;
-        }
-
-        parentNode->fuseWith(childNode);
+            for (size_t port = 0; port < parentEdges.size(); port++) {
+                auto p_edge = parentEdges[port];
+                auto parent = p_edge->getParent();
+                if (port < childInputs.size() && childInputs[port] == static_cast<int>(headNode->getParentEdges().size())) {
+                    MKLDNNEdgePtr newEdge(new MKLDNNEdge(parent, headNode, p_edge->getInputNum(), childInputs[port]));
+                    graph.GetEdges().push_back(newEdge);
+                    parent->addEdge(newEdge);
 
-        if (childNode->getType() == Quantize) {
-            auto parentEdges = childNode->parentEdges;
-            for (auto &parentEdge : parentEdges) {
-                auto p_edge = parentEdge.lock();
-                if (p_edge->getParent()->getType() == Eltwise)
-                    continue;
+                    headNode->inDims.push_back(parent->outDims[p_edge->getInputNum()]);
+                }
 
+                p_edge->drop();
                 removeEdge(graph, p_edge);
             }
 
-            graph.DropNode(childNode);
-        } else if (childNode->getType() == Eltwise) {
-            auto childs = childNode->childEdges;
-            auto parents = childNode->parentEdges;
-
-            for (size_t i = 0; i < parents.size(); i++) {
-                auto p_edge = parents[i].lock();
-                if (!p_edge) continue;
-                auto parent = p_edge->getParent();
-                if (!parent) continue;
-
-                if (parent == parentNode) {
-                    for (size_t j = 0; j < childs.size(); j++) {
-                        if (!childs[j].lock())
-                            continue;
-                        auto child = childs[j].lock()->getChild();
-                        if (!child)
-                            continue;
-
-                        MKLDNNEdgePtr &remEdge = p_edge;
-                        int inNum = 0;
-                        if (remEdge) {
-                            inNum = remEdge->getInputNum();
-                            remEdge->drop();
-                            removeEdge(graph, remEdge);
-                        }
-                        remEdge = childs[j].lock();
-                        int outNum = 0;
-                        if (remEdge) {
-                            outNum = remEdge->getOutputNum();
-                            remEdge->drop();
-                            removeEdge(graph, remEdge);
-                        }
-                        MKLDNNEdgePtr newEdge(new MKLDNNEdge(parent, child, inNum, outNum));
-                        auto &graphEdges = graph.GetEdges();
-                        graphEdges.push_back(newEdge);
-                        parent->addEdge(newEdge);
+            auto childEdges = childNode->childEdges;
+            for (auto &childEdge : childEdges) {
+                auto c_edge = childEdge.lock();
+                if (!c_edge)
+                    continue;
+                auto child = c_edge->getChild();
+                int outNum = c_edge->getOutputNum();
 
-                        parent->outDims[inNum] = child->inDims[outNum];
-                    }
-                } else {
-                    MKLDNNEdgePtr &remEdge = p_edge;
-                    int inNum = 0;
-                    if (remEdge) {
-                        inNum = remEdge->getInputNum();
-                        remEdge->drop();
-                        removeEdge(graph, remEdge);
-                    }
+                c_edge->drop();
+                removeEdge(graph, c_edge);
 
-                    auto parentEltwise = parentNode;
-                    MKLDNNEdgePtr newEdge(new MKLDNNEdge(parent, parentEltwise, inNum, parentEltwise->getParentEdges().size()));
-                    auto &graphEdges = graph.GetEdges();
-                    graphEdges.push_back(newEdge);
-                    parent->addEdge(newEdge);
+                MKLDNNEdgePtr newEdge(new MKLDNNEdge(headNode, child, 0, outNum));
+                graph.GetEdges().push_back(newEdge);
+                headNode->addEdge(newEdge);
 
-                    parentEltwise->inDims.push_back(parent->outDims[0]);
-                }
+                headNode->outDims[0] = child->inDims[outNum];
             }
-
-            graph.DropNode(childNode);
-        } else {
-            graph.DropNode(childNode);
         }
     }
 }
@@ -2077,6 +2127,85 @@ void MKLDNNGraphOptimizer::FuseScaleShiftAndQuantize(MKLDNNGraph &graph) {
     }
 }
 
+void MKLDNNGraphOptimizer::FuseQuantizeAndRNN(MKLDNNGraph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    // oneDNN provides INT8 implementation only for LSTM cell
+    auto isSutableRNNNode = [](MKLDNNNodePtr node) {
+        if (!one_of(node->getType(), RNNCell, RNNSeq))
+            return false;
+
+        auto rnnLayer = std::dynamic_pointer_cast<RNNCellBase>(node->getCnnLayer());
+        if (rnnLayer == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get RNN layer " << node->getName();
+
+        return rnnLayer->cellType == RNNCellBase::LSTM && rnnLayer->clip == 0.0f;
+    };
+
+    // Only per-tensor u8 quantization which output range matches the input one can be represented
+    // by RNN data quantization parameters: u8 = round(x * scale + shift), x = (u8 - shift) / scale.
+    // oneDNN quantizes the hidden state with the same parameters, so the range must also cover [-1, 1]
+    auto isSutableQuantizeNode = [](MKLDNNNodePtr node) {
+        if (node->getType() != Quantize || node->getChildEdges().size() != 1)
+            return false;
+
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+        if (quantizeNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot cast " << node->getName() << " to Quantize node";
+
+        if (quantizeNode->isBinarization() || quantizeNode->getLevels() != 256)
+            return false;
+
+        const auto& cl = quantizeNode->getCropLow();
+        const auto& ch = quantizeNode->getCropHigh();
+        const auto& isc = quantizeNode->getInputScale();
+        const auto& ish = quantizeNode->getInputShift();
+        const auto& osc = quantizeNode->getOutputScale();
+        const auto& osh = quantizeNode->getOutputShift();
+        if (cl.size() != 1 || ch.size() != 1 || isc.size() != 1 || ish.size() != 1 || osc.size() != 1 || osh.size() != 1)
+            return false;
+
+        if (cl[0] > -1.f || ch[0] < 1.f)
+            return false;
+
+        auto isEqual = [](float a, float b) {
+            return std::abs(a - b) <= 1e-3f * std::max(1.f, std::abs(b));
+        };
+
+        return isEqual(cl[0] * isc[0] + ish[0], 0.f) && isEqual(ch[0] * isc[0] + ish[0], 255.f) &&
+               isEqual(osc[0] * isc[0], 1.f) && isEqual(osh[0] * isc[0] + ish[0], 0.f);
+    };
+
+    if (!mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_core))
+        return;
+
+    for (int i = 0; i < graphNodes.size(); i++) {
+        auto rnn = graphNodes[i];
+        if (!isSutableRNNNode(rnn)) continue;
+
+        auto quantize = rnn->getParentEdgesAtPort(0)[0]->getParent();
+        if (!isSutableQuantizeNode(quantize)) continue;
+
+        auto* rnnNode = dynamic_cast<MKLDNNRNN*>(rnn.get());
+        if (rnnNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot cast " << rnn->getName() << " to RNN node";
+
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(quantize.get());
+        rnnNode->setInputQuantization(quantizeNode->getInputScale()[0], quantizeNode->getInputShift()[0]);
+
+        auto parentEdges = quantize->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getOutputNum() == 0)
+                continue;
+
+            removeEdge(graph, p_edge);
+        }
+
+        graph.DropNode(quantize);
+    }
+}
+
 void MKLDNNGraphOptimizer::MergePermuteAndReorder(MKLDNNGraph &graph) {
     auto& graphNodes = graph.GetNodes();
 
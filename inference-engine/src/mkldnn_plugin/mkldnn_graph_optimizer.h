@@ -17,6 +17,7 @@ public:
 public:
     void ApplyCommonGraphOptimizations(MKLDNNGraph& graph);
     void ApplyImplSpecificGraphOptimizations(MKLDNNGraph& graph);
+    void ApplyLayoutAssignment(MKLDNNGraph& graph);
 
 private:
     void MergeGroupConvolution(MKLDNNGraph& graph);
@@ -31,9 +32,7 @@ private:
     void FusePoolingAndQuantize(MKLDNNGraph &graph);
     void FuseBatchNormWithScale(MKLDNNGraph& graph);
     void FuseConvolutionSumAndConvolutionSumActivation(MKLDNNGraph &graph);
-    void FuseMVNAndSimpleOperation(MKLDNNGraph &graph);
-    void FuseInterpolateAndSimpleOperation(MKLDNNGraph &graph);
-    void FuseNormalizeAndSimpleOperation(MKLDNNGraph &graph);
+    void FuseNodeAndSimpleOperations(MKLDNNGraph &graph);
     void RemoveIdentityOperator(MKLDNNGraph& graph);
 
     void RemoveIOScaleShifts(MKLDNNGraph& graph);
@@ -45,6 +44,7 @@ private:
     void FuseEltwiseAndSimple(MKLDNNGraph &graph);
     void FuseScaleShiftAndQuantize(MKLDNNGraph &graph);
     void FuseClampAndQuantize(MKLDNNGraph &graph);
+    void FuseQuantizeAndRNN(MKLDNNGraph &graph);
     void MergePermuteAndReorder(MKLDNNGraph &graph);
 
     bool IsOneOf(Type type, std::vector<Type> types);
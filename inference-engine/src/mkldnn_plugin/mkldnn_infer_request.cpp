@@ -92,7 +92,24 @@ void MKLDNNPlugin::MKLDNNInferRequest::pushInput(const std::string& inputName, I
         cpu_convert(srcData, dstData, inputBlob->getTensorDesc().getPrecision(), iconv->getTensorDesc().getPrecision(), iconv->size());
     }
 
-    graph->PushInputData(inputName, needConvert ? iconv : inputBlob);
+    graph->PushInputData(inputName, needConvert ? iconv : inputBlob, !preProcessingNormalizes(inputName));
+}
+
+bool MKLDNNPlugin::MKLDNNInferRequest::preProcessingNormalizes(const std::string& name) const {
+    if (_preProcData.find(name) == _preProcData.end() || !graph->hasMeanImageFor(name))
+        return false;
+
+    const auto& pp = _networkInputs.at(name)->getPreProcess();
+    if (pp.getMeanVariant() != InferenceEngine::MEAN_VALUE)
+        return false;
+    // MeanImage does not apply stdScale, keep results identical to the non-fused path
+    for (size_t c = 0; c < pp.getNumberOfChannels(); c++) {
+        if (pp[c]->stdScale != 1.f)
+            return false;
+    }
+
+    const auto prec = _inputs.at(name)->getTensorDesc().getPrecision();
+    return prec == InferenceEngine::Precision::FP32 || prec == InferenceEngine::Precision::BF16;
 }
 
 void MKLDNNPlugin::MKLDNNInferRequest::PushInputData() {
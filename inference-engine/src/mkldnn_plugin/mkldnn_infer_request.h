@@ -47,6 +47,9 @@ public:
      */
     void ThrowIfCanceled() const;
 
+protected:
+    bool preProcessingNormalizes(const std::string& name) const override;
+
 private:
     void PushInputData();
     void PushStates();
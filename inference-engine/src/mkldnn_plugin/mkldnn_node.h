@@ -338,6 +338,15 @@ public:
         fusedWith.push_back(fuse);
     }
 
+    /**
+     * @brief Returns true if the node can execute the given Eltwise or Quantize node as a post operation of its
+     * output. Nodes which write the output with JIT kernels override it to take part in the generic simple
+     * operations fusion, a chain of such nodes is fused one by one.
+     */
+    virtual bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const {
+        return false;
+    }
+
     void clearFusedWith() {
         fusedWith.clear();
     }
@@ -0,0 +1,318 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fused_post_ops.h"
+
+#include <legacy/ie_layers.h>
+#include "nodes/mkldnn_eltwise_node.h"
+#include "nodes/mkldnn_quantize_node.h"
+#include "emitters/jit_load_store_emitters.hpp"
+#include "emitters/jit_bf16_emitters.hpp"
+
+#include <cpu/x64/jit_generator.hpp>
+#include <cpu/x64/jit_uni_eltwise.hpp>
+#include <cpu/x64/jit_uni_depthwise_injector.hpp>
+#include <cpu/x64/jit_uni_quantization_injector.hpp>
+#include <cpu/x64/jit_uni_eltwise_injector.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+using namespace mkldnn;
+using namespace MKLDNNPlugin;
+using namespace InferenceEngine;
+using namespace mkldnn::impl;
+using namespace mkldnn::impl::cpu::x64;
+using namespace mkldnn::impl::utils;
+using namespace Xbyak;
+
+#define GET_OFF(field) offsetof(jit_post_ops_call_args, field)
+
+namespace MKLDNNPlugin {
+
+struct jit_post_ops_config_params {
+    Precision src_prc;
+    Precision dst_prc;
+    bool broadcast;
+    int block_size;
+};
+
+struct jit_post_ops_call_args {
+    const void *src;
+    void *dst;
+    size_t work_amount;
+    size_t oc_off;
+};
+
+struct jit_uni_post_ops_kernel {
+    void (*ker_)(const jit_post_ops_call_args *);
+
+    void operator()(const jit_post_ops_call_args *args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_post_ops_kernel(jit_post_ops_config_params jcp, const mkldnn_primitive_attr &attr) : ker_(nullptr), jcp_(jcp), attr_(attr) {}
+    virtual ~jit_uni_post_ops_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_post_ops_config_params jcp_;
+    const mkldnn_primitive_attr &attr_;
+};
+
+}  // namespace MKLDNNPlugin
+
+template <cpu_isa_t isa>
+struct jit_uni_post_ops_kernel_f32 : public jit_uni_post_ops_kernel, public jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_post_ops_kernel_f32)
+
+    explicit jit_uni_post_ops_kernel_f32(jit_post_ops_config_params jcp, const mkldnn_primitive_attr &attr)
+    : jit_uni_post_ops_kernel(jcp, attr), jit_generator() {}
+
+    void create_ker() override {
+        jit_generator::create_kernel();
+        ker_ = (decltype(ker_))jit_ker();
+    }
+
+    void generate() override {
+        const auto &p = attr_.post_ops_;
+        for (int i = 0; i < p.len(); i++) {
+            auto &post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors.push_back(std::make_shared<jit_uni_eltwise_injector_f32<isa>>(
+                        this, post_op.eltwise.alg, post_op.eltwise.alpha, post_op.eltwise.beta, post_op.eltwise.scale));
+            } else if (post_op.is_depthwise()) {
+                depthwise_injectors.push_back(std::make_shared<jit_uni_depthwise_injector_f32<isa>>(
+                        this, post_op.depthwise.alg));
+            } else if (post_op.is_quantization()) {
+                quantization_injectors.push_back(std::make_shared<jit_uni_quantization_injector_f32<isa>>(
+                        this, post_op, vmm_d_weights, vmm_d_bias, reg_d_weights, reg_d_bias));
+            }
+        }
+
+        load_emitter.reset(new jit_load_emitter(this, isa, nullptr));
+        store_emitter.reset(new jit_store_emitter(this, isa, nullptr));
+
+        this->preamble();
+
+        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+        mov(reg_oc_off, ptr[reg_params + GET_OFF(oc_off)]);
+
+        uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+
+        load_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx()), static_cast<size_t>(reg_load_table.getIdx())};
+        store_pool_gpr_idxs = {static_cast<size_t>(reg_load_store_mask.getIdx())};
+        store_pool_vec_idxs = {static_cast<size_t>(vmm_zero.getIdx())};
+
+        if (jcp_.broadcast) {
+            // all the elements belong to one channel, the tail is processed element by element
+            worker_loop(step);
+            worker_loop(1);
+        } else {
+            // every point holds block_size channels starting from oc_off
+            const int full_steps = jcp_.block_size / step;
+            const int tail_num = jcp_.block_size % step;
+
+            mov(reg_oc_off_start, reg_oc_off);
+
+            Xbyak::Label point_loop_label;
+            Xbyak::Label point_loop_end_label;
+            L(point_loop_label);
+            {
+                cmp(reg_work_amount, 0);
+                jle(point_loop_end_label, T_NEAR);
+
+                mov(reg_oc_off, reg_oc_off_start);
+                if (full_steps > 0) {
+                    Xbyak::Label channel_loop_label;
+                    mov(reg_channel_steps, full_steps);
+                    L(channel_loop_label);
+                    {
+                        worker(step);
+                        add(reg_oc_off, step * sizeof(float));
+                        sub(reg_channel_steps, 1);
+                        jnz(channel_loop_label, T_NEAR);
+                    }
+                }
+                if (tail_num != 0)
+                    worker(tail_num);
+
+                sub(reg_work_amount, 1);
+                jmp(point_loop_label, T_NEAR);
+            }
+            L(point_loop_end_label);
+        }
+
+        this->postamble();
+
+        load_emitter->emit_data();
+        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core) && store_emitter != nullptr && store_emitter->get_emu_vcvtneps2bf16() != nullptr)
+            store_emitter->get_emu_vcvtneps2bf16()->emit_data();
+
+        for (auto& inj : eltwise_injectors)
+            inj->prepare_table();
+    }
+
+private:
+    using Vmm = typename conditional3<isa == cpu::x64::sse41, Xbyak::Xmm, isa == cpu::x64::avx2,
+            Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    const int vlen = cpu_isa_traits<isa>::vlen;
+    const int step = vlen / sizeof(float);
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_oc_off_start = r12;
+    Xbyak::Reg64 reg_channel_steps = r13;
+    Xbyak::Reg64 reg_params = abi_param1;
+
+    Xbyak::Reg64 reg_oc_off = rax;
+    Xbyak::Reg64 reg_d_weights = rbx;
+    Xbyak::Reg64 reg_d_bias = rdx;
+
+    Xbyak::Reg64 reg_load_table = r15;
+    Xbyak::Reg64 reg_load_store_mask = rcx;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_zero = Vmm(3);
+
+    Vmm vmm_d_weights = Vmm(5);
+    Vmm vmm_d_bias = Vmm(6);
+
+    std::unique_ptr<jit_load_emitter> load_emitter = nullptr;
+    std::unique_ptr<jit_store_emitter> store_emitter = nullptr;
+
+    std::vector<std::shared_ptr<jit_uni_eltwise_injector_f32<isa>>> eltwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_depthwise_injector_f32<isa>>> depthwise_injectors;
+    std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors;
+
+    std::vector<size_t> store_pool_gpr_idxs;
+    std::vector<size_t> store_pool_vec_idxs;
+    std::vector<size_t> load_pool_gpr_idxs;
+
+    inline void worker(int elt_num) {
+        load_emitter->emit_code({static_cast<size_t>(reg_src.getIdx())}, {static_cast<size_t>(vmm_val.getIdx())},
+            std::make_shared<load_emitter_context>(jcp_.src_prc, Precision::FP32, elt_num),
+            {}, {load_pool_gpr_idxs});
+
+        apply_post_ops(jcp_.dst_prc, jcp_.broadcast);
+
+        store_emitter->emit_code({static_cast<size_t>(vmm_val.getIdx())}, {static_cast<size_t>(reg_dst.getIdx())},
+            std::make_shared<store_emitter_context>(Precision::FP32, jcp_.dst_prc, elt_num),
+            {store_pool_vec_idxs}, {store_pool_gpr_idxs});
+
+        add(reg_src, elt_num * static_cast<int>(jcp_.src_prc.size()));
+        add(reg_dst, elt_num * static_cast<int>(jcp_.dst_prc.size()));
+    }
+
+    inline void worker_loop(int elt_num) {
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+
+        L(loop_label);
+        {
+            cmp(reg_work_amount, elt_num);
+            jl(loop_end_label, T_NEAR);
+
+            worker(elt_num);
+
+            sub(reg_work_amount, elt_num);
+            jmp(loop_label, T_NEAR);
+        }
+        L(loop_end_label);
+    }
+
+    void apply_post_ops(InferenceEngine::Precision dst_prc, bool is_broadcast) {
+        const auto &p = attr_.post_ops_;
+        int eltwise_inj_idx = 0;
+        int depthwise_inj_idx = 0;
+        int quantization_inj_idx = 0;
+        for (int i = 0; i < p.len(); i++) {
+            auto& post_op = p.entry_[i];
+            if (post_op.is_eltwise()) {
+                eltwise_injectors[eltwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                eltwise_inj_idx++;
+            } else if (post_op.is_depthwise()) {
+                mov(reg_d_weights, reinterpret_cast<size_t>(post_op.depthwise.weights_data));
+                mov(reg_d_bias, reinterpret_cast<size_t>(post_op.depthwise.biases_data));
+                add(reg_d_weights, reg_oc_off);
+                add(reg_d_bias, reg_oc_off);
+                depthwise_injectors[depthwise_inj_idx]->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1, reg_d_weights, reg_d_bias, is_broadcast);
+                depthwise_inj_idx++;
+            } else if (post_op.is_quantization()) {
+                bool do_dequantization = post_op.quantization.alg == alg_kind::quantization_quantize_dequantize;
+                bool do_rounding = do_dequantization || dst_prc == Precision::FP32 || dst_prc == Precision::BF16 || i != p.len() - 1;
+                int s_idx = vmm_val.getIdx();
+
+                quantization_injectors[quantization_inj_idx]->init_crop_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_crop(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_input_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_input_scale_shift(s_idx, s_idx + 1, 0, do_rounding, 0, is_broadcast);
+
+                quantization_injectors[quantization_inj_idx]->init_output_scale_shift_ptrs(reg_oc_off);
+                quantization_injectors[quantization_inj_idx]->compute_output_scale_shift(s_idx, s_idx + 1, 0, 0, is_broadcast);
+
+                quantization_inj_idx++;
+            }
+        }
+    }
+};
+
+bool MKLDNNPlugin::canBeExecutedAsPostOp(const MKLDNNNodePtr& node) {
+    if (!node->getCnnLayer())
+        return false;
+
+    if (node->getType() == Quantize) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+        if (quantizeNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get quantize node " << node->getName();
+        return !quantizeNode->isBinarization();
+    } else if (node->getType() == Eltwise) {
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(node.get());
+        if (eltwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get eltwise node " << node->getName();
+        static const EltwiseOpType supportedOps[] = {Prelu, Relu, Gelu, Elu, Logistic, BoundedRelu, Clamp,
+                                                     Tanh, Swish, Hswish, Mish, Hsigmoid, Round, Linear, Abs, Square, Sqrt};
+        const auto opType = eltwiseNode->getOpType();
+        return std::find(std::begin(supportedOps), std::end(supportedOps), opType) != std::end(supportedOps) ||
+               (opType == MulAdd && eltwiseNode->getCnnLayer()->blobs.size() == 2);
+    }
+
+    return false;
+}
+
+FusedPostOps::FusedPostOps(const mkldnn::primitive_attr& attr, Precision srcPrc, Precision dstPrc, bool broadcast, size_t blockSize) {
+    auto jcp = jit_post_ops_config_params();
+    jcp.src_prc = srcPrc;
+    jcp.dst_prc = dstPrc;
+    jcp.broadcast = broadcast;
+    jcp.block_size = static_cast<int>(blockSize);
+
+    if (mayiuse(cpu::x64::avx512_common)) {
+        kernel.reset(new jit_uni_post_ops_kernel_f32<cpu::x64::avx512_common>(jcp, *attr.get()));
+    } else if (mayiuse(cpu::x64::avx2)) {
+        kernel.reset(new jit_uni_post_ops_kernel_f32<cpu::x64::avx2>(jcp, *attr.get()));
+    } else if (mayiuse(cpu::x64::sse41)) {
+        kernel.reset(new jit_uni_post_ops_kernel_f32<cpu::x64::sse41>(jcp, *attr.get()));
+    } else {
+        THROW_IE_EXCEPTION << "Fused post operations require sse41 or higher instruction set";
+    }
+
+    kernel->create_ker();
+}
+
+void FusedPostOps::execute(const uint8_t* src, uint8_t* dst, size_t workAmount, size_t oc) const {
+    auto arg = jit_post_ops_call_args();
+    arg.src = static_cast<const void *>(src);
+    arg.dst = static_cast<void *>(dst);
+    arg.work_amount = workAmount;
+    arg.oc_off = oc * sizeof(float);
+    (*kernel)(&arg);
+}
@@ -0,0 +1,43 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <ie_precision.hpp>
+#include <mkldnn.hpp>
+#include "mkldnn_node.h"
+
+namespace MKLDNNPlugin {
+
+struct jit_uni_post_ops_kernel;
+
+/**
+ * Returns true if the node is an Eltwise or a non-binarization Quantize node which can be executed as a JIT post
+ * operation (eltwise, depthwise or quantization injector) by the node it is fused into.
+ */
+bool canBeExecutedAsPostOp(const MKLDNNNodePtr& node);
+
+/**
+ * Applies the post operations of the attributes to a tile of a producer output. The tile is read in the source
+ * precision, the post operations are computed in FP32 and the result is written in the destination precision, so the
+ * producer calls it right after a tile is computed and the fused chain costs no extra pass over the memory.
+ * In the broadcast mode all elements of the tile belong to the same channel (planar layouts), otherwise every point of
+ * the tile holds blockSize consecutive channels (blocked and channels last layouts).
+ */
+class FusedPostOps {
+public:
+    FusedPostOps(const mkldnn::primitive_attr& attr, InferenceEngine::Precision srcPrc, InferenceEngine::Precision dstPrc,
+                 bool broadcast, size_t blockSize = 1);
+
+    /**
+     * Processes workAmount elements (broadcast mode) or workAmount points of blockSize channels, oc is the first channel.
+     */
+    void execute(const uint8_t* src, uint8_t* dst, size_t workAmount, size_t oc) const;
+
+private:
+    std::shared_ptr<jit_uni_post_ops_kernel> kernel;
+};
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "rnn_batcher.h"
+
+#include <details/ie_exception.hpp>
+
+namespace MKLDNNPlugin {
+
+RNNBatcher::RNNBatcher(size_t maxBatch, std::chrono::microseconds window) : maxBatch(maxBatch), window(window) {
+    if (maxBatch == 0)
+        THROW_IE_EXCEPTION << "RNN batcher requires positive batch limit";
+}
+
+void RNNBatcher::run(Request& request, const BatchedExecutor& executor) {
+    std::unique_lock<std::mutex> lock(guard);
+
+    if (!openGroup)
+        openGroup = std::make_shared<Group>();
+
+    auto group = openGroup;
+    group->requests.push_back(&request);
+    const bool isLeader = group->requests.size() == 1;
+
+    if (group->requests.size() == maxBatch) {
+        openGroup.reset();
+        cv.notify_all();
+    }
+
+    if (isLeader) {
+        const auto deadline = std::chrono::steady_clock::now() + window;
+        cv.wait_until(lock, deadline, [&] { return openGroup != group; });
+        if (openGroup == group)
+            openGroup.reset();
+        lock.unlock();
+
+        // The group is closed, so no other thread touches its requests until done is set
+        try {
+            executor(group->requests);
+        } catch (...) {
+            group->error = std::current_exception();
+        }
+
+        lock.lock();
+        group->done = true;
+        cv.notify_all();
+    } else {
+        cv.wait(lock, [&] { return group->done; });
+    }
+
+    if (group->error)
+        std::rethrow_exception(group->error);
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,60 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Gathers the calls of one RNN layer issued concurrently by the graphs of different streams, so they are computed
+ * by a single batched primitive call. The first caller of a group becomes its leader: it waits until the group is
+ * full or the gathering window expires, executes the whole group and wakes the other members up.
+ */
+class RNNBatcher {
+public:
+    using Ptr = std::shared_ptr<RNNBatcher>;
+
+    /** Buffers of one batch 1 call. Output states which are not consumed by the graph are nullptr. */
+    struct Request {
+        const float* src = nullptr;
+        std::vector<const float*> statesIn;
+        float* dst = nullptr;
+        std::vector<float*> statesOut;
+    };
+
+    using BatchedExecutor = std::function<void(const std::vector<Request*>&)>;
+
+    RNNBatcher(size_t maxBatch, std::chrono::microseconds window);
+
+    /**
+     * Adds the request to the current group and blocks until the group is executed. The executor of the caller is
+     * used only if it becomes the leader, its own request is always the first one of the group then.
+     * Exceptions thrown by the leader's executor are rethrown in every member of the group.
+     */
+    void run(Request& request, const BatchedExecutor& executor);
+
+private:
+    struct Group {
+        std::vector<Request*> requests;
+        bool done = false;
+        std::exception_ptr error;
+    };
+
+    const size_t maxBatch;
+    const std::chrono::microseconds window;
+
+    std::mutex guard;
+    std::condition_variable cv;
+    std::shared_ptr<Group> openGroup;
+};
+
+}  // namespace MKLDNNPlugin
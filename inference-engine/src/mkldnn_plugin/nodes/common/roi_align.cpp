@@ -0,0 +1,80 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "roi_align.h"
+
+#include <cmath>
+
+namespace MKLDNNPlugin {
+
+void calculateROIAlignGrid(float x1, float y1, float x2, float y2, int pooledH, int pooledW, int samplingRatio,
+                           int H, int W, int hStride, int wStride, ROIAlignGrid& grid) {
+    // malformed ROIs are forced to be 1x1
+    const float roiHeight = std::max(y2 - y1, 1.0f);
+    const float roiWidth = std::max(x2 - x1, 1.0f);
+    const float binHeight = roiHeight / pooledH;
+    const float binWidth = roiWidth / pooledW;
+
+    const int samplingRatioX = samplingRatio == 0 ? static_cast<int>(std::ceil(binWidth)) : samplingRatio;
+    const int samplingRatioY = samplingRatio == 0 ? static_cast<int>(std::ceil(binHeight)) : samplingRatio;
+    const float sampleDistanceX = binWidth / samplingRatioX;
+    const float sampleDistanceY = binHeight / samplingRatioY;
+
+    grid.samplesPerBin = samplingRatioX * samplingRatioY;
+    const size_t pointsNum = 4 * static_cast<size_t>(grid.samplesPerBin) * pooledH * pooledW;
+    grid.offsets.resize(pointsNum);
+    grid.weights.resize(pointsNum);
+
+    int* offsets = grid.offsets.data();
+    float* weights = grid.weights.data();
+    for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
+        for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
+            for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
+                float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
+                for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++, offsets += 4, weights += 4) {
+                    float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
+                    if (sampleX < -1.0f || sampleX > W || sampleY < -1.0f || sampleY > H) {
+                        std::fill(offsets, offsets + 4, 0);
+                        std::fill(weights, weights + 4, 0.f);
+                        continue;
+                    }
+                    float y = std::max(sampleY, 0.f);
+                    float x = std::max(sampleX, 0.f);
+
+                    int yLow = static_cast<int>(y);
+                    int xLow = static_cast<int>(x);
+                    int yHigh, xHigh;
+                    if (yLow >= H - 1) {
+                        yHigh = yLow = H - 1;
+                        y = static_cast<float>(yLow);
+                    } else {
+                        yHigh = yLow + 1;
+                    }
+                    if (xLow >= W - 1) {
+                        xHigh = xLow = W - 1;
+                        x = static_cast<float>(xLow);
+                    } else {
+                        xHigh = xLow + 1;
+                    }
+
+                    offsets[0] = yLow * hStride + xLow * wStride;
+                    offsets[1] = yLow * hStride + xHigh * wStride;
+                    offsets[2] = yHigh * hStride + xLow * wStride;
+                    offsets[3] = yHigh * hStride + xHigh * wStride;
+
+                    const float ly = y - yLow;
+                    const float lx = x - xLow;
+                    const float hy = 1.0f - ly;
+                    const float hx = 1.0f - lx;
+                    weights[0] = hy * hx;
+                    weights[1] = hy * lx;
+                    weights[2] = ly * hx;
+                    weights[3] = ly * lx;
+                }
+            }
+        }
+    }
+}
+
+}  // namespace MKLDNNPlugin
@@ -0,0 +1,85 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+namespace MKLDNNPlugin {
+
+/**
+ * Bilinear sampling points of a ROI split into pooledH x pooledW bins. Every sample has the offsets of its four
+ * neighbours in the feature map and their interpolation weights. The offsets already include the spatial strides,
+ * so one grid is computed per ROI and reused by all channels of plain, nhwc and blocked feature maps.
+ */
+struct ROIAlignGrid {
+    int samplesPerBin = 0;
+    std::vector<int> offsets;
+    std::vector<float> weights;
+};
+
+/**
+ * Fills the grid for the ROI [x1, y1, x2, y2] given in the feature map coordinates. A zero samplingRatio means an
+ * adaptive number of samples, ceil of the bin size. The samples outside of the feature map get zero weights.
+ */
+void calculateROIAlignGrid(float x1, float y1, float x2, float y2, int pooledH, int pooledW, int samplingRatio,
+                           int H, int W, int hStride, int wStride, ROIAlignGrid& grid);
+
+/**
+ * Pools one bin for channelsNum channels stored contiguously (nhwc or a channel block), so the loop over the channels
+ * is vectorized. src points to the first channel, the bin result is written to dst[0..channelsNum).
+ */
+template <bool isMax, typename in_data_t>
+inline void poolROIAlignBinContiguous(const in_data_t* src, const int* offsets, const float* weights, int samplesPerBin,
+                                      int channelsNum, float* dst) {
+    std::fill(dst, dst + channelsNum, 0.f);
+    for (int s = 0; s < samplesPerBin; s++, offsets += 4, weights += 4) {
+        const in_data_t* p1 = src + offsets[0];
+        const in_data_t* p2 = src + offsets[1];
+        const in_data_t* p3 = src + offsets[2];
+        const in_data_t* p4 = src + offsets[3];
+        const float w1 = weights[0], w2 = weights[1], w3 = weights[2], w4 = weights[3];
+        if (isMax) {
+            for (int c = 0; c < channelsNum; c++) {
+                const float v = std::max(std::max(w1 * static_cast<float>(p1[c]), w2 * static_cast<float>(p2[c])),
+                                         std::max(w3 * static_cast<float>(p3[c]), w4 * static_cast<float>(p4[c])));
+                dst[c] = std::max(dst[c], v);
+            }
+        } else {
+            for (int c = 0; c < channelsNum; c++) {
+                dst[c] += w1 * static_cast<float>(p1[c]) + w2 * static_cast<float>(p2[c]) +
+                          w3 * static_cast<float>(p3[c]) + w4 * static_cast<float>(p4[c]);
+            }
+        }
+    }
+    if (!isMax && samplesPerBin > 0) {
+        const float scale = 1.f / samplesPerBin;
+        for (int c = 0; c < channelsNum; c++)
+            dst[c] *= scale;
+    }
+}
+
+/**
+ * Pools one bin of a single channel, src points to the channel plane.
+ */
+template <bool isMax, typename in_data_t>
+inline float poolROIAlignBin(const in_data_t* src, const int* offsets, const float* weights, int samplesPerBin) {
+    float result = 0.f;
+    for (int s = 0; s < samplesPerBin; s++, offsets += 4, weights += 4) {
+        const float v1 = weights[0] * static_cast<float>(src[offsets[0]]);
+        const float v2 = weights[1] * static_cast<float>(src[offsets[1]]);
+        const float v3 = weights[2] * static_cast<float>(src[offsets[2]]);
+        const float v4 = weights[3] * static_cast<float>(src[offsets[3]]);
+        if (isMax)
+            result = std::max(result, std::max(std::max(v1, v2), std::max(v3, v4)));
+        else
+            result += v1 + v2 + v3 + v4;
+    }
+    if (!isMax && samplesPerBin > 0)
+        result /= samplesPerBin;
+    return result;
+}
+
+}  // namespace MKLDNNPlugin
@@ -13,6 +13,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <vector>
 
 using namespace InferenceEngine;
@@ -30,11 +31,18 @@ struct jit_args_softmax {
     size_t src_stride;
     size_t dst_stride;
     size_t work_amount;
+    // per lane running maximum and sum of exponents, updated by the reduce kernel
+    float* max;
+    float* sum;
+    // per lane values used by the normalize kernel: dst = exp(src - shift) * scale, or src - shift for log-softmax
+    const float* shift;
+    const float* scale;
 };
 
 struct jit_softmax_config_params {
     Precision src_dt;
     Precision dst_dt;
+    bool log_softmax;
 };
 
 
@@ -50,145 +58,26 @@ struct jit_uni_softmax_kernel {
 };
 
 template <cpu_isa_t isa>
-struct jit_uni_softmax_kernel_f32 : public jit_uni_softmax_kernel, public jit_generator {
-    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_kernel_f32)
-
-    jit_uni_softmax_kernel_f32(jit_softmax_config_params jcp) : jcp_(jcp), jit_uni_softmax_kernel(), jit_generator() {}
+struct jit_uni_softmax_base_kernel_f32 : public jit_uni_softmax_kernel, public jit_generator {
+    explicit jit_uni_softmax_base_kernel_f32(jit_softmax_config_params jcp) : jit_uni_softmax_kernel(), jit_generator(), jcp_(jcp) {}
 
     void create_ker() override {
         jit_generator::create_kernel();
         ker_ = (decltype(ker_))jit_ker();
     }
 
-    void generate() override {
-        exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
-
-        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
-            emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
-
-        this->preamble();
-
-
-        mov(reg_src, ptr[reg_params + GET_OFF(src)]);
-        mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
-        mov(reg_src_stride, ptr[reg_params + GET_OFF(src_stride)]);
-        mov(reg_dst_stride, ptr[reg_params + GET_OFF(dst_stride)]);
-        mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
-
-        Xbyak::Label max_loop_label;
-        Xbyak::Label max_loop_end_label;
-        Xbyak::Label exp_loop_label;
-        Xbyak::Label exp_loop_end_label;
-        Xbyak::Label div_loop_label;
-        Xbyak::Label div_loop_end_label;
-
-        mov(aux_reg_work_amount, reg_work_amount);
-        mov(aux_reg_src, reg_src);
-        load_vector(vmm_max, ptr[aux_reg_src], jcp_.src_dt);
-        L(max_loop_label); {
-            cmp(aux_reg_work_amount, 0);
-            jle(max_loop_end_label, T_NEAR);
-
-            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
-
-            if (isa == x64::sse41) {
-                uni_vmovups(vmm_mask, vmm_val);
-                uni_vcmpgtps(vmm_mask, vmm_mask, vmm_max);
-            } else if (isa == x64::avx2) {
-                uni_vcmpgtps(vmm_mask, vmm_val, vmm_max);
-            } else {
-                vcmpps(k_mask, vmm_val, vmm_max, _cmp_nle_us);
-            }
-
-            if (isa == x64::avx512_common) {
-                vptestmd(k_mask, vmm_mask, vmm_mask);
-                vblendmps(vmm_max | k_mask, vmm_max, vmm_val);
-            } else {
-                uni_vblendvps(vmm_max, vmm_max, vmm_val, vmm_mask);
-            }
-
-            add(aux_reg_src, reg_src_stride);
-            sub(aux_reg_work_amount, 1);
-
-            jmp(max_loop_label, T_NEAR);
-        }
-
-        L(max_loop_end_label);
-
-        mov(aux_reg_work_amount, reg_work_amount);
-        mov(aux_reg_src, reg_src);
-        mov(aux_reg_dst, reg_dst);
-        uni_vpxor(vmm_exp_sum, vmm_exp_sum, vmm_exp_sum);
-        L(exp_loop_label); {
-            cmp(aux_reg_work_amount, 0);
-            jle(exp_loop_end_label, T_NEAR);
-
-            load_vector(vmm_val, ptr[aux_reg_src], jcp_.src_dt);
-
-            uni_vsubps(vmm_val, vmm_val, vmm_max);
-            exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
-            uni_vaddps(vmm_exp_sum, vmm_exp_sum, vmm_val);
-
-            store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
-
-            add(aux_reg_src, reg_src_stride);
-            add(aux_reg_dst, reg_dst_stride);
-            sub(aux_reg_work_amount, 1);
-
-            jmp(exp_loop_label, T_NEAR);
-        }
-
-        L(exp_loop_end_label);
-
-        mov(aux_reg_work_amount, reg_work_amount);
-        mov(aux_reg_dst, reg_dst);
-        L(div_loop_label); {
-            cmp(aux_reg_work_amount, 0);
-            jle(div_loop_end_label, T_NEAR);
-
-            load_vector(vmm_val, ptr[aux_reg_dst], jcp_.dst_dt);
-
-            uni_vdivps(vmm_val, vmm_val, vmm_exp_sum);
-
-            store_vector(ptr[aux_reg_dst], vmm_val, jcp_.dst_dt);
-
-            add(aux_reg_dst, reg_dst_stride);
-            sub(aux_reg_work_amount, 1);
-
-            jmp(div_loop_label, T_NEAR);
-        }
-
-        L(div_loop_end_label);
-
-        this->postamble();
-
-        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
-            emu_vcvtneps2bf16->emit_data();
-
-        exp_injector->prepare_table();
-    }
-
-private:
+protected:
     using Vmm = typename conditional3<isa == x64::sse41, Xbyak::Xmm, isa == x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
-    size_t vlen = cpu_isa_traits<isa>::vlen;
 
     Xbyak::Reg64 reg_src = r8;
-    Xbyak::Reg64 aux_reg_src = r13;
     Xbyak::Reg64 reg_dst = r9;
-    Xbyak::Reg64 aux_reg_dst = r15;
     Xbyak::Reg64 reg_work_amount = r11;
-    Xbyak::Reg64 aux_reg_work_amount = r12;
     Xbyak::Reg64 reg_src_stride = r14;
     Xbyak::Reg64 reg_dst_stride = r10;
+    Xbyak::Reg64 reg_aux0 = r12;
+    Xbyak::Reg64 reg_aux1 = r13;
     Xbyak::Reg64 reg_params = abi_param1;
 
-    Vmm vmm_mask = Vmm(0);
-    Vmm vmm_val = Vmm(1);
-    Vmm vmm_max = Vmm(2);
-    Vmm vmm_exp_sum = Vmm(3);
-
-    const Xbyak::Opmask k_mask = Xbyak::Opmask(1);
-
     std::unique_ptr<jit_emu_vcvtneps2bf16> emu_vcvtneps2bf16;
 
     std::shared_ptr<jit_uni_eltwise_injector_f32<isa>> exp_injector;
@@ -228,8 +117,171 @@ private:
     }
 };
 
-SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
-    : input_prec(inpPrc), output_prec(outPrc) {
+// Single read pass over work_amount vectors taken with src_stride: the lanes keep the running maximum and the sum of
+// exponents rescaled to it, sum = sum * exp(max - new_max) + exp(src - new_max)
+template <cpu_isa_t isa>
+struct jit_uni_softmax_reduce_kernel_f32 : public jit_uni_softmax_base_kernel_f32<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_reduce_kernel_f32)
+
+    explicit jit_uni_softmax_reduce_kernel_f32(jit_softmax_config_params jcp) : jit_uni_softmax_base_kernel_f32<isa>(jcp) {}
+
+    void generate() override {
+        this->exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
+
+        this->preamble();
+
+        this->mov(this->reg_src, this->ptr[this->reg_params + GET_OFF(src)]);
+        this->mov(this->reg_src_stride, this->ptr[this->reg_params + GET_OFF(src_stride)]);
+        this->mov(this->reg_work_amount, this->ptr[this->reg_params + GET_OFF(work_amount)]);
+        this->mov(this->reg_aux0, this->ptr[this->reg_params + GET_OFF(max)]);
+        this->mov(this->reg_aux1, this->ptr[this->reg_params + GET_OFF(sum)]);
+
+        this->uni_vmovups(vmm_max, this->ptr[this->reg_aux0]);
+        this->uni_vmovups(vmm_sum, this->ptr[this->reg_aux1]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        this->L(loop_label); {
+            this->cmp(this->reg_work_amount, 0);
+            this->jle(loop_end_label, this->T_NEAR);
+
+            this->load_vector(vmm_val, this->ptr[this->reg_src], this->jcp_.src_dt);
+
+            this->uni_vmaxps(vmm_new_max, vmm_max, vmm_val);
+            this->uni_vsubps(vmm_max_diff, vmm_max, vmm_new_max);
+            this->uni_vsubps(vmm_val_diff, vmm_val, vmm_new_max);
+            this->exp_injector->compute_vector_range(vmm_max_diff.getIdx(), vmm_val_diff.getIdx() + 1);
+            this->uni_vmulps(vmm_sum, vmm_sum, vmm_max_diff);
+            this->uni_vaddps(vmm_sum, vmm_sum, vmm_val_diff);
+            this->uni_vmovups(vmm_max, vmm_new_max);
+
+            this->add(this->reg_src, this->reg_src_stride);
+            this->sub(this->reg_work_amount, 1);
+
+            this->jmp(loop_label, this->T_NEAR);
+        }
+        this->L(loop_end_label);
+
+        this->uni_vmovups(this->ptr[this->reg_aux0], vmm_max);
+        this->uni_vmovups(this->ptr[this->reg_aux1], vmm_sum);
+
+        this->postamble();
+
+        this->exp_injector->prepare_table();
+    }
+
+private:
+    using Vmm = typename jit_uni_softmax_base_kernel_f32<isa>::Vmm;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_max = Vmm(1);
+    Vmm vmm_sum = Vmm(2);
+    Vmm vmm_new_max = Vmm(3);
+    // the exponents of both differences are computed by a single injector call
+    Vmm vmm_max_diff = Vmm(4);
+    Vmm vmm_val_diff = Vmm(5);
+};
+
+// Writes exp(src - shift) * scale, or src - shift for log-softmax, for work_amount vectors
+template <cpu_isa_t isa>
+struct jit_uni_softmax_normalize_kernel_f32 : public jit_uni_softmax_base_kernel_f32<isa> {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_softmax_normalize_kernel_f32)
+
+    explicit jit_uni_softmax_normalize_kernel_f32(jit_softmax_config_params jcp) : jit_uni_softmax_base_kernel_f32<isa>(jcp) {}
+
+    void generate() override {
+        if (!this->jcp_.log_softmax)
+            this->exp_injector.reset(new jit_uni_eltwise_injector_f32<isa>(this, mkldnn::impl::alg_kind::eltwise_exp, 0.f, 0.f, 1.0f));
+
+        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
+            this->emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
+
+        this->preamble();
+
+        this->mov(this->reg_src, this->ptr[this->reg_params + GET_OFF(src)]);
+        this->mov(this->reg_dst, this->ptr[this->reg_params + GET_OFF(dst)]);
+        this->mov(this->reg_src_stride, this->ptr[this->reg_params + GET_OFF(src_stride)]);
+        this->mov(this->reg_dst_stride, this->ptr[this->reg_params + GET_OFF(dst_stride)]);
+        this->mov(this->reg_work_amount, this->ptr[this->reg_params + GET_OFF(work_amount)]);
+        this->mov(this->reg_aux0, this->ptr[this->reg_params + GET_OFF(shift)]);
+        this->mov(this->reg_aux1, this->ptr[this->reg_params + GET_OFF(scale)]);
+
+        this->uni_vmovups(vmm_shift, this->ptr[this->reg_aux0]);
+        if (!this->jcp_.log_softmax)
+            this->uni_vmovups(vmm_scale, this->ptr[this->reg_aux1]);
+
+        Xbyak::Label loop_label;
+        Xbyak::Label loop_end_label;
+        this->L(loop_label); {
+            this->cmp(this->reg_work_amount, 0);
+            this->jle(loop_end_label, this->T_NEAR);
+
+            this->load_vector(vmm_val, this->ptr[this->reg_src], this->jcp_.src_dt);
+
+            this->uni_vsubps(vmm_val, vmm_val, vmm_shift);
+            if (!this->jcp_.log_softmax) {
+                this->exp_injector->compute_vector_range(vmm_val.getIdx(), vmm_val.getIdx() + 1);
+                this->uni_vmulps(vmm_val, vmm_val, vmm_scale);
+            }
+
+            this->store_vector(this->ptr[this->reg_dst], vmm_val, this->jcp_.dst_dt);
+
+            this->add(this->reg_src, this->reg_src_stride);
+            this->add(this->reg_dst, this->reg_dst_stride);
+            this->sub(this->reg_work_amount, 1);
+
+            this->jmp(loop_label, this->T_NEAR);
+        }
+        this->L(loop_end_label);
+
+        this->postamble();
+
+        if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
+            this->emu_vcvtneps2bf16->emit_data();
+
+        if (this->exp_injector)
+            this->exp_injector->prepare_table();
+    }
+
+private:
+    using Vmm = typename jit_uni_softmax_base_kernel_f32<isa>::Vmm;
+
+    Vmm vmm_val = Vmm(0);
+    Vmm vmm_shift = Vmm(1);
+    Vmm vmm_scale = Vmm(2);
+};
+
+namespace {
+
+// the widest vector of the kernels, in floats
+constexpr int max_block_size = 16;
+// the smallest part of a contiguous axis processed by a thread
+constexpr size_t min_axis_block = 4096;
+
+inline void merge_max_sum(float& max, float& sum, float other_max, float other_sum) {
+    if (other_max > max) {
+        sum = sum * std::exp(max - other_max) + other_sum;
+        max = other_max;
+    } else {
+        sum += other_sum * std::exp(other_max - max);
+    }
+}
+
+// shift and scale of the normalization for the found maximum and sum of exponents
+inline void get_shift_scale(bool log_softmax, float max, float sum, float& shift, float& scale) {
+    shift = log_softmax ? max + std::log(sum) : max;
+    scale = log_softmax ? 1.f : 1.f / sum;
+}
+
+template<typename in_data_t, typename out_data_t>
+inline void normalize_scalar(const in_data_t* src, out_data_t* dst, bool log_softmax, float shift, float scale) {
+    *dst = log_softmax ? static_cast<float>(*src) - shift : std::exp(static_cast<float>(*src) - shift) * scale;
+}
+
+}  // namespace
+
+SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc, bool logSoftmax)
+    : log_softmax(logSoftmax), input_prec(inpPrc), output_prec(outPrc) {
     if (Precision::BF16 == output_prec) {
         if (!mayiuse(avx512_core)) {
             THROW_IE_EXCEPTION << "SoftmaxGeneric doesn't support BF16 precision on this target.";
@@ -240,60 +292,177 @@ SoftmaxGeneric::SoftmaxGeneric(Precision inpPrc, Precision outPrc)
     auto jcp = jit_softmax_config_params();
     jcp.src_dt = inpPrc;
     jcp.dst_dt = outPrc;
+    jcp.log_softmax = logSoftmax;
 
     if (mayiuse(x64::avx512_common)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx512_common>(jcp));
+        reduce_kernel.reset(new jit_uni_softmax_reduce_kernel_f32<x64::avx512_common>(jcp));
+        normalize_kernel.reset(new jit_uni_softmax_normalize_kernel_f32<x64::avx512_common>(jcp));
         block_size = 16;
     } else if (mayiuse(x64::avx2)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::avx2>(jcp));
+        reduce_kernel.reset(new jit_uni_softmax_reduce_kernel_f32<x64::avx2>(jcp));
+        normalize_kernel.reset(new jit_uni_softmax_normalize_kernel_f32<x64::avx2>(jcp));
         block_size = 8;
     } else if (mayiuse(x64::sse41)) {
-        softmax_kernel.reset(new jit_uni_softmax_kernel_f32<x64::sse41>(jcp));
+        reduce_kernel.reset(new jit_uni_softmax_reduce_kernel_f32<x64::sse41>(jcp));
+        normalize_kernel.reset(new jit_uni_softmax_normalize_kernel_f32<x64::sse41>(jcp));
         block_size = 4;
     }
-    if (softmax_kernel)
-        softmax_kernel->create_ker();
+    if (reduce_kernel)
+        reduce_kernel->create_ker();
+    if (normalize_kernel)
+        normalize_kernel->create_ker();
 }
 
 template<typename in_data_t, typename out_data_t>
 void SoftmaxGeneric::calculate(const in_data_t *src_data, out_data_t *dst_data, int B, int C, int H, int W) {
-    for (int b = 0; b < B; b++) {
-        int tail_start = 0;
-        if (softmax_kernel) {
-            int blocks_num = H*W / block_size;
+    if (H * W == 1) {
+        calculateContiguous(src_data, dst_data, B, C);
+        return;
+    }
 
-            parallel_for(blocks_num, [&](int ib) {
-                auto arg = jit_args_softmax();
+    const size_t inner = static_cast<size_t>(H) * W;
+    const size_t batch_stride = static_cast<size_t>(C) * inner;
+    size_t tail_start = 0;
+    if (reduce_kernel) {
+        const size_t blocks_num = inner / block_size;
+
+        parallel_for2d(B, blocks_num, [&](size_t b, size_t ib) {
+            float max[max_block_size], sum[max_block_size], shift[max_block_size], scale[max_block_size];
+            std::fill(max, max + block_size, std::numeric_limits<float>::lowest());
+            std::fill(sum, sum + block_size, 0.f);
+
+            auto arg = jit_args_softmax();
+            arg.src = src_data + b * batch_stride + ib * block_size;
+            arg.dst = dst_data + b * batch_stride + ib * block_size;
+            arg.src_stride = inner * sizeof(in_data_t);
+            arg.dst_stride = inner * sizeof(out_data_t);
+            arg.work_amount = static_cast<size_t>(C);
+            arg.max = max;
+            arg.sum = sum;
+            (*reduce_kernel)(&arg);
+
+            for (int i = 0; i < block_size; i++)
+                get_shift_scale(log_softmax, max[i], sum[i], shift[i], scale[i]);
+            arg.shift = shift;
+            arg.scale = scale;
+            (*normalize_kernel)(&arg);
+        });
 
-                arg.src = src_data + b * C * H * W + ib * block_size;
-                arg.dst = dst_data + b * C * H * W + ib * block_size;
-                arg.src_stride = static_cast<size_t>((size_t)(H) * W * sizeof(in_data_t));
-                arg.dst_stride = static_cast<size_t>((size_t)(H) * W * sizeof(out_data_t));
-                arg.work_amount = static_cast<size_t>(C);
+        tail_start = blocks_num * block_size;
+    }
 
-                (*softmax_kernel)(&arg);
-            });
+    parallel_for2d(B, inner - tail_start, [&](size_t b, size_t i) {
+        const in_data_t *psrc = src_data + b * batch_stride + tail_start + i;
+        out_data_t *pdst = dst_data + b * batch_stride + tail_start + i;
 
-            tail_start = (H*W / block_size) * block_size;
-        }
+        float max = std::numeric_limits<float>::lowest();
+        float sum = 0.f;
+        for (int c = 0; c < C; c++)
+            merge_max_sum(max, sum, static_cast<float>(psrc[c * inner]), 1.f);
 
-        parallel_for(H * W - tail_start, [&](int i) {
-            int offset = i + tail_start;
-            float max = src_data[b * C * H * W + offset];
-            for (int c = 0; c < C; c++) {
-                float val = src_data[b * C * H * W + c * H * W + offset];
-                if (val > max) max = val;
-            }
+        float shift, scale;
+        get_shift_scale(log_softmax, max, sum, shift, scale);
+        for (int c = 0; c < C; c++)
+            normalize_scalar(psrc + c * inner, pdst + c * inner, log_softmax, shift, scale);
+    });
+}
 
-            float expSum = 0;
-            for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + offset] = exp(src_data[b * C * H * W + c * H * W + offset] - max);
-                expSum += dst_data[b * C * H * W + c * H * W + offset];
-            }
+template<typename in_data_t>
+void SoftmaxGeneric::reduceContiguous(const in_data_t *src_data, size_t len, float& max, float& sum) {
+    size_t tail_start = 0;
+    if (reduce_kernel && len >= static_cast<size_t>(block_size)) {
+        float lane_max[max_block_size], lane_sum[max_block_size];
+        std::fill(lane_max, lane_max + block_size, std::numeric_limits<float>::lowest());
+        std::fill(lane_sum, lane_sum + block_size, 0.f);
+
+        auto arg = jit_args_softmax();
+        arg.src = src_data;
+        arg.src_stride = block_size * sizeof(in_data_t);
+        arg.work_amount = len / block_size;
+        arg.max = lane_max;
+        arg.sum = lane_sum;
+        (*reduce_kernel)(&arg);
+
+        for (int i = 0; i < block_size; i++)
+            merge_max_sum(max, sum, lane_max[i], lane_sum[i]);
+        tail_start = arg.work_amount * block_size;
+    }
 
-            for (int c = 0; c < C; c++) {
-                dst_data[b * C * H * W + c * H * W + offset] = dst_data[b * C * H * W + c * H * W + offset] / expSum;
-            }
+    for (size_t i = tail_start; i < len; i++)
+        merge_max_sum(max, sum, static_cast<float>(src_data[i]), 1.f);
+}
+
+template<typename in_data_t, typename out_data_t>
+void SoftmaxGeneric::normalizeContiguous(const in_data_t *src_data, out_data_t *dst_data, size_t len, float shift, float scale) {
+    size_t tail_start = 0;
+    if (normalize_kernel && len >= static_cast<size_t>(block_size)) {
+        float lane_shift[max_block_size], lane_scale[max_block_size];
+        std::fill(lane_shift, lane_shift + block_size, shift);
+        std::fill(lane_scale, lane_scale + block_size, scale);
+
+        auto arg = jit_args_softmax();
+        arg.src = src_data;
+        arg.dst = dst_data;
+        arg.src_stride = block_size * sizeof(in_data_t);
+        arg.dst_stride = block_size * sizeof(out_data_t);
+        arg.work_amount = len / block_size;
+        arg.shift = lane_shift;
+        arg.scale = lane_scale;
+        (*normalize_kernel)(&arg);
+
+        tail_start = arg.work_amount * block_size;
+    }
+
+    for (size_t i = tail_start; i < len; i++)
+        normalize_scalar(src_data + i, dst_data + i, log_softmax, shift, scale);
+}
+
+template<typename in_data_t, typename out_data_t>
+void SoftmaxGeneric::calculateContiguous(const in_data_t *src_data, out_data_t *dst_data, int B, int C) {
+    const size_t len = static_cast<size_t>(C);
+    const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+
+    if (static_cast<size_t>(B) >= nthr || len < 2 * min_axis_block) {
+        parallel_for(B, [&](int b) {
+            float max = std::numeric_limits<float>::lowest();
+            float sum = 0.f;
+            reduceContiguous(src_data + b * len, len, max, sum);
+
+            float shift, scale;
+            get_shift_scale(log_softmax, max, sum, shift, scale);
+            normalizeContiguous(src_data + b * len, dst_data + b * len, len, shift, scale);
+        });
+        return;
+    }
+
+    // too few rows to occupy the threads: each row is split into the blocks reduced in parallel, their maximums and
+    // sums are merged and the blocks are normalized in parallel
+    const size_t blocks_num = std::min(nthr, len / min_axis_block);
+    const size_t axis_block = ((len + blocks_num - 1) / blocks_num + block_size - 1) / block_size * block_size;
+    std::vector<float> block_max(blocks_num), block_sum(blocks_num);
+    for (int b = 0; b < B; b++) {
+        const in_data_t *psrc = src_data + b * len;
+        out_data_t *pdst = dst_data + b * len;
+
+        parallel_for(blocks_num, [&](size_t ib) {
+            const size_t start = std::min(len, ib * axis_block);
+            const size_t end = std::min(len, start + axis_block);
+            block_max[ib] = std::numeric_limits<float>::lowest();
+            block_sum[ib] = 0.f;
+            reduceContiguous(psrc + start, end - start, block_max[ib], block_sum[ib]);
+        });
+
+        float max = std::numeric_limits<float>::lowest();
+        float sum = 0.f;
+        for (size_t ib = 0; ib < blocks_num; ib++)
+            merge_max_sum(max, sum, block_max[ib], block_sum[ib]);
+
+        float shift, scale;
+        get_shift_scale(log_softmax, max, sum, shift, scale);
+        parallel_for(blocks_num, [&](size_t ib) {
+            const size_t start = std::min(len, ib * axis_block);
+            const size_t end = std::min(len, start + axis_block);
+            normalizeContiguous(psrc + start, pdst + start, end - start, shift, scale);
         });
     }
 }
@@ -317,7 +486,7 @@ void SoftmaxGeneric::execute(const uint8_t *src_data, uint8_t *dst_data, int B,
             calculate(bf16_src_data, float_dst_data, B, C, H, W);
         } else if (Precision::BF16 == output_prec) {
             auto bf16_dst_data = reinterpret_cast<bfloat16_t*>(dst_data);
-            calculate(bf16_dst_data, bf16_dst_data, B, C, H, W);
+            calculate(bf16_src_data, bf16_dst_data, B, C, H, W);
         } else {
             THROW_IE_EXCEPTION << "Unsupported output precision: " << output_prec.name();
         }
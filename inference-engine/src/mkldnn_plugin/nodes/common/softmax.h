@@ -36,18 +36,34 @@ void softmax_many_batches(const float *src_data, float *dst_data, int B, int C,
     });
 }
 
+/**
+ * Softmax or log-softmax over C of the [B, C, H * W] tensor. The maximum and the sum of exponents are found in a
+ * single read pass with the running rescaling of the sum, the second pass writes the output. When the axis is the
+ * innermost one (H * W == 1), the elements are vectorized along the axis and a long axis is split between the
+ * threads, otherwise the vectors are taken along H * W.
+ */
 class SoftmaxGeneric {
 public:
-    SoftmaxGeneric(InferenceEngine::Precision inpPrc, InferenceEngine::Precision outPrc);
+    SoftmaxGeneric(InferenceEngine::Precision inpPrc, InferenceEngine::Precision outPrc, bool logSoftmax = false);
 
     void execute(const uint8_t *src_data, uint8_t *dst_data, int B, int C, int H, int W);
 private:
     template<typename in_data_t, typename out_data_t>
     void calculate(const in_data_t* src_data, out_data_t* dst_data, int B, int C, int H, int W);
 
+    template<typename in_data_t, typename out_data_t>
+    void calculateContiguous(const in_data_t* src_data, out_data_t* dst_data, int B, int C);
+
+    template<typename in_data_t>
+    void reduceContiguous(const in_data_t* src_data, size_t len, float& max, float& sum);
+
+    template<typename in_data_t, typename out_data_t>
+    void normalizeContiguous(const in_data_t* src_data, out_data_t* dst_data, size_t len, float shift, float scale);
+
 private:
     int block_size;
+    bool log_softmax;
     InferenceEngine::Precision input_prec, output_prec;
-    std::shared_ptr<jit_uni_softmax_kernel> softmax_kernel;
+    std::shared_ptr<jit_uni_softmax_kernel> reduce_kernel;
+    std::shared_ptr<jit_uni_softmax_kernel> normalize_kernel;
 };
-
@@ -5,6 +5,8 @@
 #include "list.hpp"
 #include "base.hpp"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 #include <vector>
 #include "ie_parallel.hpp"
@@ -121,118 +123,126 @@ private:
     void execImpl(const Blob::CPtr& _input, const Blob::Ptr& _output) {
         const auto *input = _input->cbuffer().as<const dataType *>() + _input->getTensorDesc().getBlockingDesc().getOffsetPadding();
         auto *output = _output->buffer().as<dataType *>() + _output->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        const std::vector<size_t> strides = _input->getTensorDesc().getBlockingDesc().getStrides();
 
         if (reverse) {
             if (exclusive) {
-                cumSum<true, true, dataType>(input, output, strides);
+                cumSum<true, true, dataType>(input, output);
             } else {
-                cumSum<true, false, dataType>(input, output, strides);
+                cumSum<true, false, dataType>(input, output);
             }
         } else {
             if (exclusive) {
-                cumSum<false, true, dataType>(input, output, strides);
+                cumSum<false, true, dataType>(input, output);
             } else {
-                cumSum<false, false, dataType>(input, output, strides);
+                cumSum<false, false, dataType>(input, output);
             }
         }
     }
 
+    // The planar tensor is viewed as [outer, axis, inner]. When the axis is not innermost, the sums are accumulated
+    // row by row over contiguous chunks of the inner dimensions, which vectorizes, and the chunks are processed in
+    // parallel. When the axis is innermost, the independent lines are processed in parallel, unless there are too
+    // few of them to occupy the threads: then each long line is scanned in blocks in two passes.
     template <bool reverse, bool exclusive, typename dataType>
-    void cumSum(const dataType *input, dataType *output, const std::vector<size_t> &strides) {
-        SizeVector iterationRange(numOfDims - 1);
-        size_t j = 0;
-        for (size_t i = 0; i < shape.size(); i++) {
-            if (i == axis)
-                continue;
-            iterationRange[j++] = shape[i];
+    void cumSum(const dataType *input, dataType *output) {
+        const size_t axisLen = shape[axis];
+        const size_t outer = std::accumulate(shape.begin(), shape.begin() + axis, size_t(1), std::multiplies<size_t>());
+        const size_t inner = std::accumulate(shape.begin() + axis + 1, shape.end(), size_t(1), std::multiplies<size_t>());
+
+        if (inner == 1) {
+            const size_t nthr = static_cast<size_t>(parallel_get_max_threads());
+            if (outer < nthr && axisLen >= 2 * minScanBlock) {
+                for (size_t o = 0; o < outer; ++o)
+                    blockedScan<reverse, exclusive>(input + o * axisLen, output + o * axisLen, axisLen);
+            } else {
+                parallel_for(outer, [&](size_t o) {
+                    scanLine<reverse, exclusive>(input + o * axisLen, output + o * axisLen, axisLen, dataType(0));
+                });
+            }
+            return;
         }
-        size_t work_amount_dst = std::accumulate(iterationRange.begin(), iterationRange.end(), 1, std::multiplies<size_t>());
-        parallel_nt(0, [&](const int ithr, const int nthr) {
-            size_t start = 0, end = 0;
-            SizeVector counters(numOfDims - 1, 0);
-            splitter(work_amount_dst, nthr, ithr, start, end);
-
-            parallelItInit(start, counters, iterationRange);
-
-            for (size_t iwork = start; iwork < end; ++iwork) {
-                std::vector<size_t> forStartOffset(numOfDims);
-                forStartOffset[axis] = 0;
-                for (int64_t offsetIdx = 0, countersIdx = 0; offsetIdx < numOfDims; ++offsetIdx) {
-                    if (offsetIdx == axis) {
-                        continue;
-                    }
-                    forStartOffset[offsetIdx] = counters[countersIdx++];
-                }
-
-                size_t startOffset = getStartOffset(forStartOffset, strides);
-
-                const dataType *inputStart = input + startOffset;
-                dataType *outputStart = output + startOffset;
-
-                size_t offset = strides[axis];
-                if (reverse) {
-                    if (exclusive) {
-                        outputStart[offset*(shape[axis] - 1)] = 0;
-                        for (int64_t i = shape[axis] - 2; i >= 0; i--) {
-                            outputStart[i*offset] = inputStart[(i+1)*offset] + outputStart[(i+1)*offset];
-                        }
-                    } else {
-                        outputStart[offset*(shape[axis] - 1)] = inputStart[offset * (shape[axis] - 1)];
-                        for (int64_t i = shape[axis] - 2; i >= 0; i--) {
-                            outputStart[i*offset] = inputStart[i*offset] + outputStart[(i+1)*offset];
-                        }
-                    }
-                } else {
-                    if (exclusive) {
-                        outputStart[0] = 0;
-                        for (size_t i = 1; i < shape[axis]; i++) {
-                            outputStart[i*offset] = inputStart[(i-1)*offset] + outputStart[(i-1)*offset];
-                        }
-                    } else {
-                        outputStart[0] = inputStart[0];
-                        for (size_t i = 1; i < shape[axis]; i++) {
-                            outputStart[i*offset] = inputStart[i*offset] + outputStart[(i-1)*offset];
-                        }
-                    }
-                }
 
-                parallelItStep(counters, iterationRange);
-            }
+        const size_t innerBlocks = (inner + innerBlock - 1) / innerBlock;
+        parallel_for2d(outer, innerBlocks, [&](size_t o, size_t ib) {
+            const size_t innerStart = ib * innerBlock;
+            const size_t offset = o * axisLen * inner + innerStart;
+            scanRows<reverse, exclusive>(input + offset, output + offset, axisLen, inner, std::min<size_t>(size_t(innerBlock), inner - innerStart));
         });
     }
 
-    void parallelItInit(size_t start, std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
-        auto itCounter = counters.rbegin();
-        auto itWork = iterationRange.rbegin();
-        while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-            *itCounter = start % *itWork;
-            start /= *itWork;
-            ++itCounter;
-            ++itWork;
+    // Scans a contiguous line starting from the given carry, returns the total including the carry
+    template <bool reverse, bool exclusive, typename dataType>
+    static dataType scanLine(const dataType *input, dataType *output, size_t len, dataType sum) {
+        for (size_t step = 0; step < len; ++step) {
+            const size_t i = reverse ? len - 1 - step : step;
+            if (exclusive) {
+                output[i] = sum;
+                sum += input[i];
+            } else {
+                sum += input[i];
+                output[i] = sum;
+            }
         }
+        return sum;
     }
 
-    inline void parallelItStep(std::vector<size_t>& counters, const std::vector<size_t>& iterationRange) {
-        auto itCounter = counters.rbegin();
-        auto itWork = iterationRange.rbegin();
-
-        while (itCounter != counters.rend() && itWork != iterationRange.rend()) {
-            *itCounter = (*itCounter + 1) % *itWork;
-            if (*itCounter != 0) {
-                break;
+    // Adds the row of the previous step along the axis to the current one, each row is a contiguous chunk of the
+    // inner dimensions
+    template <bool reverse, bool exclusive, typename dataType>
+    static void scanRows(const dataType *input, dataType *output, size_t axisLen, size_t stride, size_t len) {
+        const dataType *prevIn = nullptr;
+        const dataType *prevOut = nullptr;
+        for (size_t step = 0; step < axisLen; ++step) {
+            const size_t a = reverse ? axisLen - 1 - step : step;
+            const dataType *in = input + a * stride;
+            dataType *out = output + a * stride;
+            if (step == 0) {
+                if (exclusive)
+                    std::fill(out, out + len, dataType(0));
+                else
+                    std::copy(in, in + len, out);
+            } else {
+                const dataType *addend = exclusive ? prevIn : in;
+                for (size_t j = 0; j < len; ++j)
+                    out[j] = static_cast<dataType>(prevOut[j] + addend[j]);
             }
-            ++itCounter;
-            ++itWork;
+            prevIn = in;
+            prevOut = out;
         }
     }
 
-    inline size_t getStartOffset(const std::vector<size_t> &forStartOffset, const std::vector<size_t>& strides) const {
-        size_t startOffset = 0;
-        for (size_t idx = 0; idx < forStartOffset.size(); ++idx) {
-            startOffset += forStartOffset[idx] * strides[idx];
+    // Two-pass scan of a single long line: the blocks are scanned independently and their totals are collected,
+    // then each block is shifted by the sum of the totals of the blocks preceding it in the scan direction
+    template <bool reverse, bool exclusive, typename dataType>
+    static void blockedScan(const dataType *input, dataType *output, size_t len) {
+        const size_t numBlocks = std::min(static_cast<size_t>(parallel_get_max_threads()), len / minScanBlock);
+        const size_t blockLen = (len + numBlocks - 1) / numBlocks;
+        std::vector<dataType> carries(numBlocks, dataType(0));
+
+        parallel_for(numBlocks, [&](size_t b) {
+            const size_t start = b * blockLen;
+            const size_t end = std::min(len, start + blockLen);
+            if (start < end)
+                carries[b] = scanLine<reverse, exclusive>(input + start, output + start, end - start, dataType(0));
+        });
+
+        dataType carry = dataType(0);
+        for (size_t step = 0; step < numBlocks; ++step) {
+            const size_t b = reverse ? numBlocks - 1 - step : step;
+            const dataType total = carries[b];
+            carries[b] = carry;
+            carry += total;
         }
-        return startOffset;
+
+        parallel_for(numBlocks, [&](size_t b) {
+            const size_t start = b * blockLen;
+            const size_t end = std::min(len, start + blockLen);
+            const dataType carry = carries[b];
+            if (carry == dataType(0))
+                return;
+            for (size_t i = start; i < end; ++i)
+                output[i] = static_cast<dataType>(output[i] + carry);
+        });
     }
 
     size_t getAxis(const Blob::CPtr& _axis, const Blob::CPtr& _data) const {
@@ -260,6 +270,10 @@ private:
     }
 
 private:
+    // the number of the inner elements accumulated together and the minimal block of the two-pass scan
+    static constexpr size_t innerBlock = 256;
+    static constexpr size_t minScanBlock = 4096;
+
     std::string layerName;
 };
 
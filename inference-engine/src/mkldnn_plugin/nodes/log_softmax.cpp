@@ -3,14 +3,14 @@
 //
 
 #include "base.hpp"
+#include "common/softmax.h"
 
-#include <cmath>
-#include <limits>
-#include <cfloat>
 #include <string>
 #include <vector>
-#include <cassert>
-#include "ie_parallel.hpp"
+#include <memory>
+#include <cpu/x64/cpu_isa_traits.hpp>
+
+using namespace mkldnn::impl::cpu::x64;
 
 namespace InferenceEngine {
 namespace Extensions {
@@ -36,65 +36,40 @@ public:
             if (dims.size() < static_cast<size_t>((size_t)(1) + axis))
                 THROW_IE_EXCEPTION << layer->name << " Incorrect input parameters dimensions and axis number!";
 
-            int j;
-            for (j = dims.size() - 1; j >= 0; j--) {
-                if (dims[j] != 1) break;
-            }
-            if (j == axis) is_last_dim = true;
-
             for (int i = 0; i < axis; i++)
                 axis_step *= dims[i];
             reduced_axis_size = dims[axis];
             for (size_t i = (axis + 1); i < dims.size(); i++)
                 reduced_axis_stride *= dims[i];
 
-            addConfig(layer, { { ConfLayout::PLN, false, 0, Precision::FP32 } }, { { ConfLayout::PLN, false, 0, Precision::FP32 } });
+            Precision precision = layer->insData[0].lock()->getTensorDesc().getPrecision();
+            if (precision != Precision::BF16 || !mayiuse(avx512_core))
+                precision = Precision::FP32;
+
+            softmax_kernel = std::make_shared<SoftmaxGeneric>(precision, precision, true);
+
+            addConfig(layer, { DataConfigurator(ConfLayout::PLN, precision) }, { DataConfigurator(ConfLayout::PLN, precision) });
         } catch (InferenceEngine::details::InferenceEngineException &ex) {
             errorMsg = ex.what();
         }
     }
 
     StatusCode execute(std::vector<Blob::Ptr>& inputs, std::vector<Blob::Ptr>& outputs, ResponseDesc *resp) noexcept override {
-        const float *src_data = inputs[0]->cbuffer().as<float *>() +
-            inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-        float* dst_data = outputs[0]->buffer().as<float *>() +
-            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding();
-
-        if (is_last_dim) {
-            parallel_for(axis_step, [&](size_t i) {
-                const float *src_dataPtr = &src_data[i * reduced_axis_size];
-                float *dst_dataPtr = &dst_data[i * reduced_axis_size];
-
-                float reduce_prod = 0.0f;
-                const float max = *std::max_element(src_dataPtr, src_dataPtr + reduced_axis_size);
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    reduce_prod += expf(src_dataPtr[j] - max);
-
-                reduce_prod = logf(reduce_prod);
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    dst_dataPtr[j] = src_dataPtr[j] - max - reduce_prod;
-            });
-        } else {
-            parallel_for2d(axis_step, reduced_axis_stride, [&](size_t k, size_t i) {
-                const float *src_dataPtr = &src_data[k * reduced_axis_stride * reduced_axis_size + i];
-                float *dst_dataPtr = &dst_data[k * reduced_axis_stride * reduced_axis_size + i];
-
-                float reduce_prod = 0.0f;
-                float max = std::numeric_limits<float>::min();
-                for (size_t j = 0; j < reduced_axis_size; ++j) {
-                    if (src_dataPtr[j * reduced_axis_stride] > max)
-                        max = src_dataPtr[j * reduced_axis_stride];
-                }
-
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    reduce_prod += expf(src_dataPtr[j * reduced_axis_stride] - max);
-
-                reduce_prod = logf(reduce_prod);
-                for (size_t j = 0; j < reduced_axis_size; ++j)
-                    dst_dataPtr[j * reduced_axis_stride] = src_dataPtr[j * reduced_axis_stride] - max - reduce_prod;
-            });
-        }
+        const auto *src_data = inputs[0]->cbuffer().as<const uint8_t *>() +
+            inputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding() * inputs[0]->getTensorDesc().getPrecision().size();
+        auto *dst_data = outputs[0]->buffer().as<uint8_t *>() +
+            outputs[0]->getTensorDesc().getBlockingDesc().getOffsetPadding() * outputs[0]->getTensorDesc().getPrecision().size();
 
+        try {
+            softmax_kernel->execute(src_data, dst_data, axis_step, reduced_axis_size, 1, reduced_axis_stride);
+        }
+        catch (const std::exception& excp) {
+            snprintf(resp->msg, sizeof(resp->msg), "%s", excp.what());
+            return GENERAL_ERROR;
+        }
+        catch(...) {
+            return GENERAL_ERROR;
+        }
         return OK;
     }
 
@@ -102,7 +77,7 @@ private:
     size_t reduced_axis_size;
     size_t reduced_axis_stride = 1;
     size_t axis_step = 1;
-    bool is_last_dim = false;
+    std::shared_ptr<SoftmaxGeneric> softmax_kernel;
 };
 
 REG_FACTORY_FOR(LogSoftmaxImpl, LogSoftmax);
@@ -124,6 +124,8 @@ struct jit_uni_eltwise_generic : public MKLDNNPlugin::jit_uni_eltwise_kernel, pu
             }
         }
 
+        init_post_ops_registers();
+
         if (!mayiuse(avx512_core_bf16) && mayiuse(avx512_core))
             emu_vcvtneps2bf16.reset(new jit_emu_vcvtneps2bf16(this, isa, nullptr));
 
@@ -349,6 +351,13 @@ private:
 
     std::vector<std::shared_ptr<jit_uni_quantization_injector_f32<isa>>> quantization_injectors = {};
 
+    // Registers of the fused Eltwise operations operands except the first one which is always taken from vmm_dst
+    std::vector<std::vector<size_t>> post_op_src_regs = {};
+    // Register to be moved to vmm_dst before the fused operation if its first operand isn't the previous result
+    std::vector<int> post_op_first_src_regs = {};
+    // Registers which keep the subgraph results consumed by non-adjacent operations (-1 for the others)
+    std::vector<int> result_regs = {};
+
     std::vector<Precision> exec_precisions_priority = {
         Precision::U8,
         Precision::I8,
@@ -475,6 +484,62 @@ private:
         return ctx.emitter;
     }
 
+    void init_post_ops_registers() {
+        const auto& fusedWith = eltwiseNode.getFusedWith();
+        const auto& fusedInputs = eltwiseNode.getFusedInputs();
+
+        post_op_src_regs.assign(fusedWith.size(), {});
+        post_op_first_src_regs.assign(fusedWith.size(), -1);
+        result_regs.assign(fusedWith.size() + 1, -1);
+
+        if (fusedInputs.size() != fusedWith.size()) {
+            // Linear chain: every fused Eltwise operation takes the previous result and the next inputs of the node
+            size_t input_idx = eltwise_emitter->get_inputs_num();
+            for (int i = 0; i < fusedWith.size(); i++) {
+                if (fusedWith[i]->getType() != Eltwise)
+                    continue;
+
+                auto& postOpNode = dynamic_cast<const MKLDNNEltwiseNode&>(*fusedWith[i]);
+                for (int j = 1; j < postOpNode.getOpInputsNum(); j++)
+                    post_op_src_regs[i].push_back(input_idx++);
+            }
+            return;
+        }
+
+        // Subgraph: the results consumed by non-adjacent operations are kept in the registers following the inputs ones
+        size_t reg_idx = jep_.inputs_number;
+        auto get_result_reg = [&](int result) {
+            if (result_regs[result] < 0)
+                result_regs[result] = reg_idx++;
+            return result_regs[result];
+        };
+
+        for (int i = 0; i < fusedWith.size(); i++) {
+            const auto& inputs = fusedInputs[i];
+            auto first_src = std::find_if(inputs.begin(), inputs.end(), [](int src) { return src < 0; });
+            if (first_src == inputs.end())
+                THROW_IE_EXCEPTION << "Eltwise node with name `" << eltwiseNode.getName() << "` has fused operation which doesn't consume subgraph results";
+
+            int first_result = -*first_src - 1;
+            if (first_result != i)
+                post_op_first_src_regs[i] = get_result_reg(first_result);
+
+            for (auto src = inputs.begin(); src != inputs.end(); src++) {
+                if (src != first_src)
+                    post_op_src_regs[i].push_back(*src >= 0 ? *src : get_result_reg(-*src - 1));
+            }
+        }
+
+        if (reg_idx > MAX_ELTWISE_INPUTS)
+            THROW_IE_EXCEPTION << "Eltwise jitter doesn't have enough registers for fused subgraph of Eltwise node with name `"
+                               << eltwiseNode.getName() << "`";
+    }
+
+    inline void save_result(int result) {
+        if (result_regs[result] >= 0)
+            uni_vmovups(get_vmm_reg(result_regs[result]), vmm_dst);
+    }
+
     inline void compute_eltwise_op() {
         std::vector<size_t> in_idxs;
         std::vector<size_t> aux_idxs;
@@ -487,19 +552,23 @@ private:
         out_idxs.push_back(vmm_dst.getIdx());
 
         eltwise_emitter->emit_code(in_idxs, out_idxs, aux_idxs);
+
+        save_result(0);
     }
 
     inline void apply_post_ops(bool is_scalar, int offset = 0) {
-        int input_idx = eltwise_emitter->get_inputs_num();
         int eltwise_post_op_idx = 0;
         int quantization_post_op_idx = 0;
         for (int i = 0; i < eltwiseNode.getFusedWith().size(); i++) {
+            if (post_op_first_src_regs[i] >= 0)
+                uni_vmovups(vmm_dst, get_vmm_reg(post_op_first_src_regs[i]));
+
             if (eltwiseNode.getFusedWith()[i].get()->getType() == Eltwise) {
                 std::vector<size_t> in_idxs;
                 std::vector<size_t> aux_idxs;
                 in_idxs.push_back(vmm_dst.getIdx());
-                for (int j = 1; j < post_op_emitters[eltwise_post_op_idx]->get_inputs_num(); j++)
-                    in_idxs.push_back(get_vmm_reg(input_idx++).getIdx());
+                for (auto src_reg : post_op_src_regs[i])
+                    in_idxs.push_back(get_vmm_reg(src_reg).getIdx());
                 for (int j = 0; j < post_op_emitters[eltwise_post_op_idx]->aux_vecs_count(); j++)
                     aux_idxs.push_back(get_aux_vmm(j).getIdx());
 
@@ -528,6 +597,8 @@ private:
 
                 quantization_post_op_idx++;
             }
+
+            save_result(i + 1);
         }
     }
 
@@ -1032,11 +1103,21 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
 
     canUseOptimizedImpl = mayiuse(x64::sse41);
 
+    // Operands of the fused subgraph operations which are results of the subgraph or reuse existing input ports don't
+    // add inputs, the new input ports are numbered in the order of the operations
+    bool isSubgraph = fusedInputs.size() == fusedWith.size();
+    auto isNewInputPort = [&](size_t fusedIdx, size_t port, size_t inputsNum) {
+        return !isSubgraph ? port > 0 : fusedInputs[fusedIdx][port] == static_cast<int>(inputsNum);
+    };
+
     size_t expectedInputsNum = getOpInputsNum();
-    for (auto& postOp : fusedWith) {
-        auto* eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode*>(postOp.get());
+    for (size_t i = 0; i < fusedWith.size(); i++) {
+        auto* eltwiseNode = dynamic_cast<const MKLDNNEltwiseNode*>(fusedWith[i].get());
         if (eltwiseNode != nullptr) {
-            expectedInputsNum += eltwiseNode->getOpInputsNum() - 1;
+            for (size_t j = 0; j < eltwiseNode->getOpInputsNum(); j++) {
+                if (isNewInputPort(i, j, expectedInputsNum))
+                    expectedInputsNum++;
+            }
         }
     }
     if (getParentEdges().size() > MAX_ELTWISE_INPUTS)
@@ -1052,10 +1133,11 @@ void MKLDNNEltwiseNode::initSupportedPrimitiveDescriptors() {
         inputPrecisions.push_back(getCnnLayer()->insData[i].lock()->getPrecision());
     }
 
-    for (auto& fusedNode : fusedWith) {
-        if (fusedNode->getType() == Eltwise) {
-            for (int i = 1; i < fusedNode->getCnnLayer()->insData.size(); i++) {
-                inputPrecisions.push_back(fusedNode->getCnnLayer()->insData[i].lock()->getPrecision());
+    for (size_t i = 0; i < fusedWith.size(); i++) {
+        if (fusedWith[i]->getType() == Eltwise) {
+            for (size_t j = 0; j < fusedWith[i]->getCnnLayer()->insData.size(); j++) {
+                if (isNewInputPort(i, j, inputPrecisions.size()))
+                    inputPrecisions.push_back(fusedWith[i]->getCnnLayer()->insData[j].lock()->getPrecision());
             }
         }
     }
@@ -1774,7 +1856,7 @@ void MKLDNNEltwiseNode::appendPostOps(mkldnn::post_ops& ops) {
     }
 }
 
-bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node) const {
+bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node, bool fusedOnPort0) const {
     auto isOneOf = [](EltwiseOpType alg, std::vector<EltwiseOpType> algs) {
         for (auto a : algs) {
             if (alg == a) {
@@ -1807,20 +1889,16 @@ bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node) const {
         return false;
     }
 
-    // FQ inputs with quantization parameters will be hided inside post_op object, so will not increase inputs number
-    size_t addedInputEdgesNum = node->getType() != Quantize ? (node->getParentEdges().size() - 1) : 0;
-    if (getParentEdges().size() + addedInputEdgesNum > MAX_ELTWISE_INPUTS)
-        return false;
-
     if (node->getType() == Eltwise) {
         auto eltwiseNode = dynamic_cast<MKLDNNEltwiseNode*>(node.get());
-        if (eltwiseNode->getParentEdgesAtPort(0)[0]->getParent().get() != this) {
+        if (!fusedOnPort0) {
             if (!isSuitableNode(this)) {
                 return false;
             }
 
             // Eltwise jitter doesn't respect commutative property, so fusing is disabled in case it applied not for 0-th port.
-            if (isOneOf(eltwiseNode->getOpType(), {Subtract, Divide, FloorMod, Mod, PowerDynamic, Greater, GreaterEqual, Less, LessEqual})) {
+            if (isOneOf(eltwiseNode->getOpType(), {Subtract, Divide, FloorMod, Mod, PowerDynamic, MulAdd, Prelu,
+                                                Greater, GreaterEqual, Less, LessEqual})) {
                 return false;
             }
 
@@ -1840,12 +1918,20 @@ bool MKLDNNEltwiseNode::canFuse(const MKLDNNNodePtr& node) const {
         auto *quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
         if (quantizeNode == nullptr)
             THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
-        return !quantizeNode->isBinarization();
+        return fusedOnPort0 && !quantizeNode->isBinarization();
     }
 
     return false;
 }
 
+void MKLDNNEltwiseNode::fuseSubgraphOperation(const MKLDNNNodePtr& node, const std::vector<int>& inputs) {
+    if (fusedInputs.size() != fusedWith.size())
+        THROW_IE_EXCEPTION << "Eltwise node with name `" << getName() << "` can't mix fused subgraph and post operations";
+
+    fuseWith(node);
+    fusedInputs.push_back(inputs);
+}
+
 InferenceEngine::Precision MKLDNNEltwiseNode::getRuntimePrecision() const {
     std::vector<InferenceEngine::Precision> inputPrecisions;
     // Don't take bias precision into account
@@ -122,7 +122,20 @@ public:
     bool isSum();
     bool isWithBroadcast();
 
-    bool canFuse(const MKLDNNNodePtr& node) const;
+    /**
+     * Checks whether the node can be computed by the JIT kernel of this node as an operation of the fused subgraph.
+     * 'fusedOnPort0' tells whether the 0-th operand of the node is a result of the subgraph.
+     */
+    bool canFuse(const MKLDNNNodePtr& node, bool fusedOnPort0) const;
+
+    /**
+     * Fuses the operation of the elementwise subgraph computed by this node. 'inputs' holds the sources of the operands
+     * of the Eltwise node in the port order (only the 0-th operand for Quantize): a non-negative value is an input port
+     * of this node, a negative value -(k + 1) is the result of the k-th operation of the subgraph, where 0 is the
+     * operation of this node itself and k > 0 is getFusedWith()[k - 1].
+     */
+    void fuseSubgraphOperation(const MKLDNNNodePtr& node, const std::vector<int>& inputs);
+    const std::vector<std::vector<int>>& getFusedInputs() const { return fusedInputs; }
 
     size_t getOpInputsNum() const;
     EltwiseOpType getOpType() const { return eltwiseOp; }
@@ -166,6 +179,9 @@ private:
     std::vector<float> scales = {};
     std::vector<float> shifts = {};
 
+    // Operand sources of the fused operations (see fuseSubgraphOperation), empty for a linear chain of post operations
+    std::vector<std::vector<int>> fusedInputs = {};
+
     inline void executeOptimized6D(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
     inline void executeOptimizedGeneric(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
     inline void executeReference(const std::vector<const uint8_t *>& src_ptrs, uint8_t *dst_ptr);
@@ -1375,6 +1375,34 @@ bool MKLDNNMVNNode::checkAxesSuitability(const std::shared_ptr<const ngraph::Nod
     return false;
 }
 
+bool MKLDNNMVNNode::canFuseSimpleOperation(const MKLDNNNodePtr& node) const {
+    if (inDims[0].ndims() != 4 && inDims[0].ndims() != 5)
+        return false;
+
+    auto *mvnLayer = dynamic_cast<MVNLayer *>(getCnnLayer().get());
+    if (mvnLayer == nullptr)
+        THROW_IE_EXCEPTION << "Cannot get MVN layer " << getName();
+    if (mvnLayer->across_channels != 0 || mvnLayer->normalize != 1)
+        return false;
+
+    if (node->getType() == Quantize) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode*>(node.get());
+        if (quantizeNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get quantize layer " << node->getName();
+        return !quantizeNode->isBinarization();
+    } else if (node->getType() == Eltwise) {
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode == nullptr)
+            THROW_IE_EXCEPTION << "Cannot get eltwise node " << node->getName();
+
+        return ((eltwiseNode->getOpType() == MulAdd) ||
+                (eltwiseNode->getOpType() == Prelu) ||
+                 eltwiseNode->getOpType() == Relu);
+    }
+
+    return false;
+}
+
 bool MKLDNNMVNNode::created() const {
     return getType() == MVN;
 }
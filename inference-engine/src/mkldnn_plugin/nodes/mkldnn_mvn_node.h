@@ -84,6 +84,7 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const override;
 
     static bool checkAxesSuitability(const std::shared_ptr<const ngraph::Node>&);
 
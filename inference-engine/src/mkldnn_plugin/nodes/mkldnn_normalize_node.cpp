@@ -16,6 +16,7 @@
 #include <cpu/x64/jit_uni_depthwise_injector.hpp>
 #include <cpu/x64/jit_uni_quantization_injector.hpp>
 #include "common/cpu_memcpy.h"
+#include "common/fused_post_ops.h"
 #include "nodes/common/cpu_convert.h"
 #include <mkldnn_selective_build.h>
 
@@ -1521,6 +1522,10 @@ inline void MKLDNNNormalizeNode::apply_post_ops_scalar(float &dst_value, int ind
     }
 }
 
+bool MKLDNNNormalizeNode::canFuseSimpleOperation(const MKLDNNNodePtr& node) const {
+    return canBeExecutedAsPostOp(node);
+}
+
 bool MKLDNNNormalizeNode::created() const {
     return getType() == Normalize;
 }
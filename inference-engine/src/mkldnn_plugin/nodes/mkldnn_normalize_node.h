@@ -86,6 +86,7 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const override;
 
 private:
     template<typename T>
@@ -80,6 +80,7 @@ public:
     void execute(mkldnn::stream strm) override;
 
     size_t getAxis() const { return axis; }
+    int getLevels() const { return levels; }
 
     bool isBinarization() const { return quantizeOpType == QuantizeOpType::Binarization; }
     QuantizeOpType getOpType() const { return quantizeOpType; }
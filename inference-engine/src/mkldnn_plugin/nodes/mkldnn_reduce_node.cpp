@@ -5,6 +5,8 @@
 #include "mkldnn_reduce_node.h"
 
 #include "mkldnn_quantize_node.h"
+#include "mkldnn_eltwise_node.h"
+#include "common/fused_post_ops.h"
 #include <legacy/ie_layers.h>
 #include <mkldnn.hpp>
 #include <string>
@@ -1370,20 +1372,12 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
-    static const Precision supportedPrecisions[] = {
-            Precision::FP32,
-            Precision::BF16,
-            Precision::I32,
-            Precision::I8,
-            Precision::U8
-    };
+    setPostOps(attr, true);
 
     Precision inputPrecision = getCnnLayer()->insData[REDUCE_DATA].lock()->getPrecision();
     Precision outputPrecision = getCnnLayer()->outData[0]->getPrecision();
 
-    jit_mode = (mayiuse(cpu::x64::sse41)) && getParentEdgeAt(REDUCE_DATA)->getDims().ndims() <= 5 &&
-               std::find(std::begin(supportedPrecisions), std::end(supportedPrecisions), inputPrecision) != std::end(supportedPrecisions) &&
-               std::find(std::begin(supportedPrecisions), std::end(supportedPrecisions), outputPrecision) != std::end(supportedPrecisions);
+    jit_mode = is_jit_supported(inputPrecision, outputPrecision);
 
     if (jit_mode) {
         // Since in jit mode we use the output memory as an intermediate accumulator for certain reduce modes, we can't use BF16 output precision due to
@@ -1398,6 +1392,16 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
         }
     }
 
+    // The reduction result is kept in FP32 when there are fused operations, they write the output in the precision of
+    // the last fused node.
+    Precision postOpsOutputPrecision = outputPrecision;
+    if (!fusedWith.empty()) {
+        outputPrecision = Precision::FP32;
+        postOpsOutputPrecision = fusedWith.back()->getCnnLayer()->outData[0]->getPrecision();
+        if (postOpsOutputPrecision == Precision::BF16 && !mayiuse(avx512_core))
+            postOpsOutputPrecision = Precision::FP32;
+    }
+
     auto inputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(inputPrecision);
     auto outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(outputPrecision);
 
@@ -1405,6 +1409,7 @@ void MKLDNNReduceNode::initSupportedPrimitiveDescriptors() {
     output_prec = outputPrecision;
     src_data_size = MKLDNNExtensionUtils::sizeOfDataType(inputDataType);
     dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(outputDataType);
+    outputDataType = MKLDNNExtensionUtils::IEPrecisionToDataType(postOpsOutputPrecision);
 
     InferenceEngine::LayerConfig config;
     config.dynBatchSupport = false;
@@ -1473,7 +1478,8 @@ void MKLDNNReduceNode::createPrimitive() {
 
     auto jcp = jit_reduce_config_params();
     jcp.src_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().inConfs[REDUCE_DATA].desc.getPrecision());
-    jcp.dst_dt = MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().outConfs[0].desc.getPrecision());
+    jcp.dst_dt = fusedWith.empty() ? MKLDNNExtensionUtils::IEPrecisionToDataType(selectedPD->getConfig().outConfs[0].desc.getPrecision()) :
+                                     memory::data_type::f32;
     jcp.src_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.src_dt);
     jcp.dst_data_size = MKLDNNExtensionUtils::sizeOfDataType(jcp.dst_dt);
     jcp.planar_layout = planar_layout;
@@ -1500,6 +1506,17 @@ void MKLDNNReduceNode::createPrimitive() {
         reduce_post_kernel->create_ker();
 
     jit_mode = jit_mode && reduce_kernel;
+
+    if (!fusedWith.empty()) {
+        if (!jit_mode)
+            THROW_IE_EXCEPTION << "Reduce layer with name " << getName() << " supports fused operations only in jit mode.";
+
+        Precision postOpsOutputPrecision = selectedPD->getConfig().outConfs[0].desc.getPrecision();
+        post_ops_dst_data_size = postOpsOutputPrecision.size();
+        post_ops_executor = std::make_shared<FusedPostOps>(attr, Precision::FP32, postOpsOutputPrecision, planar_layout,
+                                                           planar_layout ? 1 : blk_size);
+        intermediate_buffer.resize(dstMemPtr->GetElementsCount() * sizeof(float));
+    }
 }
 
 void MKLDNNReduceNode::execute(mkldnn::stream strm) {
@@ -1542,7 +1559,11 @@ void MKLDNNReduceNode::execute(mkldnn::stream strm) {
     const uint8_t *src_data = reinterpret_cast<const uint8_t *>(srcMemPtr->GetPtr());
     uint8_t *dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->GetPtr());
     if (jit_mode) {
-        reduce_type(src_data, dst_data, dst_size);
+        if (post_ops_executor) {
+            reduce_type(src_data, intermediate_buffer.data(), intermediate_buffer.size(), dst_data);
+        } else {
+            reduce_type(src_data, dst_data, dst_size, nullptr);
+        }
     } else {
         if (planar_layout) {
             auto in_ptr = reinterpret_cast<const float *>(src_data);
@@ -1554,7 +1575,7 @@ void MKLDNNReduceNode::execute(mkldnn::stream strm) {
     }
 }
 
-void MKLDNNReduceNode::reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size) {
+void MKLDNNReduceNode::reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size, uint8_t *post_ops_dst_ptr) {
     init_dst_data(out_ptr, dst_size);
 
     if (planar_layout) {
@@ -1567,6 +1588,8 @@ void MKLDNNReduceNode::reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size
             reduce_BLK(in_ptr, out_ptr);
         }
     }
+
+    reduce_kernel_post_process(out_ptr, post_ops_dst_ptr);
 }
 
 void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
@@ -1626,8 +1649,6 @@ void MKLDNNReduceNode::reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr) {
             }
         }
     }
-
-    reduce_kernel_post_process(out_ptr);
 }
 
 void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
@@ -1676,8 +1697,6 @@ void MKLDNNReduceNode::reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr) {
             }
         }
     }
-
-    reduce_kernel_post_process(out_ptr);
 }
 
 void MKLDNNReduceNode::reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t *out_ptr) {
@@ -1760,8 +1779,6 @@ void MKLDNNReduceNode::reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t
             }
         }
     }
-
-    reduce_kernel_post_process(out_ptr);
 }
 
 inline void MKLDNNReduceNode::reduce_kernel_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount, size_t reduce_w) {
@@ -1773,7 +1790,7 @@ inline void MKLDNNReduceNode::reduce_kernel_process(const uint8_t *in_p, uint8_t
     (*reduce_kernel)(&arg);
 }
 
-inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr) {
+inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr, uint8_t *post_ops_dst_ptr) {
     const float divisor = static_cast<float>(IB * IC * ID * IH * IW / (OB * OC * OD * OH * OW));
     if (planar_layout) {
         size_t parallel_amount = OB * OC * OD;
@@ -1785,6 +1802,9 @@ inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr) {
             arg.work_amount = OH * OW;
             arg.divisor = &divisor;
             (*reduce_post_kernel)(&arg);
+            // the fused operations are applied while the chunk is still in cache
+            if (post_ops_executor)
+                post_ops_executor->execute(out_p, post_ops_dst_ptr + i * OH * OW * post_ops_dst_data_size, OH * OW, (i / OD) % OC);
         });
     } else {
         size_t OCB = div_up(OC, blk_size);
@@ -1797,6 +1817,9 @@ inline void MKLDNNReduceNode::reduce_kernel_post_process(uint8_t *out_ptr) {
             arg.work_amount = OH * OW * blk_size;
             arg.divisor = &divisor;
             (*reduce_post_kernel)(&arg);
+            if (post_ops_executor)
+                post_ops_executor->execute(out_p, post_ops_dst_ptr + i * OH * OW * blk_size * post_ops_dst_data_size, OH * OW,
+                                           (i / OD) % OCB * blk_size);
         });
     }
 }
@@ -2039,6 +2062,53 @@ inline void MKLDNNReduceNode::reduce_ref_map(float *out_ptr, size_t work_amount_
     }
 }
 
+bool MKLDNNReduceNode::is_jit_supported(Precision inputPrecision, Precision outputPrecision) const {
+    static const Precision supportedPrecisions[] = {
+            Precision::FP32,
+            Precision::BF16,
+            Precision::I32,
+            Precision::I8,
+            Precision::U8
+    };
+
+    return (mayiuse(cpu::x64::sse41)) && getParentEdgeAt(REDUCE_DATA)->getDims().ndims() <= 5 &&
+           std::find(std::begin(supportedPrecisions), std::end(supportedPrecisions), inputPrecision) != std::end(supportedPrecisions) &&
+           std::find(std::begin(supportedPrecisions), std::end(supportedPrecisions), outputPrecision) != std::end(supportedPrecisions);
+}
+
+bool MKLDNNReduceNode::canFuseSimpleOperation(const MKLDNNNodePtr& node) const {
+    // the channel of the fused operations is the second output dimension, it is kept only with keep_dims
+    // for the 4D and 5D inputs the kernels are called for
+    const auto &layer = getCnnLayer();
+    const size_t ndims = getParentEdgeAt(REDUCE_DATA)->getDims().ndims();
+    if (!layer->GetParamAsBool("keep_dims", false) || (ndims != 4 && ndims != 5))
+        return false;
+
+    if (!is_jit_supported(layer->insData[REDUCE_DATA].lock()->getPrecision(), layer->outData[0]->getPrecision()))
+        return false;
+
+    return canBeExecutedAsPostOp(node);
+}
+
+void MKLDNNReduceNode::setPostOps(mkldnn::primitive_attr &attr, bool initWeights) {
+    mkldnn::post_ops ops;
+    for (auto &node : fusedWith) {
+        auto* quantizeNode = dynamic_cast<MKLDNNQuantizeNode *>(node.get());
+        if (quantizeNode) {
+            quantizeNode->appendPostOps(ops);
+            continue;
+        }
+
+        auto* eltwiseNode = dynamic_cast<MKLDNNEltwiseNode *>(node.get());
+        if (eltwiseNode) {
+            eltwiseNode->appendPostOps(ops);
+            continue;
+        }
+        THROW_IE_EXCEPTION << "Fusing of " << NameFromType(node->getType()) << " operation to " << NameFromType(this->getType()) << " node is not implemented";
+    }
+    attr.set_post_ops(ops);
+}
+
 bool MKLDNNReduceNode::created() const {
     return getType() == ReduceAnd || getType() == ReduceL1 || getType() == ReduceL2 ||
            getType() == ReduceLogSum || getType() == ReduceLogSumExp || getType() == ReduceMax ||
@@ -61,6 +61,8 @@ struct jit_uni_reduce_kernel {
     jit_reduce_config_params jcp_;
 };
 
+class FusedPostOps;
+
 struct jit_uni_reduce_post_kernel {
     void (*ker_)(const jit_reduce_call_args *);
 
@@ -90,19 +92,22 @@ public:
     bool canBeInPlace() const override {
         return false;
     }
+    bool canFuseSimpleOperation(const MKLDNNNodePtr& node) const override;
 
 private:
-    void reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size);
+    void reduce_type(const uint8_t *in_ptr, uint8_t *out_ptr, size_t dst_size, uint8_t *post_ops_dst_ptr);
     void reduce_PLN(const uint8_t *in_ptr, uint8_t *out_ptr);
     void reduce_BLK(const uint8_t *in_ptr, uint8_t *out_ptr);
     void reduce_BLK_concern_padding(const uint8_t *in_ptr, uint8_t *out_ptr);
     inline void reduce_kernel_process(const uint8_t *in_p, uint8_t *out_p, size_t work_amount, size_t reduce_w = 2);
-    inline void reduce_kernel_post_process(uint8_t *out_ptr);
+    inline void reduce_kernel_post_process(uint8_t *out_ptr, uint8_t *post_ops_dst_ptr);
     inline void init_dst_data(uint8_t *out_ptr, size_t dst_size);
     inline void calc_process_dst_dims(const int32_t *idx_data);
     inline void reduce_ref(const float *in_ptr, float *out_ptr);
     void reduce_ref_process(const float *in_ptr, float *out_ptr, float init_value, std::function<float(float, float)> func);
     inline void reduce_ref_map(float *out_ptr, size_t work_amount_dst, size_t reduced_dims_work_amount);
+    bool is_jit_supported(InferenceEngine::Precision inputPrecision, InferenceEngine::Precision outputPrecision) const;
+    void setPostOps(mkldnn::primitive_attr &attr, bool initWeights = false);
 
     Reduce reduceMode = Reduce::Sum;
     size_t blk_size;
@@ -124,6 +129,12 @@ private:
 
     std::shared_ptr<jit_uni_reduce_kernel> reduce_kernel;
     std::shared_ptr<jit_uni_reduce_post_kernel> reduce_post_kernel;
+
+    // the fused operations are applied to the FP32 reduction result right after its post processing
+    mkldnn::primitive_attr attr;
+    std::shared_ptr<FusedPostOps> post_ops_executor;
+    std::vector<uint8_t> intermediate_buffer;
+    size_t post_ops_dst_data_size = 0;
 };
 
 }  // namespace MKLDNNPlugin
@@ -7,7 +7,11 @@
 
 #include "utils/general_utils.h"
 #include "nodes/common/cpu_memcpy.h"
+#include "rnn_quantize_imp.hpp"
+#include <ie_parallel.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <string>
 #include <utility>
 
@@ -73,6 +77,12 @@ MKLDNNRNN::MKLDNNRNN(const InferenceEngine::CNNLayerPtr& layer, const mkldnn::en
     is_cell = one_of(layer->type, "LSTMCell", "GRUCell", "RNNCell");
 }
 
+void MKLDNNRNN::setInputQuantization(float scale, float shift) {
+    isInt8 = true;
+    dataScale = scale;
+    dataShift = shift;
+}
+
 bool MKLDNNRNN::created() const {
     return getType() == (is_cell ? RNNCell : RNNSeq);
 }
@@ -161,8 +171,8 @@ void MKLDNNRNN::fillCellDesc() {
         out_states_d.emplace_back(S_4D_shape, memory::data_type::f32, memory::format_tag::ldnc);
     }
 
-    in_data_d  = {{T, N, DC}, memory::data_type::f32, memory::format_tag::tnc};;
-    out_data_d = {{T, N, SC}, memory::data_type::f32, memory::format_tag::tnc};;
+    in_data_d  = {{T, N, DC}, isInt8 ? memory::data_type::u8 : memory::data_type::f32, memory::format_tag::tnc};
+    out_data_d = {{T, N, SC}, memory::data_type::f32, memory::format_tag::tnc};
 
     w_data_d   = {{L, D, DC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo};
     w_state_d  = {{L, D, SC, G, SC}, memory::data_type::f32, memory::format_tag::ldigo};
@@ -284,12 +294,12 @@ void MKLDNNRNN::fillSeqDesc() {
         w_bias_d = {{L, D, Gb, SC}, memory::data_type::f32, memory::format_tag::ldgo};
 
     // Try to create descriptor and corresponding configuration
-    in_data_d = {in_data_dims, memory::data_type::f32, memory::format_tag::tnc};
+    in_data_d = {in_data_dims, isInt8 ? memory::data_type::u8 : memory::data_type::f32, memory::format_tag::tnc};
     out_data_d = {out_data_dims, memory::data_type::f32, memory::format_tag::tnc};
 
     std::vector<TensorDesc> in_candidate;
     if (nativeOrder)
-        in_candidate.push_back(in_data_d);
+        in_candidate.push_back(MKLDNNMemoryDesc{in_data_dims, memory::data_type::f32, memory::format_tag::tnc});
     else
         in_candidate.push_back(MKLDNNMemoryDesc{{N, T, DC}, memory::data_type::f32, memory::format_tag::ntc});
 
@@ -310,62 +320,73 @@ void MKLDNNRNN::fillSeqDesc() {
     createDescriptor(in_candidate, out_candidate);
 }
 
-void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
-                                 const std::vector<TensorDesc> &outputDesc) {
+MKLDNNDescriptor MKLDNNRNN::createRNNDescriptor(const MKLDNNMemoryDesc& inData, const std::vector<MKLDNNMemoryDesc>& inStates,
+                                                const MKLDNNMemoryDesc& outData, const std::vector<MKLDNNMemoryDesc>& outStates) const {
+    // INT8 primitive chooses the s8 weights layout itself, weights are quantized into it in createPrimitive()
+    const MKLDNNMemoryDesc w_data_prim_d = isInt8 ? MKLDNNMemoryDesc{w_data_d.getDims(), memory::data_type::s8, memory::format_tag::any}
+                                                  : w_data_d;
+    const MKLDNNMemoryDesc w_state_prim_d = isInt8 ? MKLDNNMemoryDesc{w_state_d.getDims(), memory::data_type::s8, memory::format_tag::any}
+                                                   : w_state_d;
+
     switch (cell_type) {
         case mkldnn::algorithm::vanilla_rnn: {
             MKLDNNDescriptor desc(std::shared_ptr<vanilla_rnn_forward::desc>(
                     new vanilla_rnn_forward::desc(prop_kind::forward_scoring, cell_act, direction,
-                            /* In Data       */ in_data_d,
-                            /* In State      */ in_states_d[0],
-                            /* Weights data  */ w_data_d,
-                            /* Weights state */ w_state_d,
+                            /* In Data       */ inData,
+                            /* In State      */ inStates[0],
+                            /* Weights data  */ w_data_prim_d,
+                            /* Weights state */ w_state_prim_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d,
-                            /* Out State     */ out_states_d[0])));
-            descs.push_back(desc);
-        } break;
+                            /* Out Data      */ outData,
+                            /* Out State     */ outStates[0])));
+            return desc;
+        }
         case mkldnn::algorithm::vanilla_gru: {
             MKLDNNDescriptor desc(std::shared_ptr<gru_forward::desc>(
                     new gru_forward::desc(prop_kind::forward_scoring, direction,
-                            /* In Data       */ in_data_d,
-                            /* In State      */ in_states_d[0],
-                            /* Weights data  */ w_data_d,
-                            /* Weights state */ w_state_d,
+                            /* In Data       */ inData,
+                            /* In State      */ inStates[0],
+                            /* Weights data  */ w_data_prim_d,
+                            /* Weights state */ w_state_prim_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d,
-                            /* Out State     */ out_states_d[0])));
-            descs.push_back(desc);
-        } break;
+                            /* Out Data      */ outData,
+                            /* Out State     */ outStates[0])));
+            return desc;
+        }
         case mkldnn::algorithm::lbr_gru: {
             MKLDNNDescriptor desc(std::shared_ptr<lbr_gru_forward::desc>(
                     new lbr_gru_forward::desc(prop_kind::forward_scoring, direction,
-                            /* In Data       */ in_data_d,
-                            /* In State      */ in_states_d[0],
-                            /* Weights data  */ w_data_d,
-                            /* Weights state */ w_state_d,
+                            /* In Data       */ inData,
+                            /* In State      */ inStates[0],
+                            /* Weights data  */ w_data_prim_d,
+                            /* Weights state */ w_state_prim_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d,
-                            /* Out State     */ out_states_d[0])));
-            descs.push_back(desc);
-        } break;
+                            /* Out Data      */ outData,
+                            /* Out State     */ outStates[0])));
+            return desc;
+        }
         case mkldnn::algorithm::vanilla_lstm: {
             MKLDNNDescriptor desc(std::shared_ptr<lstm_forward::desc>(
                     new lstm_forward::desc(prop_kind::forward_scoring, direction,
-                            /* In Data       */ in_data_d,
-                            /* In State H    */ in_states_d[0],
-                            /* In State C    */ in_states_d[1],
-                            /* Weights data  */ w_data_d,
-                            /* Weights state */ w_state_d,
+                            /* In Data       */ inData,
+                            /* In State H    */ inStates[0],
+                            /* In State C    */ inStates[1],
+                            /* Weights data  */ w_data_prim_d,
+                            /* Weights state */ w_state_prim_d,
                             /* Bias          */ w_bias_d,
-                            /* Out Data      */ out_data_d,
-                            /* Out State H   */ out_states_d[0],
-                            /* Out State C   */ out_states_d[1])));
-            descs.push_back(desc);
-        } break;
+                            /* Out Data      */ outData,
+                            /* Out State H   */ outStates[0],
+                            /* Out State C   */ outStates[1])));
+            return desc;
+        }
         default:
             THROW_IE_EXCEPTION << "Unknown cell type";
     }
+}
+
+void MKLDNNRNN::createDescriptor(const std::vector<TensorDesc> &inputDesc,
+                                 const std::vector<TensorDesc> &outputDesc) {
+    descs.push_back(createRNNDescriptor(in_data_d, in_states_d, out_data_d, out_states_d));
 
     // Fill supported config
     InferenceEngine::LayerConfig config;
@@ -402,23 +423,15 @@ void MKLDNNRNN::createPrimitive() {
             && getCnnLayer()->blobs["biases"]->getTensorDesc().getPrecision() != Precision::FP32)
         THROW_IE_EXCEPTION << errorPrefix << " has invalid biases precision: " << getCnnLayer()->blobs["biases"]->getTensorDesc().getPrecision();
 
-    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
-
-    auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
-    auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
-
     // create weight blobs (data and state part)
     auto w_data_mem = std::make_shared<MKLDNNMemory>(getEngine());
     w_data_mem->Create(w_data_d);
-    internalBlobMemory.push_back(w_data_mem);
 
     auto w_state_mem = std::make_shared<MKLDNNMemory>(getEngine());
     w_state_mem->Create(w_state_d);
-    internalBlobMemory.push_back(w_state_mem);
 
     auto w_bias_mem = std::make_shared<MKLDNNMemory>(getEngine());
     w_bias_mem->Create(w_bias_d);
-    internalBlobMemory.push_back(w_bias_mem);
 
     {
         /* Copy Weight data
@@ -507,16 +520,197 @@ void MKLDNNRNN::createPrimitive() {
         }
     }
 
+    if (!isInt8) {
+        auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine());
+
+        internalBlobMemory.push_back(w_data_mem);
+        internalBlobMemory.push_back(w_state_mem);
+        internalBlobMemory.push_back(w_bias_mem);
+
+        prim.reset(new mkldnn::primitive(pd));
+        return;
+    }
+
+    /* INT8 weights are quantized symmetrically per gate and output channel:
+     *   scale[g, o] = 127 / max(|W[:, g, o]|, |R[:, g, o]|)
+     * The same scales are applied to W and R, so the primitive dequantizes both GEMM results at once.
+     */
+    std::vector<float> w_scales(G * SC, 0.f);
+    {
+        const auto w_ptr = static_cast<const float*>(w_data_mem->GetData());
+        const auto r_ptr = static_cast<const float*>(w_state_mem->GetData());
+
+        parallel_for(G * SC, [&](size_t go) {
+            float abs_max = 0.f;
+            for (int in_i = 0; in_i < DC; in_i++)
+                abs_max = std::max(abs_max, std::abs(w_ptr[in_i * G * SC + go]));
+            for (int in_i = 0; in_i < SC; in_i++)
+                abs_max = std::max(abs_max, std::abs(r_ptr[in_i * G * SC + go]));
+            w_scales[go] = abs_max > 0.f ? 127.f / abs_max : 1.f;
+        });
+    }
+
+    mkldnn::primitive_attr attr;
+    attr.set_rnn_data_qparams(dataScale, dataShift);
+    attr.set_rnn_weights_qparams((1 << 3) | (1 << 4), w_scales);  // per g and o of ldigo
+
+    auto pd = descs[0].createPrimitiveDescriptorIterator(getEngine(), attr);
+
+    auto quantizeWeights = [&](const MKLDNNMemoryPtr& src, const mkldnn::memory::desc& dstDesc) {
+        auto dst = std::make_shared<MKLDNNMemory>(getEngine());
+        dst->Create(dstDesc);
+
+        mkldnn::reorder::primitive_desc reorderPd(src->GetPrimitive(), dst->GetPrimitive(), attr);
+        mkldnn::stream loc_stream(getEngine(), stream::flags::default_order);
+        mkldnn::reorder(reorderPd).execute(loc_stream, src->GetPrimitive(), dst->GetPrimitive());
+
+        internalBlobMemory.push_back(dst);
+    };
+
+    quantizeWeights(w_data_mem, pd.weights_desc(0));
+    quantizeWeights(w_state_mem, pd.weights_desc(1));
+    internalBlobMemory.push_back(w_bias_mem);
+
+    // Data input keeps FP32 precision on the graph edge and is quantized right before the primitive call
+    auto src_desc = getParentEdgeAt(0)->getDesc();
+    src_desc.setPrecision(Precision::U8);
+    src_data_u8_mem = std::make_shared<MKLDNNMemory>(getEngine());
+    src_data_u8_mem->Create(MKLDNNMemoryDesc(src_desc));
+
     prim.reset(new mkldnn::primitive(pd));
 }
 
+bool MKLDNNRNN::canBeBatched() const {
+    return N == 1 && !isInt8 && static_cast<ptrdiff_t>(getParentEdges().size()) == S + 1;
+}
+
 void MKLDNNRNN::execute(mkldnn::stream strm) {
     if (!prim)
         THROW_IE_EXCEPTION << "No initialized primitive to execute";
 
-    const auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
+    if (!batcher) {
+        executeSingle(strm);
+        return;
+    }
+
+    RNNBatcher::Request request;
+    request.src = reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    request.dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    request.statesOut.resize(S, nullptr);
+    for (size_t s = 0; s < S; s++)
+        request.statesIn.push_back(reinterpret_cast<const float*>(getParentEdgeAt(s+1)->getMemoryPtr()->GetPtr()));
+
+    if (is_cell) {
+        for (size_t s = 0; s < S; s++)
+            request.statesOut[s] = reinterpret_cast<float*>(getChildEdgesAtPort(s)[0]->getMemoryPtr()->GetPtr());
+    } else {
+        ptrdiff_t n_ports_with_init_states = outDims.size() - 1; // first is a sequence data
+        for (size_t s = 0; s < std::min(S, n_ports_with_init_states); s++)
+            request.statesOut[s] = reinterpret_cast<float*>(getChildEdgesAtPort(s+1)[0]->getMemoryPtr()->GetPtr());
+    }
+
+    batcher->run(request, [&](const std::vector<RNNBatcher::Request*>& requests) {
+        // The leader's own request is the first one, a group of one is computed in place
+        if (requests.size() == 1)
+            executeSingle(strm);
+        else
+            executeBatched(requests, strm);
+    });
+}
+
+void MKLDNNRNN::executeBatched(const std::vector<RNNBatcher::Request*>& requests, mkldnn::stream strm) {
+    const size_t NB = requests.size();
+
+    auto batchedIt = batchedPrims.find(NB);
+    if (batchedIt == batchedPrims.end()) {
+        const auto nb = static_cast<ptrdiff_t>(NB);
+        MKLDNNMemoryDesc in_data_nb_d {{T, nb, DC}, memory::data_type::f32, memory::format_tag::tnc};
+        MKLDNNMemoryDesc out_data_nb_d {{T, nb, SC}, memory::data_type::f32, memory::format_tag::tnc};
+        std::vector<MKLDNNMemoryDesc> states_nb_d(S, MKLDNNMemoryDesc{{L, D, nb, SC}, memory::data_type::f32, memory::format_tag::ldnc});
+
+        auto desc = createRNNDescriptor(in_data_nb_d, states_nb_d, out_data_nb_d, states_nb_d);
+        auto pd = desc.createPrimitiveDescriptorIterator(getEngine());
+
+        BatchedPrimitive batched;
+        batched.prim.reset(new mkldnn::primitive(pd));
+
+        auto createMemory = [&](const MKLDNNMemoryDesc& desc) {
+            auto mem = std::make_shared<MKLDNNMemory>(getEngine());
+            mem->Create(desc);
+            return mem;
+        };
+        batched.src_data_mem = createMemory(in_data_nb_d);
+        batched.dst_data_mem = createMemory(out_data_nb_d);
+        for (size_t s = 0; s < S; s++) {
+            batched.src_states_mem.push_back(createMemory(states_nb_d[s]));
+            batched.dst_states_mem.push_back(createMemory(states_nb_d[s]));
+        }
+
+        batchedIt = batchedPrims.emplace(NB, std::move(batched)).first;
+    }
+    const auto& batched = batchedIt->second;
+
+    // Batch 1 data is [T, DC] for both sequence orders, the group is packed into the tnc layout
+    auto src_data = reinterpret_cast<float*>(batched.src_data_mem->GetPtr());
+    parallel_for2d(NB, T, [&](size_t n, size_t t) {
+        cpu_memcpy(src_data + (t * NB + n) * DC, requests[n]->src + t * DC, DC * sizeof(float));
+    });
+    for (size_t s = 0; s < S; s++) {
+        auto src_state = reinterpret_cast<float*>(batched.src_states_mem[s]->GetPtr());
+        parallel_for(NB, [&](size_t n) {
+            cpu_memcpy(src_state + n * SC, requests[n]->statesIn[s], SC * sizeof(float));
+        });
+    }
+
+    std::unordered_map<int, memory> args {
+        {DNNL_ARG_SRC_LAYER,     batched.src_data_mem->GetPrimitive()},
+        {DNNL_ARG_WEIGHTS_LAYER, internalBlobMemory[0]->GetPrimitive()},
+        {DNNL_ARG_WEIGHTS_ITER,  internalBlobMemory[1]->GetPrimitive()},
+        {DNNL_ARG_BIAS,          internalBlobMemory[2]->GetPrimitive()},
+        {DNNL_ARG_DST_LAYER,     batched.dst_data_mem->GetPrimitive()},
+    };
+
+    int state_i_tags[] {DNNL_ARG_SRC_ITER, DNNL_ARG_SRC_ITER_C};
+    int state_o_tags[] {DNNL_ARG_DST_ITER, DNNL_ARG_DST_ITER_C};
+    for (size_t s = 0; s < S; s++) {
+        args[state_i_tags[s]] = batched.src_states_mem[s]->GetPrimitive();
+        args[state_o_tags[s]] = batched.dst_states_mem[s]->GetPrimitive();
+    }
+
+    (*batched.prim).execute(strm, args);
+
+    auto dst_data = reinterpret_cast<const float*>(batched.dst_data_mem->GetPtr());
+    parallel_for2d(NB, T, [&](size_t n, size_t t) {
+        cpu_memcpy(requests[n]->dst + t * SC, dst_data + (t * NB + n) * SC, SC * sizeof(float));
+    });
+    for (size_t s = 0; s < S; s++) {
+        auto dst_state = reinterpret_cast<const float*>(batched.dst_states_mem[s]->GetPtr());
+        parallel_for(NB, [&](size_t n) {
+            if (requests[n]->statesOut[s])
+                cpu_memcpy(requests[n]->statesOut[s], dst_state + n * SC, SC * sizeof(float));
+        });
+    }
+}
+
+void MKLDNNRNN::executeSingle(mkldnn::stream strm) {
+    auto src_data_mem = getParentEdgeAt(0)->getMemoryPtr();
     const auto dst_data_mem = getChildEdgeAt(0)->getMemoryPtr();
 
+    if (isInt8) {
+        const auto src = reinterpret_cast<const float*>(src_data_mem->GetPtr());
+        auto dst = reinterpret_cast<uint8_t*>(src_data_u8_mem->GetPtr());
+        const size_t size = src_data_mem->GetElementsCount();
+
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(size, nthr, ithr, start, end);
+            InferenceEngine::Extensions::Cpu::XARCH::rnn_quantize_input(src + start, dst + start, end - start,
+                                                                        dataScale, dataShift);
+        });
+
+        src_data_mem = src_data_u8_mem;
+    }
+
     const auto &wgh_data_mem = internalBlobMemory[0];
     const auto &wgh_stat_mem = internalBlobMemory[1];
     const auto &wgh_bias_mem = internalBlobMemory[2];
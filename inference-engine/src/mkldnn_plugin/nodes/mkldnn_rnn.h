@@ -6,8 +6,10 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/rnn_batcher.h"
 #include <string>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace MKLDNNPlugin {
@@ -25,10 +27,26 @@ public:
 
     void execute(mkldnn::stream strm) override;
 
+    /**
+     * Switches the node to the INT8 primitive. The data input is quantized to u8 as round(x * scale + shift),
+     * weights are quantized to s8 per gate and output channel.
+     */
+    void setInputQuantization(float scale, float shift);
+
+    /** Cross-stream batching is supported for FP32 calls with batch 1 and all the initial states connected */
+    bool canBeBatched() const;
+    void setBatcher(RNNBatcher::Ptr rnnBatcher) { batcher = std::move(rnnBatcher); }
+
 private:
     void fillCellDesc();
     void fillSeqDesc();
 
+    MKLDNNDescriptor createRNNDescriptor(const MKLDNNMemoryDesc& inData, const std::vector<MKLDNNMemoryDesc>& inStates,
+                                         const MKLDNNMemoryDesc& outData, const std::vector<MKLDNNMemoryDesc>& outStates) const;
+
+    void executeSingle(mkldnn::stream strm);
+    void executeBatched(const std::vector<RNNBatcher::Request*>& requests, mkldnn::stream strm);
+
 private:
     /** Specify mode Cell or Seq. true - Cell, false - Seq */
     bool is_cell = false;
@@ -45,6 +63,11 @@ private:
     /** activation type for vanilla RNN cell */
     mkldnn::algorithm cell_act = mkldnn::algorithm::eltwise_tanh;
 
+    /** INT8 execution: u8 data, s8 weights. States and outputs stay FP32 */
+    bool isInt8 = false;
+    float dataScale = 1.f;
+    float dataShift = 0.f;
+
     // Internal attributes
     ptrdiff_t N = 0;   /**< Batch value */
     ptrdiff_t T = 0;   /**< Sequence value */
@@ -66,6 +89,21 @@ private:
     MKLDNNMemoryDesc w_state_d;
     MKLDNNMemoryDesc w_bias_d;
 
+    /** Quantized copy of the data input used by INT8 primitive */
+    MKLDNNMemoryPtr src_data_u8_mem;
+
+    /** Primitive computing a group of gathered calls and its packed data and states */
+    struct BatchedPrimitive {
+        std::shared_ptr<mkldnn::primitive> prim;
+        MKLDNNMemoryPtr src_data_mem;
+        MKLDNNMemoryPtr dst_data_mem;
+        std::vector<MKLDNNMemoryPtr> src_states_mem;
+        std::vector<MKLDNNMemoryPtr> dst_states_mem;
+    };
+
+    RNNBatcher::Ptr batcher;
+    std::unordered_map<size_t, BatchedPrimitive> batchedPrims;  // by the group size
+
     // List of in/out reorders if required
     std::vector<mkldnn::reorder> exec_before;
     std::vector<mkldnn::reorder> exec_after;
@@ -13,6 +13,7 @@
 #include <utils/bfloat16.hpp>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include "ie_parallel.hpp"
+#include "common/roi_align.h"
 #include <mkldnn_selective_build.h>
 
 using namespace MKLDNNPlugin;
@@ -190,156 +191,77 @@ void MKLDNNROIAlignNode::executeSpecified() {
     }
 
     for (int n = 0; n < realRois; ++n) {
-        int roiOff = n * 4;
-        const float* srcRoiPtr = &srcRoi[roiOff];
         int roiBatchInd = srcRoiIdx[n];
         if (roiBatchInd < -1) {  // -1 means switched off region
             THROW_IE_EXCEPTION << "Batch index cannot be less, than -1";
         } else if (roiBatchInd >= inputDimVector[0]) {
             THROW_IE_EXCEPTION << "Demanded batch (id = " << roiBatchInd << ") doesn't exist";
         }
+    }
+
+    // the sampling points and weights of a ROI are shared by all channels
+    std::vector<ROIAlignGrid> grids(realRois);
+    parallel_for(realRois, [&](int n) {
+        const float* srcRoiPtr = &srcRoi[n * 4];
+        calculateROIAlignGrid(srcRoiPtr[0] * spatialScale, srcRoiPtr[1] * spatialScale,
+                              srcRoiPtr[2] * spatialScale, srcRoiPtr[3] * spatialScale,
+                              pooledH, pooledW, samplingRatio, H, W, hInputStride, wInputStride, grids[n]);
+    });
+
+    auto poolContiguous = [&](const inputType* src, const ROIAlignGrid& grid, int binInd, int channelsNum, float* dstBin) {
+        const int* offsets = &grid.offsets[4 * binInd * grid.samplesPerBin];
+        const float* weights = &grid.weights[4 * binInd * grid.samplesPerBin];
+        if (opType == ROIAlignOpType::Max)
+            poolROIAlignBinContiguous<true>(src, offsets, weights, grid.samplesPerBin, channelsNum, dstBin);
+        else
+            poolROIAlignBinContiguous<false>(src, offsets, weights, grid.samplesPerBin, channelsNum, dstBin);
+    };
 
-        float x1 = srcRoiPtr[0] * spatialScale;
-        float y1 = srcRoiPtr[1] * spatialScale;
-        float x2 = srcRoiPtr[2] * spatialScale;
-        float y2 = srcRoiPtr[3] * spatialScale;
-
-        float roiHeight = std::max(y2 - y1, 1.0f);
-        float roiWidth = std::max(x2 - x1, 1.0f);
-        float binHeight = roiHeight / pooledH;
-        float binWidth = roiWidth / pooledW;
-
-        auto samplingRatioX = samplingRatio == 0 ? static_cast<int>(ceil(binWidth)) : samplingRatio;
-        auto samplingRatioY = samplingRatio == 0 ? static_cast<int>(ceil(binHeight)) : samplingRatio;
-
-        uint64_t numSamplesInBin = samplingRatioX * samplingRatioY;
-
-        float sampleDistanceX = binWidth / samplingRatioX;
-        float sampleDistanceY = binHeight / samplingRatioY;
-        // prepare arrays for sampling points and weights
-        std::vector<std::pair<int, int>> pointVector;
-        std::vector<float> weightVector;
-        pointVector.reserve(4 * numSamplesInBin * binCount);
-        weightVector.reserve(4 * numSamplesInBin * binCount);
-
-        for (int yBinInd = 0; yBinInd < pooledH; ++yBinInd) {
-            for (int xBinInd = 0; xBinInd < pooledW; ++xBinInd) {
-                // run into bin
-                for (int ySampleInd = 0; ySampleInd < samplingRatioY; ySampleInd++) {
-                    float sampleY = y1 + yBinInd * binHeight + sampleDistanceY * (0.5f + ySampleInd);
-                    for (int xSampleInd = 0; xSampleInd < samplingRatioX; xSampleInd++) {
-                        float sampleX = x1 + xBinInd * binWidth + sampleDistanceX * (0.5f + xSampleInd);
-                        if (sampleX < -1.0 || sampleX > W ||
-                            sampleY < -1.0 || sampleY > H) {
-                            // For this sample we save 4x point (0,0) with weight 0
-                            pointVector.insert(pointVector.end(), 4, {0, 0});
-                            weightVector.insert(weightVector.end(), 4, float{0});
-                            continue;
-                        }
-                        sampleX = std::max(sampleX, float{0});
-                        sampleY = std::max(sampleY, float{0});
-
-                        auto sampleYLow = static_cast<unsigned int>(sampleY);
-                        auto sampleXLow = static_cast<unsigned int>(sampleX);
-                        unsigned int sampleYHigh;
-                        unsigned int sampleXHigh;
-                        if (sampleYLow >= H - 1) {
-                            sampleYHigh = sampleYLow = H - 1;
-                            sampleY = static_cast<float>(sampleYLow);
-                        } else {
-                            sampleYHigh = sampleYLow + 1;
-                        }
-                        if (sampleXLow >= W - 1) {
-                            sampleXHigh = sampleXLow = W - 1;
-                            sampleX = static_cast<float>(sampleXLow);
-                        } else {
-                            sampleXHigh = sampleXLow + 1;
-                        }
-                        pointVector.push_back({sampleYLow, sampleXLow});
-                        pointVector.push_back({sampleYLow, sampleXHigh});
-                        pointVector.push_back({sampleYHigh, sampleXLow});
-                        pointVector.push_back({sampleYHigh, sampleXHigh});
-
-                        // weight calculation for bilinear interpolation
-                        auto ly = sampleY - sampleYLow;
-                        auto lx = sampleX - sampleXLow;
-                        auto hy = 1.0f - ly;
-                        auto hx = 1.0f - lx;
-
-                        weightVector.push_back(hy * hx);
-                        weightVector.push_back(hy * lx);
-                        weightVector.push_back(ly * hx);
-                        weightVector.push_back(ly * lx);
-                    }
-                }
+    if (isNhwcFmt) {
+        // the channels of a bin are contiguous, they are pooled in chunks of a stack buffer
+        const int channelsChunk = 64;
+        parallel_for2d(realRois, binCount, [&](int n, int binInd) {
+            const int yBinInd = binInd / pooledW;
+            const int xBinInd = binInd % pooledW;
+            float pooled[channelsChunk];
+            for (int cStart = 0; cStart < C; cStart += channelsChunk) {
+                const int channelsNum = std::min(channelsChunk, C - cStart);
+                const inputType* src = srcData + static_cast<size_t>(srcRoiIdx[n]) * C * H * W + cStart;
+                poolContiguous(src, grids[n], binInd, channelsNum, pooled);
+
+                outputType* dstBin = dst + static_cast<size_t>(n) * C * binCount + yBinInd * hOutputStride +
+                                     xBinInd * wOutputStride + cStart;
+                for (int c = 0; c < channelsNum; c++)
+                    dstBin[c] = pooled[c];
             }
-        }
-        auto pool = [&] (int xBinInd_, int yBinInd_, int binOffsetInput_, int binOffsetOutput_, int blockResidual_) {
-            float pooledValue = 0;
-            unsigned int sampleIndex = 4 * (yBinInd_ * pooledW + xBinInd_) * numSamplesInBin;
-            for (unsigned int binSampleInd = 0; binSampleInd < numSamplesInBin; binSampleInd++) {
-                size_t part1Index = binOffsetInput_ + pointVector[sampleIndex].first * hInputStride +
-                                    pointVector[sampleIndex].second * wInputStride + blockResidual_;
-                float part1 = srcData[part1Index];
-                size_t part2Index = binOffsetInput_ + pointVector[sampleIndex + 1].first * hInputStride +
-                                    pointVector[sampleIndex + 1].second * wInputStride + blockResidual_;
-                float part2 = srcData[part2Index];
-                size_t part3Index = binOffsetInput_ + pointVector[sampleIndex + 2].first * hInputStride +
-                                    pointVector[sampleIndex + 2].second * wInputStride + blockResidual_;
-                float part3 = srcData[part3Index];
-                size_t part4Index = binOffsetInput_ + pointVector[sampleIndex + 3].first * hInputStride +
-                                    pointVector[sampleIndex + 3].second * wInputStride + blockResidual_;
-                float part4 = srcData[part4Index];
-
-                switch (opType) {
-                    case ROIAlignOpType::Max:
-                    {
-                        float sampleValue = std::max(
-                                {weightVector[sampleIndex] * part1,
-                                 weightVector[sampleIndex + 1] * part2,
-                                 weightVector[sampleIndex + 2] * part3,
-                                 weightVector[sampleIndex + 3] * part4});
-                        pooledValue = sampleValue > pooledValue ? sampleValue : pooledValue;
-                        break;
-                    }
-                    case ROIAlignOpType::Avg:
-                    default:
-                    {
-                        float sampleValue =
-                                weightVector[sampleIndex] * part1 +
-                                weightVector[sampleIndex + 1] * part2 +
-                                weightVector[sampleIndex + 2] * part3 +
-                                weightVector[sampleIndex + 3] * part4;
-                        pooledValue += sampleValue / numSamplesInBin;
-                    }
-                }
-                sampleIndex += 4;
+        });
+    } else if (!isPlainFmt) {  // nChw16c, nChw8c
+        parallel_for3d(realRois, blockCount, binCount, [&](int n, int blkIdx, int binInd) {
+            const int yBinInd = binInd / pooledW;
+            const int xBinInd = binInd % pooledW;
+            const int channelsNum = std::min(blockSize, C - blkIdx * blockSize);
+            float pooled[16];
+            const inputType* src = srcData + (static_cast<size_t>(srcRoiIdx[n]) * chPadding + blkIdx * blockSize) * H * W;
+            poolContiguous(src, grids[n], binInd, channelsNum, pooled);
+
+            outputType* dstBin = dst + (static_cast<size_t>(n) * chPadding + blkIdx * blockSize) * binCount +
+                                 yBinInd * hOutputStride + xBinInd * wOutputStride;
+            for (int c = 0; c < channelsNum; c++)
+                dstBin[c] = pooled[c];
+        });
+    } else {  // nchw
+        parallel_for2d(realRois, C, [&](int n, int c) {
+            const ROIAlignGrid& grid = grids[n];
+            const inputType* src = srcData + (static_cast<size_t>(srcRoiIdx[n]) * C + c) * H * W;
+            outputType* dstChannel = dst + (static_cast<size_t>(n) * C + c) * binCount;
+            for (int binInd = 0; binInd < binCount; binInd++) {
+                const int* offsets = &grid.offsets[4 * binInd * grid.samplesPerBin];
+                const float* weights = &grid.weights[4 * binInd * grid.samplesPerBin];
+                dstChannel[binInd] = opType == ROIAlignOpType::Max ?
+                        poolROIAlignBin<true>(src, offsets, weights, grid.samplesPerBin) :
+                        poolROIAlignBin<false>(src, offsets, weights, grid.samplesPerBin);
             }
-            size_t dstIndex = binOffsetOutput_ + yBinInd_ * hOutputStride +
-                              xBinInd_ * wOutputStride + blockResidual_;
-            dst[dstIndex] = pooledValue;
-        };
-        if (isNhwcFmt) {
-            parallel_for2d(pooledH, pooledW, [&](int yBinInd, int xBinInd) {
-                for (int c = 0; c < C; c++) {
-                    size_t binOffsetInput = roiBatchInd * C * H * W + c;
-                    size_t binOffsetOutput = n * C * binCount + c;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, 0);
-                }
-            });
-        } else {  // nchw, nChw16c, nChw8c
-            parallel_for3d(blockCount, pooledH, pooledW, [&](int blkIdx, int yBinInd, int xBinInd) {
-                int cStart = blkIdx * blockSize;
-                int cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
-                for (int c = cStart; c < cEnd; c++) {
-                    const int blockResidual = (isPlainFmt ? 0 : c % blockSize);
-                    const int blockIdx = (c / blockSize) * blockSize;
-                    size_t binOffsetInput = (roiBatchInd * chPadding + blockIdx) * H * W;
-                    size_t binOffsetOutput = (n * chPadding + blockIdx) * binCount;
-                    pool(xBinInd, yBinInd, binOffsetInput, binOffsetOutput, blockResidual);
-                }
-            });
-        }
+        });
     }
 }
 
@@ -12,6 +12,8 @@
 #include <legacy/ie_layers_internal.hpp>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <atomic>
+#include <limits>
 #include "common/cpu_memcpy.h"
 
 using namespace mkldnn;
@@ -257,6 +259,28 @@ std::vector<size_t> getBlockND(const SizeVector& shape) {
     return blockND;
 }
 
+// min and max of the indices, the per thread loops have no branches to be vectorized by the compiler
+template <typename idx_t>
+static void getIndicesRange(const idx_t *indices, size_t size, int64_t &minValue, int64_t &maxValue) {
+    const int maxThreads = parallel_get_max_threads();
+    std::vector<idx_t> threadMin(maxThreads, std::numeric_limits<idx_t>::max());
+    std::vector<idx_t> threadMax(maxThreads, std::numeric_limits<idx_t>::lowest());
+    parallel_nt(maxThreads, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(size, nthr, ithr, start, end);
+        idx_t localMin = threadMin[ithr];
+        idx_t localMax = threadMax[ithr];
+        for (size_t i = start; i < end; i++) {
+            localMin = std::min(localMin, indices[i]);
+            localMax = std::max(localMax, indices[i]);
+        }
+        threadMin[ithr] = localMin;
+        threadMax[ithr] = localMax;
+    });
+    minValue = *std::min_element(threadMin.begin(), threadMin.end());
+    maxValue = *std::max_element(threadMax.begin(), threadMax.end());
+}
+
 void MKLDNNScatterUpdateNode::execute(mkldnn::stream strm) {
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
     auto &srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
@@ -293,17 +317,17 @@ void MKLDNNScatterUpdateNode::execute(mkldnn::stream strm) {
 
         size_t srcDimAxis = srcDataDim[axis];
         std::vector<size_t> indicesBlockND = getBlockND(indicesDim);
-        parallel_nt(0, [&](const int ithr, const int nthr) {
-            size_t start = 0, end = 0;
-            splitter(indicesBlockND[0], nthr, ithr, start, end);
-            for (int i = start; i < end; i++) {
-                int64_t idxValue =  getIndicesValue(indicesPtr, i);
-                if (idxValue >= static_cast<int64_t>(srcDimAxis) || idxValue < 0) {
-                    THROW_IE_EXCEPTION << errorPrefix
-                    << " have indices value that points to non-existing output tensor element";
-                }
-            }
-        });
+        int64_t minIdxValue = 0, maxIdxValue = 0;
+        if (indicesBlockND[0] > 0) {
+            if (indicesSize == 4)
+                getIndicesRange(reinterpret_cast<const int32_t*>(indicesPtr), indicesBlockND[0], minIdxValue, maxIdxValue);
+            else
+                getIndicesRange(reinterpret_cast<const int64_t*>(indicesPtr), indicesBlockND[0], minIdxValue, maxIdxValue);
+        }
+        if (maxIdxValue >= static_cast<int64_t>(srcDimAxis) || minIdxValue < 0) {
+            THROW_IE_EXCEPTION << errorPrefix
+            << " have indices value that points to non-existing output tensor element";
+        }
 
         if (scatterUpdateMode == ScatterUpdateMode::ScatterUpdate) {
             SizeVector indicesDim = getParentEdgeAt(INDICES_ID)->getDesc().getDims();
@@ -332,6 +356,7 @@ void MKLDNNScatterUpdateNode::execute(mkldnn::stream strm) {
         }
     }
 
+    // in-place mode shares the data input with the output, so only the updated rows are written
     if (srcPtr != dstPtr) {
         std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
         parallel_nt(0, [&](const int ithr, const int nthr) {
@@ -363,17 +388,51 @@ void MKLDNNScatterUpdateNode::execute(mkldnn::stream strm) {
     }
 }
 
+// Copies the i-th row of update to the dstRows[i]-th row of dstData. Rows are processed in the update order, so with
+// the repeated indices the last update wins. The work is split either by the columns of the rows or by the destination
+// rows, so different threads never write the same element.
+void MKLDNNScatterUpdateNode::scatterRows(const std::vector<size_t> &dstRows, size_t dstRowsNum, size_t rowSize,
+                                          uint8_t *update, uint8_t *dstData) {
+    const size_t rowSizeInBytes = rowSize * dataSize;
+    if (dstRows.empty() || rowSizeInBytes == 0)
+        return;
+
+    const size_t nthr = parallel_get_max_threads();
+    if (nthr == 1 || dstRows.size() * rowSizeInBytes < minParallelSize) {
+        for (size_t i = 0; i < dstRows.size(); i++)
+            cpu_memcpy(dstData + dstRows[i] * rowSizeInBytes, update + i * rowSizeInBytes, rowSizeInBytes);
+    } else if (rowSizeInBytes >= nthr * minParallelSize) {
+        // long rows, e.g. a single position of a cache, are split by the columns
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(rowSize, nthr, ithr, start, end);
+            const size_t size = (end - start) * dataSize;
+            start *= dataSize;
+            for (size_t i = 0; i < dstRows.size() && size > 0; i++)
+                cpu_memcpy(dstData + dstRows[i] * rowSizeInBytes + start, update + i * rowSizeInBytes + start, size);
+        });
+    } else {
+        // each thread writes only the destination rows it owns
+        parallel_nt(0, [&](const int ithr, const int nthr) {
+            size_t start = 0, end = 0;
+            splitter(dstRowsNum, nthr, ithr, start, end);
+            for (size_t i = 0; i < dstRows.size(); i++) {
+                if (dstRows[i] >= start && dstRows[i] < end)
+                    cpu_memcpy(dstData + dstRows[i] * rowSizeInBytes, update + i * rowSizeInBytes, rowSizeInBytes);
+            }
+        });
+    }
+}
+
 // For the data tensor of shape [d_0, d_1, ..., d_n],
 // and indices tensor of shape [i_0, i_1, ..., i_k].
 // Updates tensor shape should be [d_0, d_1, ... d_(axis - 1), i_0, i_1, ..., i_k, d_(axis + 1), ..., d_n].
 void MKLDNNScatterUpdateNode::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
     SizeVector srcDataDim = getParentEdgeAt(DATA_ID)->getDesc().getDims();
     SizeVector indicesDim = getParentEdgeAt(INDICES_ID)->getDesc().getDims();
-    SizeVector updateDim = getParentEdgeAt(UPDATE_ID)->getDesc().getDims();
     size_t indicesRank = indicesDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
-    std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
     const size_t mulIdentity = 1;
     size_t idxLength = mulIdentity;
@@ -386,14 +445,14 @@ void MKLDNNScatterUpdateNode::scatterUpdate(uint8_t *indices, uint8_t *update, i
     }
     // blockToUpdate is srcBlockND[axis + 1], also is updateBlockND[axis + indicesRank]
     size_t blockToUpdate = srcBlockND[axis + 1];
-    size_t blockToUpdateSize = blockToUpdate * dataSize;
 
+    // the update is a sequence of [batchToUpdate, idxLength] rows of blockToUpdate elements
+    std::vector<size_t> dstRows(batchToUpdate * idxLength);
     parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
-        int64_t idxValue = getIndicesValue(indices, idx);
-        uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
-        uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
-        cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+        dstRows[b * idxLength + idx] = b * srcDataDim[axis] + getIndicesValue(indices, idx);
     });
+
+    scatterRows(dstRows, batchToUpdate * srcDataDim[axis], blockToUpdate, update, dstData);
 }
 
 // indices is a (q-1)-dimension tensor of k-tuple,
@@ -412,68 +471,77 @@ void MKLDNNScatterUpdateNode::scatterNDUpdate(uint8_t *indices, uint8_t *update,
         idxTupleNum *= indicesDim[ri];
     }
 
-    size_t sizeToUpdate = srcBlockND[k] * dataSize;
+    // the data is a sequence of srcBlockND[0] / srcBlockND[k] slices, each tuple selects one of them
+    std::vector<size_t> dstRows(idxTupleNum);
+    std::atomic<bool> outOfRange(false);
     parallel_for(idxTupleNum, [&](size_t tupleIdx) {
         size_t indicesOffset = tupleIdx * k;
-        size_t dstOffset = 0;
-        for (int i = 0; i < k; i++) {
-            size_t idxValue = getIndicesValue(indices, indicesOffset + i);
-            dstOffset += idxValue * srcBlockND[i + 1];
+        size_t dstRow = 0;
+        for (size_t i = 0; i < k; i++) {
+            int64_t idxValue = getIndicesValue(indices, indicesOffset + i);
+            if (idxValue < 0 || idxValue >= static_cast<int64_t>(srcDataDim[i])) {
+                outOfRange = true;
+                idxValue = 0;
+            }
+            dstRow += idxValue * (srcBlockND[i + 1] / srcBlockND[k]);
         }
-        dstOffset *= dataSize;
-        size_t updateOffset = tupleIdx * sizeToUpdate;
-        cpu_memcpy(dstData + dstOffset, update + updateOffset, sizeToUpdate);
+        dstRows[tupleIdx] = dstRow;
     });
+    if (outOfRange) {
+        THROW_IE_EXCEPTION << "'" << getType() << "'" << " layer with name '" << getName()
+        << "' have indices value that points to non-existing output tensor element";
+    }
+
+    scatterRows(dstRows, srcBlockND[0] / srcBlockND[k], srcBlockND[k], update, dstData);
 }
 
 // output[indices[i][j][k]][j][k] = updates[i][j][k] if axis = 0,
 // output[i][indices[i][j][k]][k] = updates[i][j][k] if axis = 1,
 // output[i][j][indices[i][j][k]] = updates[i][j][k] if axis = 2.
+// The elements of the update with the same coordinates except the axis one are written to the same line of the output
+// only, so the lines are processed in parallel and the elements of a line in order.
 void MKLDNNScatterUpdateNode::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int axis, uint8_t *dstData) {
     SizeVector srcDataDim = getParentEdgeAt(DATA_ID)->getDesc().getDims();
     SizeVector updateDim = getParentEdgeAt(UPDATE_ID)->getDesc().getDims();
-    SizeVector indicesDim = getParentEdgeAt(INDICES_ID)->getDesc().getDims();
-    size_t updateRank = updateDim.size();
+    int updateRank = updateDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
     std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        int j;
-        size_t i, dst_idx = 0, start = 0, end = 0;
-        SizeVector tensorItr(updateRank, 0);
-        splitter(updateBlockND[0], nthr, ithr, start, end);
-        for (j = updateRank - 1, i = start; j >= 0; j--) {
-            tensorItr[j] = i % updateDim[j];
-            i /= updateDim[j];
-        }
+    const size_t outerSize = updateBlockND[0] / updateBlockND[axis];
+    const size_t innerSize = updateBlockND[axis + 1];
+    const size_t axisLength = updateDim[axis];
+    const size_t dstAxisStride = srcBlockND[axis + 1];
 
-        for (i = 0; i < static_cast<size_t>(axis); ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-        for (i++; i < updateRank; ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-
-        for (size_t iwork = start; iwork < end; iwork++) {
-            int64_t idxValue = getIndicesValue(indices, iwork);
-            if (idxValue < srcDataDim[axis])
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
-
-            for (j = updateRank - 1; j >= 0; j--) {
-                tensorItr[j]++;
-                if (tensorItr[j] < updateDim[j]) {
-                    if (j != static_cast<size_t>(axis))
-                        dst_idx += srcBlockND[j + 1];
-                    break;
-                } else {
-                    tensorItr[j] = 0;
-                    for (dst_idx = 0, i = 0; i < static_cast<size_t>(axis); ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
-                    for (i++; i < updateRank; ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
-                }
+    bool sameLines = true;
+    for (int r = 0; r < updateRank; r++) {
+        if (r != axis && updateDim[r] != srcDataDim[r])
+            sameLines = false;
+    }
+
+    parallel_for2d(outerSize, innerSize, [&](size_t outer, size_t inner) {
+        size_t dstOffset = 0;
+        if (sameLines) {
+            dstOffset = outer * srcBlockND[axis] + inner;
+        } else {
+            size_t rest = outer;
+            for (int r = axis - 1; r >= 0; r--) {
+                dstOffset += (rest % updateDim[r]) * srcBlockND[r + 1];
+                rest /= updateDim[r];
+            }
+            rest = inner;
+            for (int r = updateRank - 1; r > axis; r--) {
+                dstOffset += (rest % updateDim[r]) * srcBlockND[r + 1];
+                rest /= updateDim[r];
             }
         }
+
+        // indices have the same shape as the update
+        size_t updateOffset = outer * updateBlockND[axis] + inner;
+        for (size_t j = 0; j < axisLength; j++, updateOffset += innerSize) {
+            int64_t idxValue = getIndicesValue(indices, updateOffset);
+            cpu_memcpy(dstData + dataSize * (dstOffset + idxValue * dstAxisStride), update + updateOffset * dataSize, dataSize);
+        }
     });
 }
 
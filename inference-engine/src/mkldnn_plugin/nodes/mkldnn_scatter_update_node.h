@@ -36,6 +36,7 @@ private:
     void scatterUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
     void scatterNDUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, uint8_t *dstDataPtr);
     void scatterElementsUpdate(uint8_t *indicesPtr, uint8_t *updatePtr, int axis, uint8_t *dstDataPtr);
+    void scatterRows(const std::vector<size_t> &dstRows, size_t dstRowsNum, size_t rowSize, uint8_t *updatePtr, uint8_t *dstDataPtr);
     inline int64_t getIndicesValue(uint8_t *indices, size_t offset);
 
     ScatterUpdateMode scatterUpdateMode = ScatterUpdateMode::ScatterUpdate;
@@ -43,6 +44,8 @@ private:
     const size_t INDICES_ID = 1;
     const size_t UPDATE_ID = 2;
     const size_t AXIS_ID = 3;
+    // the smallest amount of bytes copied by a thread
+    const size_t minParallelSize = 16 * 1024;
 
     // if axis can be set other than default 0.
     bool axisRelaxed = false;
@@ -6,8 +6,10 @@
 
 #include <legacy/ie_layers.h>
 #include <string>
+#include <algorithm>
 #include <mkldnn_types.h>
 #include <mkldnn_extension_utils.h>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace mkldnn;
 using namespace MKLDNNPlugin;
@@ -89,6 +91,46 @@ void MKLDNNSoftMaxNode::createPrimitive() {
     auto src = getParentEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     auto dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPrimitive();
     primArgs = {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}};
+
+    TensorDesc srcDesc = getParentEdgeAt(0)->getDesc();
+    Precision precision = srcDesc.getPrecision();
+    const auto& blockingDesc = srcDesc.getBlockingDesc();
+    const auto& order = blockingDesc.getOrder();
+    const auto& blockDims = blockingDesc.getBlockDims();
+    const auto& strides = blockingDesc.getStrides();
+
+    bool isDensePlain = order.size() == srcDesc.getDims().size() && !order.empty();
+    for (size_t i = 0, stride = 1; isDensePlain && i < order.size(); i++) {
+        const size_t idx = order.size() - 1 - i;
+        isDensePlain = strides[idx] == stride;
+        stride *= blockDims[idx];
+    }
+
+    const bool isSupportedPrecision = precision == Precision::FP32 ||
+            (precision == Precision::BF16 && mkldnn::impl::cpu::x64::mayiuse(mkldnn::impl::cpu::x64::avx512_core));
+    if (isDensePlain && isSupportedPrecision) {
+        const size_t axisPos = std::find(order.begin(), order.end(), static_cast<size_t>(axis)) - order.begin();
+        outerSize = 1;
+        innerSize = 1;
+        for (size_t i = 0; i < axisPos; i++)
+            outerSize *= blockDims[i];
+        axisSize = blockDims[axisPos];
+        for (size_t i = axisPos + 1; i < blockDims.size(); i++)
+            innerSize *= blockDims[i];
+
+        softmaxKernel = std::make_shared<SoftmaxGeneric>(precision, precision);
+    }
+}
+
+void MKLDNNSoftMaxNode::execute(mkldnn::stream strm) {
+    if (!softmaxKernel) {
+        MKLDNNNode::execute(strm);
+        return;
+    }
+
+    const auto *srcData = reinterpret_cast<const uint8_t *>(getParentEdgeAt(0)->getMemoryPtr()->GetPtr());
+    auto *dstData = reinterpret_cast<uint8_t *>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    softmaxKernel->execute(srcData, dstData, outerSize, axisSize, 1, innerSize);
 }
 
 bool MKLDNNSoftMaxNode::created() const {
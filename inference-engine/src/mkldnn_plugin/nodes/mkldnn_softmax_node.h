@@ -6,6 +6,7 @@
 
 #include <ie_common.h>
 #include <mkldnn_node.h>
+#include "common/softmax.h"
 #include <string>
 #include <memory>
 #include <vector>
@@ -22,10 +23,17 @@ public:
                           const std::vector<InferenceEngine::TensorDesc>& outputDesc) override;
     void getSupportedDescriptors() override;
     void createPrimitive() override;
+    void execute(mkldnn::stream strm) override;
     bool created() const override;
 
 private:
     int axis = 0;
+
+    // plain layouts of any dimensions order are executed by SoftmaxGeneric as [outer, axis, inner]
+    std::shared_ptr<SoftmaxGeneric> softmaxKernel;
+    int outerSize = 1;
+    int axisSize = 1;
+    int innerSize = 1;
 };
 
 }  // namespace MKLDNNPlugin
@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "rnn_quantize_imp.hpp"
+
+#include <algorithm>
+#include <cmath>
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#include <immintrin.h>
+#endif
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+void rnn_quantize_input(const float* src, uint8_t* dst, size_t size, float scale, float shift) {
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    const __m512 vscale = _mm512_set1_ps(scale);
+    const __m512 vshift = _mm512_set1_ps(shift);
+    const __m512 vlow = _mm512_setzero_ps();
+    const __m512 vhigh = _mm512_set1_ps(255.f);
+    for (; i < size; i += 16) {
+        const __mmask16 mask = size - i >= 16 ? static_cast<__mmask16>(0xFFFF)
+                                              : static_cast<__mmask16>((1u << (size - i)) - 1);
+        __m512 v = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, src + i), vscale, vshift);
+        v = _mm512_min_ps(_mm512_max_ps(v, vlow), vhigh);
+        // the default MXCSR rounding mode is round half to even
+        _mm512_mask_cvtusepi32_storeu_epi8(dst + i, mask, _mm512_cvtps_epi32(v));
+    }
+#elif defined(HAVE_AVX2)
+    const __m256 vscale = _mm256_set1_ps(scale);
+    const __m256 vshift = _mm256_set1_ps(shift);
+    const __m256 vlow = _mm256_setzero_ps();
+    const __m256 vhigh = _mm256_set1_ps(255.f);
+    for (; i + 8 <= size; i += 8) {
+        __m256 v = _mm256_fmadd_ps(_mm256_loadu_ps(src + i), vscale, vshift);
+        v = _mm256_min_ps(_mm256_max_ps(v, vlow), vhigh);
+        // the default MXCSR rounding mode is round half to even
+        const __m256i vi = _mm256_cvtps_epi32(v);
+        const __m128i vw = _mm_packus_epi32(_mm256_castsi256_si128(vi), _mm256_extracti128_si256(vi, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + i), _mm_packus_epi16(vw, vw));
+    }
+#endif
+    for (; i < size; i++) {
+        float q = std::nearbyint(src[i] * scale + shift);
+        dst[i] = static_cast<uint8_t>(std::min(std::max(q, 0.f), 255.f));
+    }
+}
+
+}  // namespace XARCH
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
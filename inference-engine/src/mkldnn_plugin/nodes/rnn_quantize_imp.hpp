@@ -0,0 +1,23 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstddef>
+#include <cstdint>
+
+namespace InferenceEngine {
+namespace Extensions {
+namespace Cpu {
+namespace XARCH {
+
+/**
+ * Quantizes the FP32 data input of an INT8 RNN: dst = saturate_u8(nearbyint(src * scale + shift)).
+ * The values are rounded half to even, as the FakeQuantize node does.
+ */
+void rnn_quantize_input(const float* src, uint8_t* dst, size_t size, float scale, float shift);
+
+}  // namespace XARCH
+
+}  // namespace Cpu
+}  // namespace Extensions
+}  // namespace InferenceEngine
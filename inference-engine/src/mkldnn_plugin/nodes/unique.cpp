@@ -5,9 +5,10 @@
 #include "base.hpp"
 
 #include <cmath>
+#include <cstring>
+#include <numeric>
 #include <string>
 #include <vector>
-#include <unordered_map>
 #include <cassert>
 #include <algorithm>
 #include <functional>
@@ -118,49 +119,107 @@ public:
                 outputs[cur_output_port]->getTensorDesc().getBlockingDesc().getOffsetPadding();
         }
 
-        // create a copy since input can be changed by sorting
-        std::vector<float> input_copy(num_elements);
-        std::copy(input_ptr, input_ptr + num_elements, input_copy.begin());
+        // split the input into chunks, one per thread, and the unique keys into as many partitions by hash
+        const size_t num_chunks = std::max<size_t>(1, std::min<size_t>(parallel_get_max_threads(), num_elements / min_chunk_size));
+        const size_t chunk_size = div_up(num_elements, num_chunks);
+        const size_t num_partitions = num_chunks;
+        auto partition_of = [&](uint64_t h) { return static_cast<size_t>((h >> 32) % num_partitions); };
 
-        // sort elements in the input copy
-        if (sorted) {
-            parallel_sort(input_copy.begin(), input_copy.end(), std::less<float>());
-        }
+        // count the elements of each chunk in a local table and distribute the local uniques over the partitions,
+        // the input is read in place
+        std::vector<std::vector<std::vector<HashTable::Entry>>> chunk_partitions(num_chunks,
+                                                                                 std::vector<std::vector<HashTable::Entry>>(num_partitions));
+        parallel_for(num_chunks, [&](size_t chunk) {
+            const size_t start = chunk * chunk_size;
+            const size_t end = std::min(num_elements, start + chunk_size);
+            HashTable local;
+            for (size_t i = start; i < end; i++) {
+                local.insert(get_key(input_ptr[i]), i, 1);
+            }
+            local.for_each([&](const HashTable::Entry& entry) {
+                chunk_partitions[chunk][partition_of(hash(entry.key))].push_back(entry);
+            });
+        });
 
-        // walk through elements and save them along with its indice and occurences
-        std::unordered_map<float, float> indices;
-        for (size_t i = 0, num_unique_elements = 0; i < num_elements; i++) {
-            auto it = indices.find(input_copy[i]);
-            if (it == indices.end()) {
-                indices.insert(std::make_pair(input_copy[i], static_cast<float>(num_unique_elements)));
-                output_uniques_ptr[num_unique_elements] = input_copy[i];
-                if (return_inverse && !sorted) {
-                    output_indices_ptr[i] = static_cast<float>(num_unique_elements);
-                }
-                if (return_counts) {
-                    output_counts_ptr[num_unique_elements] = 1.0f;
-                }
-                num_unique_elements++;
-            } else {
-                if (return_inverse && !sorted) {
-                    output_indices_ptr[i] = it->second;
-                }
-                if (return_counts) {
-                    output_counts_ptr[static_cast<size_t>(it->second)] += 1.0f;
-                }
+        // merge the local uniques partition by partition, the chunks are merged in the input order, so the first
+        // occurrence of an element comes from the earliest chunk
+        std::vector<HashTable> partitions(num_partitions);
+        parallel_for(num_partitions, [&](size_t partition) {
+            size_t num_candidates = 0;
+            for (size_t chunk = 0; chunk < num_chunks; chunk++)
+                num_candidates += chunk_partitions[chunk][partition].size();
+            partitions[partition].reserve(num_candidates);
+            for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+                for (const auto& entry : chunk_partitions[chunk][partition])
+                    partitions[partition].insert(entry.key, entry.first, entry.count);
+                std::vector<HashTable::Entry>().swap(chunk_partitions[chunk][partition]);
             }
-        }
+        });
 
-        // compute indices individually when unique elements are known
-        if (sorted && return_inverse) {
-            for (size_t i = 0; i < num_elements; i++) {
-                auto it = indices.find(input_ptr[i]);
-                output_indices_ptr[i] = it->second;
+        size_t num_unique_elements = 0;
+        for (const auto& partition : partitions)
+            num_unique_elements += partition.size();
+
+        if (sorted) {
+            // only the unique elements are sorted
+            std::vector<float> uniques;
+            uniques.reserve(num_unique_elements);
+            for (const auto& partition : partitions) {
+                partition.for_each([&](const HashTable::Entry& entry) {
+                    uniques.push_back(input_ptr[entry.first]);
+                });
             }
+            parallel_sort(uniques.begin(), uniques.end(), std::less<float>());
+            parallel_for(num_unique_elements, [&](size_t id) {
+                const auto key = get_key(uniques[id]);
+                auto entry = partitions[partition_of(hash(key))].find(key);
+                entry->id = id;
+                output_uniques_ptr[id] = uniques[id];
+                if (return_counts)
+                    output_counts_ptr[id] = static_cast<float>(entry->count);
+            });
+        } else {
+            // the unique elements keep the order of their first occurrences: mark the first occurrences and number
+            // them with a prefix sum over the chunks
+            std::vector<uint8_t> is_first(num_elements, 0);
+            parallel_for(num_partitions, [&](size_t partition) {
+                partitions[partition].for_each([&](const HashTable::Entry& entry) {
+                    is_first[entry.first] = 1;
+                });
+            });
+            std::vector<size_t> chunk_offsets(num_chunks + 1, 0);
+            parallel_for(num_chunks, [&](size_t chunk) {
+                const size_t start = chunk * chunk_size;
+                const size_t end = std::min(num_elements, start + chunk_size);
+                chunk_offsets[chunk + 1] = std::count(is_first.begin() + start, is_first.begin() + end, 1);
+            });
+            std::partial_sum(chunk_offsets.begin(), chunk_offsets.end(), chunk_offsets.begin());
+            parallel_for(num_chunks, [&](size_t chunk) {
+                const size_t start = chunk * chunk_size;
+                const size_t end = std::min(num_elements, start + chunk_size);
+                size_t id = chunk_offsets[chunk];
+                for (size_t i = start; i < end; i++) {
+                    if (!is_first[i])
+                        continue;
+                    const auto key = get_key(input_ptr[i]);
+                    auto entry = partitions[partition_of(hash(key))].find(key);
+                    entry->id = id;
+                    output_uniques_ptr[id] = input_ptr[i];
+                    if (return_counts)
+                        output_counts_ptr[id] = static_cast<float>(entry->count);
+                    id++;
+                }
+            });
+        }
+
+        if (return_inverse) {
+            parallel_for(num_elements, [&](size_t i) {
+                const auto key = get_key(input_ptr[i]);
+                output_indices_ptr[i] = static_cast<float>(partitions[partition_of(hash(key))].find(key)->id);
+            });
         }
 
         // fill a tail with the latest unique element used as an end mark
-        size_t num_unique_elements = indices.size();
         if ((num_elements - num_unique_elements) > 0) {
             std::fill(output_uniques_ptr + num_unique_elements,
                 output_uniques_ptr + num_elements,
@@ -177,6 +236,108 @@ public:
     }
 
 private:
+    // Open addressing table with linear probing, keyed by the bits of the element. Keeps the index of the first
+    // occurrence of the element, the number of its occurrences and its position in the output.
+    class HashTable {
+    public:
+        struct Entry {
+            uint32_t key;
+            size_t first;
+            size_t count;  // zero for the empty slots
+            size_t id;
+        };
+
+        void reserve(size_t n) {
+            size_t capacity = 16;
+            while (capacity < 2 * n)
+                capacity *= 2;
+            if (capacity > slots.size())
+                rehash(capacity);
+        }
+
+        // adds the occurrences of the element, the first occurrence is kept for the known elements
+        void insert(uint32_t key, size_t first, size_t count) {
+            if (2 * (num_entries + 1) > slots.size())
+                rehash(std::max<size_t>(16, 2 * slots.size()));
+            Entry& slot = probe(key);
+            if (slot.count == 0) {
+                slot = {key, first, count, 0};
+                num_entries++;
+            } else {
+                slot.count += count;
+            }
+        }
+
+        Entry* find(uint32_t key) {
+            if (slots.empty())
+                return nullptr;
+            Entry& slot = probe(key);
+            return slot.count == 0 ? nullptr : &slot;
+        }
+
+        template <typename Func>
+        void for_each(const Func& func) const {
+            for (const auto& slot : slots) {
+                if (slot.count != 0)
+                    func(slot);
+            }
+        }
+
+        size_t size() const { return num_entries; }
+
+    private:
+        Entry& probe(uint32_t key) {
+            const size_t mask = slots.size() - 1;
+            size_t pos = static_cast<size_t>(hash(key)) & mask;
+            while (slots[pos].count != 0 && slots[pos].key != key)
+                pos = (pos + 1) & mask;
+            return slots[pos];
+        }
+
+        void rehash(size_t capacity) {
+            std::vector<Entry> old(capacity, Entry{0, 0, 0, 0});
+            old.swap(slots);
+            num_entries = 0;
+            for (const auto& slot : old) {
+                if (slot.count != 0) {
+                    probe(slot.key) = slot;
+                    num_entries++;
+                }
+            }
+        }
+
+        std::vector<Entry> slots;
+        size_t num_entries = 0;
+    };
+
+    // The elements are compared by their bits, with the zeros of both signs and all NaNs mapped to a single key
+    static uint32_t get_key(float value) {
+        if (value == 0.f)
+            return 0;
+        if (std::isnan(value))
+            return 0x7fc00000;
+        uint32_t key;
+        std::memcpy(&key, &value, sizeof(key));
+        return key;
+    }
+
+    static uint64_t hash(uint32_t key) {
+        uint64_t h = key;
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return h;
+    }
+
+    static size_t div_up(size_t a, size_t b) {
+        return (a + b - 1) / b;
+    }
+
+    // the smallest number of the elements processed by a thread
+    static constexpr size_t min_chunk_size = 4096;
+
     // attributes
     bool sorted;
     bool return_inverse;
@@ -7,6 +7,7 @@
 #include <vector>
 #include <memory>
 #include <map>
+#include <chrono>
 
 #include "multi_device_async_infer_request.hpp"
 
@@ -28,6 +29,8 @@ MultiDeviceAsyncInferRequest::MultiDeviceAsyncInferRequest(
         void run(Task task) override {
             auto workerInferRequest = _this->_workerInferRequest;
             workerInferRequest->_task = std::move(task);
+            workerInferRequest->_startTime = std::chrono::steady_clock::now();
+            workerInferRequest->_statistics->OnStart();
             workerInferRequest->_inferRequest.StartAsync();
         };
         MultiDeviceAsyncInferRequest* _this = nullptr;
@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include <mutex>
 #include <string>
+#include <limits>
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <utility>
@@ -48,6 +50,72 @@ struct IdleGuard {
     MultiDeviceExecutableNetwork::NotBusyWorkerRequests*  _notBusyWorkerRequests = nullptr;
 };
 
+namespace {
+// weight of the latest sample in the exponentially weighted moving averages of the device statistics
+constexpr double statisticsSmoothing = 0.125;
+
+double UpdateMovingAverage(double average, double sample, bool first) {
+    return first ? sample : average + statisticsSmoothing * (sample - average);
+}
+}  // namespace
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::OnStart() {
+    ++_inFlight;
+}
+
+void MultiDeviceExecutableNetwork::DeviceStatistics::OnComplete(std::chrono::steady_clock::time_point startTime) {
+    const auto now = std::chrono::steady_clock::now();
+    const double latencyMs = std::chrono::duration<double, std::milli>(now - startTime).count();
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _latencyMs = UpdateMovingAverage(_latencyMs, latencyMs, 0 == _completed);
+        if (0 != _completed) {
+            const double intervalMs = std::chrono::duration<double, std::milli>(now - _lastCompletion).count();
+            _intervalMs = UpdateMovingAverage(_intervalMs, intervalMs, 1 == _completed);
+        }
+        _lastCompletion = now;
+        ++_completed;
+    }
+    --_inFlight;
+}
+
+double MultiDeviceExecutableNetwork::DeviceStatistics::ExpectedCompletionTime() const {
+    const std::size_t inFlight = _inFlight;
+    const std::size_t queued = _queued;
+    std::lock_guard<std::mutex> lock(_mutex);
+    // an idle request starts the task right away (a never measured device is estimated as 0, so it gets probed)
+    if (inFlight < _numRequests)
+        return _latencyMs;
+    if (0 == _completed)
+        return std::numeric_limits<double>::infinity();
+    // otherwise the task waits for the already queued tasks, the device frees numRequests requests per latency period
+    return _latencyMs * (1.0 + static_cast<double>(queued + 1) / _numRequests);
+}
+
+std::map<std::string, float> MultiDeviceExecutableNetwork::DeviceStatistics::Get() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return {
+        {"LATENCY_MS",      static_cast<float>(_latencyMs)},
+        {"THROUGHPUT_FPS",  _intervalMs > 0.0 ? static_cast<float>(1000.0 / _intervalMs) : 0.f},
+        {"IN_FLIGHT",       static_cast<float>(_inFlight)},
+        {"QUEUED",          static_cast<float>(_queued)},
+        {"REQUESTS",        static_cast<float>(_numRequests)},
+        {"COMPLETED",       static_cast<float>(_completed)}
+    };
+}
+
+MultiDeviceExecutableNetwork::SchedulingPolicy MultiDeviceExecutableNetwork::ParseSchedulingPolicy(const std::string& policy) {
+    if (policy == MultiDeviceConfigParams::MULTI_PRIORITY) {
+        return SchedulingPolicy::Priority;
+    } else if (policy == MultiDeviceConfigParams::MULTI_LATENCY_AWARE) {
+        return SchedulingPolicy::LatencyAware;
+    } else {
+        THROW_IE_EXCEPTION << "Unsupported value " << policy << " for the "
+                           << MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY << " config. Supported values are "
+                           << MultiDeviceConfigParams::MULTI_PRIORITY << " and " << MultiDeviceConfigParams::MULTI_LATENCY_AWARE;
+    }
+}
+
 MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<InferenceEngine::ExecutableNetwork>&                 networksPerDevice,
                                                            const std::vector<DeviceInformation>&                                networkDevices,
                                                            const std::unordered_map<std::string, InferenceEngine::Parameter>&   config,
@@ -59,6 +127,9 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
     _config{config},
     _needPerfCounters{needPerfCounters} {
     _taskExecutor.reset();
+    auto itPolicy = _config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (itPolicy != _config.end())
+        _schedulingPolicy = ParseSchedulingPolicy(itPolicy->second.as<std::string>());
     for (auto&& networkValue : _networksPerDevice) {
         auto& device  = networkValue.first;
         auto& network = networkValue.second;
@@ -80,15 +151,19 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
         auto& idleWorkerRequests = _idleWorkerRequests[device];
         workerRequests.resize(numRequests);
         _inferPipelineTasksDeviceSpecific[device] = std::unique_ptr<ThreadSafeQueue<Task>>(new ThreadSafeQueue<Task>);
+        _deviceStatistics[device] = std::unique_ptr<DeviceStatistics>(new DeviceStatistics(numRequests));
+        auto* statisticsPtr = _deviceStatistics[device].get();
         auto* idleWorkerRequestsPtr = &(idleWorkerRequests);
         idleWorkerRequests.set_capacity(numRequests);
         for (auto&& workerRequest : workerRequests) {
             workerRequest._inferRequest = network.CreateInferRequest();
+            workerRequest._statistics = statisticsPtr;
             auto* workerRequestPtr = &workerRequest;
             IE_ASSERT(idleWorkerRequests.try_push(workerRequestPtr) == true);
             workerRequest._inferRequest.SetCompletionCallback<std::function<void(InferRequest, StatusCode)>>(
-                [workerRequestPtr, this, device, idleWorkerRequestsPtr] (InferRequest , StatusCode status) mutable {
+                [workerRequestPtr, this, device, idleWorkerRequestsPtr, statisticsPtr] (InferRequest , StatusCode status) mutable {
                     IdleGuard idleGuard{workerRequestPtr, *idleWorkerRequestsPtr};
+                    statisticsPtr->OnComplete(workerRequestPtr->_startTime);
                     workerRequestPtr->_status = status;
                     {
                         auto capturedTask = std::move(workerRequestPtr->_task);
@@ -101,40 +176,75 @@ MultiDeviceExecutableNetwork::MultiDeviceExecutableNetwork(const DeviceMap<Infer
                         Task t;
                         if (_inferPipelineTasks.try_pop(t))
                             ScheduleToWorkerInferRequest(std::move(t));
-                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t))
+                        else if (_inferPipelineTasksDeviceSpecific[device]->try_pop(t)) {
+                            --statisticsPtr->_queued;
                             ScheduleToWorkerInferRequest(std::move(t), device);
+                        }
                     }
                 });
         }
     }
 }
 
+bool MultiDeviceExecutableNetwork::RunOnIdleWorkerRequest(Task& inferPipelineTask, const DeviceName& device) {
+    WorkerInferRequest* workerRequestPtr = nullptr;
+    NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device];
+    if (idleWorkerRequests.try_pop(workerRequestPtr)) {
+        IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
+        _thisWorkerInferRequest = workerRequestPtr;
+        {
+            auto capturedTask = std::move(inferPipelineTask);
+            capturedTask();
+        }
+        idleGuard.Release();
+        return true;
+    }
+    return false;
+}
+
+DeviceName MultiDeviceExecutableNetwork::SelectLowestCompletionTimeDevice(const std::vector<DeviceInformation>& devices) const {
+    DeviceName selected;
+    double lowestTime = std::numeric_limits<double>::infinity();
+    // strict comparison keeps the priority order for the devices with equal estimates
+    for (auto&& device : devices) {
+        const double time = _deviceStatistics.at(device.deviceName)->ExpectedCompletionTime();
+        if (time < lowestTime) {
+            lowestTime = time;
+            selected = device.deviceName;
+        }
+    }
+    return selected;
+}
+
 void MultiDeviceExecutableNetwork::ScheduleToWorkerInferRequest(Task inferPipelineTask, DeviceName preferred_device) {
     auto devices = [&] {
         std::lock_guard<std::mutex> lock(_mutex);
         return _devicePriorities;
     }();
+    if (preferred_device.empty() && SchedulingPolicy::LatencyAware == _schedulingPolicy) {
+        const auto selected = SelectLowestCompletionTimeDevice(devices);
+        // if every device is busy and was never measured, the task waits for whichever device frees first
+        if (!selected.empty()) {
+            if (!RunOnIdleWorkerRequest(inferPipelineTask, selected)) {
+                ++_deviceStatistics.at(selected)->_queued;
+                _inferPipelineTasksDeviceSpecific[selected]->push(std::move(inferPipelineTask));
+            }
+            return;
+        }
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.deviceName != preferred_device))
             continue;
-        WorkerInferRequest* workerRequestPtr = nullptr;
-        NotBusyWorkerRequests& idleWorkerRequests = _idleWorkerRequests[device.deviceName];
-        if (idleWorkerRequests.try_pop(workerRequestPtr)) {
-            IdleGuard idleGuard{workerRequestPtr, idleWorkerRequests};
-            _thisWorkerInferRequest = workerRequestPtr;
-            {
-                auto capturedTask = std::move(inferPipelineTask);
-                capturedTask();
-            }
-            idleGuard.Release();
+        if (RunOnIdleWorkerRequest(inferPipelineTask, device.deviceName))
             return;
-        }
     }
     // no vacant requests this time, storing the task to the respective queue
-    if (!preferred_device.empty())
+    if (!preferred_device.empty()) {
+        ++_deviceStatistics.at(preferred_device)->_queued;
         _inferPipelineTasksDeviceSpecific[preferred_device]->push(std::move(inferPipelineTask));
-    else
+    } else {
         _inferPipelineTasks.push(std::move(inferPipelineTask));
+    }
 }
 
 void MultiDeviceExecutableNetwork::run(Task inferPipelineTask) {
@@ -207,10 +317,24 @@ IInferRequest::Ptr MultiDeviceExecutableNetwork::CreateInferRequest() {
 }
 
 void MultiDeviceExecutableNetwork::SetConfig(const std::map<std::string, InferenceEngine::Parameter> &config) {
+    if (config.empty() || std::any_of(config.begin(), config.end(), [](const std::pair<std::string, InferenceEngine::Parameter>& kvp) {
+            return kvp.first != MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES &&
+                   kvp.first != MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY;
+        })) {
+        THROW_IE_EXCEPTION << "The only configs supported for the Network's SetConfig are MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES"
+                           << " and MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY";
+    }
+
+    auto policy = config.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != config.end()) {
+        const auto schedulingPolicy = ParseSchedulingPolicy(policy->second.as<std::string>());
+        std::lock_guard<std::mutex> lock{_mutex};
+        _schedulingPolicy = schedulingPolicy;
+        _config[MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY] = policy->second;
+    }
+
     auto priorities = config.find(MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES);
-    if (priorities == config.end() || config.size() > 1) {
-        THROW_IE_EXCEPTION << "The only config supported for the Network's SetConfig is MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES";
-    } else {
+    if (priorities != config.end()) {
         auto multiPlugin = std::dynamic_pointer_cast<MultiDeviceInferencePlugin>(this->_plugin);
         assert(multiPlugin != nullptr);
         auto metaDevices = multiPlugin->ParseMetaDevices(priorities->second, {});
@@ -273,10 +397,18 @@ InferenceEngine::Parameter MultiDeviceExecutableNetwork::GetMetric(const std::st
             METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS),
             METRIC_KEY(SUPPORTED_METRICS),
             METRIC_KEY(NETWORK_NAME),
-            METRIC_KEY(SUPPORTED_CONFIG_KEYS)
+            METRIC_KEY(SUPPORTED_CONFIG_KEYS),
+            METRIC_KEY(MULTI_DEVICE_STATISTICS)
         });
+    } else if (name == METRIC_KEY(MULTI_DEVICE_STATISTICS)) {
+        std::map<std::string, std::map<std::string, float>> statistics;
+        for (auto&& deviceStatistics : _deviceStatistics) {
+            statistics[deviceStatistics.first] = deviceStatistics.second->Get();
+        }
+        IE_SET_METRIC_RETURN(MULTI_DEVICE_STATISTICS, statistics);
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES };
+        std::vector<std::string> configKeys = { MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+                                                MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY };
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
         THROW_IE_EXCEPTION << "Unsupported Network metric: " << name;
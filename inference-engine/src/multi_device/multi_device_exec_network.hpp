@@ -6,6 +6,7 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <mutex>
 #include <queue>
 #include <unordered_map>
@@ -98,10 +99,34 @@ class MultiDeviceExecutableNetwork : public InferenceEngine::ExecutableNetworkTh
                                      public InferenceEngine::ITaskExecutor {
 public:
     using Ptr = std::shared_ptr<MultiDeviceExecutableNetwork>;
+    enum class SchedulingPolicy {
+        Priority,
+        LatencyAware
+    };
+    // live statistics of a device, updated on every start and completion of the device infer requests
+    struct DeviceStatistics {
+        explicit DeviceStatistics(std::size_t numRequests) : _numRequests{numRequests} {}
+        void OnStart();
+        void OnComplete(std::chrono::steady_clock::time_point startTime);
+        // expected time (ms) for a new task to complete on the device, infinity if it would wait for a never measured device
+        double ExpectedCompletionTime() const;
+        std::map<std::string, float> Get() const;
+
+        const std::size_t                       _numRequests;
+        mutable std::mutex                      _mutex;
+        double                                  _latencyMs = 0.0;
+        double                                  _intervalMs = 0.0;
+        std::size_t                             _completed = 0;
+        std::chrono::steady_clock::time_point   _lastCompletion;
+        std::atomic_size_t                      _inFlight = {0};
+        std::atomic_size_t                      _queued = {0};
+    };
     struct WorkerInferRequest {
         InferenceEngine::InferRequest   _inferRequest;
         InferenceEngine::Task           _task;
         InferenceEngine::StatusCode     _status = InferenceEngine::StatusCode::OK;
+        DeviceStatistics*               _statistics = nullptr;
+        std::chrono::steady_clock::time_point _startTime;
     };
     using NotBusyWorkerRequests = ThreadSafeBoundedQueue<WorkerInferRequest*>;
 
@@ -121,6 +146,9 @@ public:
     ~MultiDeviceExecutableNetwork() override;
 
     void ScheduleToWorkerInferRequest(InferenceEngine::Task, DeviceName preferred_device = "");
+    bool RunOnIdleWorkerRequest(InferenceEngine::Task& inferPipelineTask, const DeviceName& device);
+    DeviceName SelectLowestCompletionTimeDevice(const std::vector<DeviceInformation>& devices) const;
+    static SchedulingPolicy ParseSchedulingPolicy(const std::string& policy);
 
     static thread_local WorkerInferRequest*                     _thisWorkerInferRequest;
     // have to use the const char* ptr rather than std::string due to a bug in old gcc versions,
@@ -135,6 +163,8 @@ public:
     DeviceMap<std::unique_ptr<ThreadSafeQueue<InferenceEngine::Task>>> _inferPipelineTasksDeviceSpecific;
     DeviceMap<NotBusyWorkerRequests>                            _idleWorkerRequests;
     DeviceMap<std::vector<WorkerInferRequest>>                  _workerRequests;
+    DeviceMap<std::unique_ptr<DeviceStatistics>>                _deviceStatistics;
+    std::atomic<SchedulingPolicy>                               _schedulingPolicy = {SchedulingPolicy::Priority};
     std::unordered_map<std::string, InferenceEngine::Parameter> _config;
     bool                                                        _needPerfCounters = false;
     std::atomic_size_t                                          _numRequestsCreated = {0};
@@ -109,6 +109,9 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetConfig(const std::stri
         } else {
             return { it->second };
         }
+    } else if (name == MULTI_CONFIG_KEY(SCHEDULING_POLICY)) {
+        auto it = _config.find(MULTI_CONFIG_KEY(SCHEDULING_POLICY));
+        return { it == _config.end() ? std::string{MULTI_CONFIG_VALUE(PRIORITY)} : it->second };
     } else {
         THROW_IE_EXCEPTION << "Unsupported config key: " << name;
     }
@@ -141,6 +144,7 @@ InferenceEngine::Parameter MultiDeviceInferencePlugin::GetMetric(const std::stri
     } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
         std::vector<std::string> configKeys = {
             MultiDeviceConfigParams::KEY_MULTI_DEVICE_PRIORITIES,
+            MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY,
             CONFIG_KEY_INTERNAL(AGGREGATED_PLUGIN)};
         IE_SET_METRIC_RETURN(SUPPORTED_CONFIG_KEYS, configKeys);
     } else {
@@ -169,6 +173,12 @@ ExecutableNetworkInternal::Ptr MultiDeviceInferencePlugin::LoadExeNetworkImpl(co
     // collect the settings that are applicable to the devices we are loading the network to
     std::unordered_map<std::string, InferenceEngine::Parameter> multiNetworkConfig;
     multiNetworkConfig.insert(*priorities);
+    auto policy = fullConfig.find(MultiDeviceConfigParams::KEY_MULTI_SCHEDULING_POLICY);
+    if (policy != fullConfig.end()) {
+        // validate the value before spending time on loading the network to the devices
+        MultiDeviceExecutableNetwork::ParseSchedulingPolicy(policy->second);
+        multiNetworkConfig.insert(*policy);
+    }
 
     DeviceMap<ExecutableNetwork> executableNetworkPerDevice;
     std::mutex load_mutex;
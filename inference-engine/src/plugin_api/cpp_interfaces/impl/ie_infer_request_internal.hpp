@@ -271,10 +271,21 @@ protected:
             auto it = _preProcData.find(input.first);
             if (it != _preProcData.end()) {
                 _preProcData[input.first]->execute(input.second, _networkInputs[input.first]->getPreProcess(), serial,
-                                                   m_curBatch);
+                                                   m_curBatch, preProcessingNormalizes(input.first));
             }
         }
     }
+
+    /**
+     * @brief Checks whether MEAN_VALUE mean and scale values of an input are applied by the pre-processing step
+     * @note A plugin which returns `true` must skip its own mean/scale handling for the input
+     * @param name A name of the input
+     * @return `True` if pre-processing normalizes the input, `false` otherwise
+     */
+    virtual bool preProcessingNormalizes(const std::string& name) const {
+        (void)name;
+        return false;
+    }
     /**
      * @brief Helper function to find input or output blob by name
      * @param name A name of input or output blob.
@@ -38,6 +38,32 @@ DECLARE_CONFIG_KEY(LP_TRANSFORMS_MODE);
  */
 DECLARE_CONFIG_KEY(CPU_THREADS_PER_STREAM);
 
+/**
+ * @brief Enables the CPU graph pass which reassigns the memory formats of the nodes to minimize the cost of the
+ * reorders after the greedy per-node selection. YES or NO (default). The cost model counts only the reordered
+ * bytes, not the compute cost of the primitives in the selected formats
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_LAYOUT_ASSIGNMENT);
+
+/**
+ * @brief Maximal number of concurrent RNN calls from different CPU streams gathered into one batched call.
+ * Applies to FP32 LSTM/GRU/RNN layers with batch 1, e.g. many independent stateful streams. 0 or 1 disables it
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RNN_BATCH_LIMIT);
+
+/**
+ * @brief Time in microseconds the first RNN call of a batch waits for the calls of other streams
+ *
+ * The wait is paid on every batched RNN layer of the network: when fewer than CPU_RNN_BATCH_LIMIT streams are busy,
+ * the group is never full and each of these layers is delayed by the whole timeout, e.g. a network with 10 LSTM
+ * layers run by a single request gets 10 timeouts added to its latency. Keep it well below the layer execution time
+ * unless the streams are known to be fully loaded
+ * @ingroup ie_dev_api_plugin_api
+ */
+DECLARE_CONFIG_KEY(CPU_RNN_BATCH_TIMEOUT);
+
 /**
  * @brief This key should be used to notify aggregating plugin
  *        that it is used inside other aggregating plugin
@@ -34,7 +34,8 @@ public:
 
     Blob::Ptr getRoiBlob() const override;
 
-    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1) override;
+    void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial, int batchSize = -1,
+                 bool normalize = false) override;
 
     void Release() noexcept override;
 
@@ -59,7 +60,7 @@ Blob::Ptr PreProcessData::getRoiBlob() const {
 }
 
 void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &info, bool serial,
-        int batchSize) {
+        int batchSize, bool normalize) {
     OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, "Preprocessing");
 
     auto algorithm = info.getResizeAlgorithm();
@@ -75,7 +76,18 @@ void PreProcessData::execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo &
         _preproc.reset(new PreprocEngine);
     }
 
-    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize);
+    MeanScale mean_scale;
+    if (normalize) {
+        if (info.getMeanVariant() != MEAN_VALUE) {
+            THROW_IE_EXCEPTION << "Only MEAN_VALUE normalization can be done by pre-processing";
+        }
+        for (size_t c = 0; c < info.getNumberOfChannels(); c++) {
+            mean_scale.mean.push_back(info[c]->meanValue);
+            mean_scale.scale.push_back(info[c]->stdScale);
+        }
+    }
+
+    _preproc->preprocessWithGAPI(_userBlob, preprocessedBlob, algorithm, fmt, serial, batchSize, mean_scale);
 }
 
 void PreProcessData::isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) {
@@ -53,8 +53,11 @@ public:
      * @param info pre-processing info that specifies resize algorithm and color format.
      * @param serial disable OpenMP threading if the value set to true.
      * @param batchSize batch size for pre-processing.
+     * @param normalize apply MEAN_VALUE mean and scale values from the pre-processing info as a part of
+     * pre-processing. The caller must not apply them again.
      */
-    virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1) = 0;
+    virtual void execute(Blob::Ptr &preprocessedBlob, const PreProcessInfo& info, bool serial, int batchSize = -1,
+                         bool normalize = false) = 0;
 
     //FIXME: rename to verifyAplicable
     virtual void isApplicable(const Blob::Ptr &src, const Blob::Ptr &dst) = 0;
@@ -82,6 +82,7 @@ inline int get_cv_depth(const TensorDesc &ie_desc) {
     case Precision::FP32: return CV_32F;
     case Precision::U16:  return CV_16U;
     case Precision::FP16: return CV_16U;
+    case Precision::BF16: return CV_16U;  // produced by NormalizePlane only
 
     default: THROW_IE_EXCEPTION << "Unsupported data type";
     }
@@ -550,7 +551,8 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
                             Layout out_layout,
                             ResizeAlgorithm algorithm,
                             ColorFormat input_color_format,
-                            ColorFormat output_color_format) {
+                            ColorFormat output_color_format,
+                            const MeanScale& mean_scale) {
     // perform basic validation to ensure our assumptions about input and output are correct
     validateColorFormats(in_desc, out_desc, in_layout, out_layout, input_color_format,
         output_color_format);
@@ -573,9 +575,21 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
     const auto io_color_formats = std::make_tuple(input_color_format, output_color_format);
     const bool drop_channel = (io_color_formats == std::make_tuple(ColorFormat::RGBX, ColorFormat::RGB)) ||
                               (io_color_formats == std::make_tuple(ColorFormat::BGRX, ColorFormat::BGR));
+    const bool normalize = !mean_scale.empty();
+    // apply mean/scale plane by plane, converting the data into the network's precision at the
+    // same time. fluid executes this together with resize and color conversion row by row, so no
+    // intermediate image is written to memory
+    const auto normalize_planes = [&](std::vector<cv::GMat>& planes, int prec) {
+        for (size_t i = 0; i < planes.size(); i++) {
+            if (prec != CV_8U && prec != CV_32F) {
+                planes[i] = gapi::ConvertDepth::on(planes[i], CV_32F);
+            }
+            planes[i] = gapi::NormalizePlane::on(planes[i], mean_scale.mean[i], mean_scale.scale[i], out_desc.prec);
+        }
+    };
     const bool specific_case_of_preproc = ((in_layout == NHWC || specific_yuv420_input_handling)
                                         && (in_desc.d.C == 3 || specific_yuv420_input_handling || drop_channel)
-                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec))
+                                        && ((in_desc.prec == CV_8U) && (in_desc.prec == out_desc.prec || normalize))
                                         && (algorithm == RESIZE_BILINEAR)
                                         && (input_color_format == ColorFormat::RAW
                                             || input_color_format == output_color_format
@@ -610,6 +624,10 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
             std::reverse(planes.begin(), planes.end());
         }
 
+        if (normalize) {
+            normalize_planes(planes, in_desc.prec);
+        }
+
         std::vector<cv::GMat> outputs;
         if (out_layout == NHWC) {
             outputs.emplace_back(gapi::Merge3::on(planes[0], planes[1], planes[2]));
@@ -665,7 +683,9 @@ cv::GComputation buildGraph(const G::Desc &in_desc,
         outputs = planes;
     }
 
-    if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
+    if (normalize) {
+        normalize_planes(outputs, need_tmp_prec_conv ? tmp_prec : in_desc.prec);
+    } else if ((in_desc.prec != out_desc.prec) || need_tmp_prec_conv) {
         auto convert_prec = [](const std::vector<cv::GMat> & src_gmats, int dst_precision) {
             std::vector<cv::GMat> dst_gmats;
             std::transform(src_gmats.begin(), src_gmats.end(), std::back_inserter(dst_gmats), [&](cv::GMat const& m){
@@ -696,6 +716,7 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     // 3. algorithm has changed (affects kernel version)
     // 4. dimensions have changed from downscale to upscale or vice-versa if interpolation is AREA
     // 5. color format has changed (affects graph topology)
+    // 6. mean/scale values have changed (passed to kernels as graph parameters)
     if (!_lastCall) {
         return Update::REBUILD;
     }
@@ -703,13 +724,15 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     BlobDesc last_in;
     BlobDesc last_out;
     ResizeAlgorithm last_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(last_in, last_out, last_algo) = *_lastCall;
+    MeanScale last_mean_scale;
+    std::tie(last_in, last_out, last_algo, last_mean_scale) = *_lastCall;
 
     CallDesc newCall = newCallOrig;
     BlobDesc new_in;
     BlobDesc new_out;
     ResizeAlgorithm new_algo = ResizeAlgorithm::NO_RESIZE;
-    std::tie(new_in, new_out, new_algo) = newCall;
+    MeanScale new_mean_scale;
+    std::tie(new_in, new_out, new_algo, new_mean_scale) = newCall;
 
     // Declare two empty vectors per each call
     SizeVector last_in_size;
@@ -725,7 +748,8 @@ PreprocEngine::Update PreprocEngine::needUpdate(const CallDesc &newCallOrig) con
     new_out_size.swap(std::get<2>(new_out));
 
     // If anything (except input sizes) changes, rebuild is required
-    if (last_in != new_in || last_out != new_out || last_algo != new_algo) {
+    if (last_in != new_in || last_out != new_out || last_algo != new_algo ||
+        last_mean_scale != new_mean_scale) {
         return Update::REBUILD;
     }
 
@@ -814,31 +838,54 @@ int PreprocEngine::getCorrectBatchSize(int batch, const Blob::Ptr& blob) {
     return batch;
 }
 
-void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
-    const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
+void PreprocEngine::executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& batched_input_plane_mats,
     std::vector<std::vector<cv::gapi::own::Mat>>& batched_output_plane_mats, int batch_size, bool omp_serial,
     Update update) {
 
-    const int thread_num =
+    const int max_threads =
 #if IE_THREAD == IE_THREAD_OMP
         omp_serial ? 1 :    // disable threading for OpenMP if was asked for
 #endif
-        0;                  // use all available threads
+        parallel_get_max_threads();  // threads of the current arena (stream) for TBB
 
     // to suppress unused warnings
     (void)(omp_serial);
 
-    // Split the whole graph into `total_slices` slices, where
-    // `total_slices` is provided by the parallel runtime and assumed
-    // to be number of threads used.  However it is not guaranteed
-    // that an actual number of threads will be as assumed, so it
-    // possible that all slices are processed by the same thread.
+    // Split the work into `tiles` horizontal output tiles times `groups` groups of batch items.
+    // Every work item owns a graph compiled for its tile ROI (a compiled graph can't be run
+    // concurrently) and executes it for the batch items of its group. Tiles are not made
+    // lower than kMinTileHeight rows as each tile re-reads the filter window of the resize
+    // at its borders, the threads left are given to the batch items.
     //
-    parallel_nt_static(thread_num, [&, this](int slice_n, const int total_slices) {
+    // It is not guaranteed that an actual number of threads will be as assumed, so it
+    // possible that all work items are processed by the same thread.
+    constexpr int kMinTileHeight = 16;
+    const int rows = batched_output_plane_mats[0][0].rows;
+    const int tiles = std::max(1, std::min(max_threads, rows / kMinTileHeight));
+    const int groups = std::max(1, std::min(batch_size, max_threads / tiles));
+    const int work_items = tiles * groups;
+
+    if (_lastComp.size() < static_cast<size_t>(work_items)) {
+        _lastComp.resize(work_items);
+    }
+    if (tiles != _lastTiles) {
+        // tile ROIs have changed (e.g. called from an arena of different concurrency)
+        std::fill(_lastComp.begin(), _lastComp.end(), cv::GCompiled{});
+        _lastTiles = tiles;
+    } else if (Update::REBUILD == update || Update::RESHAPE == update) {
+        // graphs not used by this call would be left for the old graph/input sizes, they are
+        // compiled again once needed
+        std::fill(_lastComp.begin() + work_items, _lastComp.end(), cv::GCompiled{});
+    }
+
+    parallel_nt_static(work_items, [&, this](int item_n, const int) {
         OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_exec_tile);
 
-        auto& compiled = _lastComp[slice_n];
-        if (Update::REBUILD == update || Update::RESHAPE == update) {
+        const int tile_n = item_n % tiles;
+        const int group_n = item_n / tiles;
+
+        auto& compiled = _lastComp[item_n];
+        if (Update::REBUILD == update || Update::RESHAPE == update || !compiled) {
             //  need to compile (or reshape) own object for a particular ROI
             OV_ITT_SCOPED_TASK(itt::domains::IEPreproc, _perf_graph_compiling);
 
@@ -848,39 +895,36 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
             const auto& input_plane_mats = batched_input_plane_mats[0];
             const auto& output_plane_mats = batched_output_plane_mats[0];
 
-            auto lines_per_thread = output_plane_mats[0].rows / total_slices;
-            const auto remainder = output_plane_mats[0].rows % total_slices;
+            auto lines_per_tile = output_plane_mats[0].rows / tiles;
+            const auto remainder = output_plane_mats[0].rows % tiles;
 
-            // remainder shows how many threads must calculate 1 additional row. now these additions
+            // remainder shows how many tiles must calculate 1 additional row. now these additions
             // must also be addressed in rect's Y coordinate:
             int roi_y = 0;
-            if (slice_n < remainder) {
-                lines_per_thread++;  // 1 additional row
-                roi_y = slice_n * lines_per_thread;  // all previous rois have lines+1 rows
+            if (tile_n < remainder) {
+                lines_per_tile++;  // 1 additional row
+                roi_y = tile_n * lines_per_tile;  // all previous rois have lines+1 rows
             } else {
-                // remainder rois have lines+1 rows, the rest prior to slice_n have lines rows
+                // remainder rois have lines+1 rows, the rest prior to tile_n have lines rows
                 roi_y =
-                    remainder * (lines_per_thread + 1) + (slice_n - remainder) * lines_per_thread;
+                    remainder * (lines_per_tile + 1) + (tile_n - remainder) * lines_per_tile;
             }
 
-            if (lines_per_thread <= 0) return;  // no job for current thread
-
-            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_thread};
+            auto roi = Rect{0, roi_y, output_plane_mats[0].cols, lines_per_tile};
             std::vector<Rect> rois(output_plane_mats.size(), roi);
 
             // TODO: make a ROI a runtime argument to avoid
             // recompilations
             auto args = cv::compile_args(gapi::preprocKernels(), cv::GFluidOutputRois{std::move(rois)});
-            if (Update::REBUILD == update) {
-                auto& computation = lastComputation.value();
+            if (Update::REBUILD == update || !compiled) {
+                auto& computation = _lastComputation.value();
                 compiled = computation.compile(descrs_of(input_plane_mats), std::move(args));
             } else {
-                IE_ASSERT(compiled);
                 compiled.reshape(descrs_of(input_plane_mats), std::move(args));
             }
         }
 
-        for (int i = 0; i < batch_size; ++i) {
+        for (int i = group_n; i < batch_size; i += groups) {
             const auto& input_plane_mats = batched_input_plane_mats[i];
             auto& output_plane_mats = batched_output_plane_mats[i];
 
@@ -897,8 +941,8 @@ void PreprocEngine::executeGraph(Opt<cv::GComputation>& lastComputation,
 
 template<typename BlobTypePtr>
 void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-    int batch_size) {
+    ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, const MeanScale& mean_scale,
+    bool omp_serial, int batch_size) {
 
     validateBlob(inBlob);
 
@@ -914,6 +958,27 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
 
     const auto out_layout = out_desc_ie.getLayout();
 
+    const auto out_prec = out_desc_ie.getPrecision();
+    if (mean_scale.empty()) {
+        if (out_prec == Precision::BF16) {
+            THROW_IE_EXCEPTION << "BF16 network's input is supported by pre-processing only together "
+                                  "with mean/scale normalization";
+        }
+    } else {
+        if (out_prec != Precision::FP32 && out_prec != Precision::BF16) {
+            THROW_IE_EXCEPTION << "Mean/scale normalization requires FP32 or BF16 network's input, "
+                               << "actual: " << out_prec;
+        }
+        const auto channels = out_desc_ie.getDims()[1];
+        if (mean_scale.mean.size() != channels || mean_scale.scale.size() != channels) {
+            THROW_IE_EXCEPTION << "Number of mean/scale values doesn't match number of channels: "
+                               << mean_scale.mean.size() << " != " << channels;
+        }
+    }
+    if (in_desc_ie.getPrecision() == Precision::BF16) {
+        THROW_IE_EXCEPTION << "BF16 input blob is not supported by pre-processing";
+    }
+
     // For YUV420, check batch via Y plane descriptor
     const G::Desc
         in_desc =  G::decompose(in_desc_ie),
@@ -940,16 +1005,16 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                                             out_layout,
                                             out_desc_ie.getDims(),
                                             out_fmt },
-                                  algorithm };
+                                  algorithm,
+                                  mean_scale };
 
-    if (algorithm == NO_RESIZE && std::get<0>(thisCall) == std::get<1>(thisCall)) {
+    if (algorithm == NO_RESIZE && mean_scale.empty() && std::get<0>(thisCall) == std::get<1>(thisCall)) {
         //if requested output parameters match input blob no need to do anything
         THROW_IE_EXCEPTION  << "No job to do in the PreProcessing ?";
     }
 
     const Update update = needUpdate(thisCall);
 
-    Opt<cv::GComputation> _lastComputation;
     if (Update::REBUILD == update || Update::RESHAPE == update) {
         _lastCall = cv::util::make_optional(std::move(thisCall));
 
@@ -965,19 +1030,20 @@ void PreprocEngine::preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &o
                            out_layout,
                            algorithm,
                            in_fmt,
-                           out_fmt));
+                           out_fmt,
+                           mean_scale));
         }
     }
 
     auto batched_input_plane_mats  = bind_to_blob(inBlob,  batch_size);
     auto batched_output_plane_mats = bind_to_blob(outBlob, batch_size);
 
-    executeGraph(_lastComputation, batched_input_plane_mats, batched_output_plane_mats, batch_size,
-        omp_serial, update);
+    executeGraph(batched_input_plane_mats, batched_output_plane_mats, batch_size, omp_serial, update);
 }
 
 void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob,
-        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size) {
+        const ResizeAlgorithm& algorithm, ColorFormat in_fmt, bool omp_serial, int batch_size,
+        const MeanScale& mean_scale) {
     const auto out_fmt = (in_fmt == ColorFormat::RAW) ? ColorFormat::RAW : ColorFormat::BGR;  // FIXME: get expected color format from network
 
     // output is always a memory blob
@@ -996,8 +1062,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected NV12Blob";
         }
-        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inNV12Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, mean_scale,
+            omp_serial, batch_size);
     }
     case ColorFormat::I420: {
         auto inI420Blob = as<I420Blob>(inBlob);
@@ -1005,8 +1071,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected I420Blob";
         }
-        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inI420Blob, outMemoryBlob, algorithm, in_fmt, out_fmt, mean_scale,
+            omp_serial, batch_size);
     }
 
     default:
@@ -1015,8 +1081,8 @@ void PreprocEngine::preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBl
             THROW_IE_EXCEPTION  << "Unsupported input blob for color format " << in_fmt
                                 << ": expected MemoryBlob";
         }
-        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, omp_serial,
-            batch_size);
+        return preprocessBlob(inMemoryBlob, outMemoryBlob, algorithm, in_fmt, out_fmt, mean_scale,
+            omp_serial, batch_size);
     }
 }
 }  // namespace InferenceEngine
@@ -20,13 +20,27 @@
 
 namespace InferenceEngine {
 
+// Per-channel (x - mean[c]) * scale[c] applied as the last step of the pre-processing graph.
+// Empty vectors mean no normalization
+struct MeanScale {
+    std::vector<float> mean;
+    std::vector<float> scale;
+
+    bool empty() const { return mean.empty(); }
+    bool operator==(const MeanScale& other) const { return mean == other.mean && scale == other.scale; }
+    bool operator!=(const MeanScale& other) const { return !(*this == other); }
+};
+
 class PreprocEngine {
     using BlobDesc = std::tuple<Precision, Layout, SizeVector, ColorFormat>;
-    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm>;
+    using CallDesc = std::tuple<BlobDesc, BlobDesc, ResizeAlgorithm, MeanScale>;
     template<typename T> using Opt = cv::util::optional<T>;
 
     Opt<CallDesc> _lastCall;
+    // graph is kept to compile tiles on demand when the batch size (and so the work split) changes
+    Opt<cv::GComputation> _lastComputation;
     std::vector<cv::GCompiled> _lastComp;
+    int _lastTiles = 0;
 
     openvino::itt::handle_t _perf_graph_building = openvino::itt::handle("Preproc Graph Building");
     openvino::itt::handle_t _perf_exec_tile = openvino::itt::handle("Preproc Calc Tile");
@@ -36,8 +50,7 @@ class PreprocEngine {
     enum class Update { REBUILD, RESHAPE, NOTHING };
     Update needUpdate(const CallDesc &newCall) const;
 
-    void executeGraph(Opt<cv::GComputation>& lastComputation,
-                      const std::vector<std::vector<cv::gapi::own::Mat>>& src,
+    void executeGraph(const std::vector<std::vector<cv::gapi::own::Mat>>& src,
                       std::vector<std::vector<cv::gapi::own::Mat>>& dst,
                       int batch_size,
                       bool omp_serial,
@@ -45,15 +58,15 @@ class PreprocEngine {
 
     template<typename BlobTypePtr>
     void preprocessBlob(const BlobTypePtr &inBlob, MemoryBlob::Ptr &outBlob,
-        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, bool omp_serial,
-        int batch_size);
+        ResizeAlgorithm algorithm, ColorFormat in_fmt, ColorFormat out_fmt, const MeanScale& mean_scale,
+        bool omp_serial, int batch_size);
 
 public:
     PreprocEngine();
     static void checkApplicabilityGAPI(const Blob::Ptr &src, const Blob::Ptr &dst);
     static int getCorrectBatchSize(int batch_size, const Blob::Ptr& roiBlob);
     void preprocessWithGAPI(const Blob::Ptr &inBlob, Blob::Ptr &outBlob, const ResizeAlgorithm &algorithm,
-        ColorFormat in_fmt, bool omp_serial, int batch_size = -1);
+        ColorFormat in_fmt, bool omp_serial, int batch_size = -1, const MeanScale& mean_scale = {});
 };
 
 }  // namespace InferenceEngine
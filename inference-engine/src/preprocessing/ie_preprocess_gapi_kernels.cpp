@@ -35,6 +35,7 @@
 #include <utility>
 #include <vector>
 #include <functional>
+#include <cstring>
 
 #if defined(__GNUC__) && (__GNUC__ <= 5)
 #include <cmath>
@@ -2399,6 +2400,65 @@ GAPI_FLUID_KERNEL(FConvertDepth, ConvertDepth, false) {
     }
 };
 
+namespace {
+
+inline uint16_t float_to_bf16(float value) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // keep NaNs quiet instead of rounding them to infinity
+    if ((bits & 0x7fffffffu) > 0x7f800000u) {
+        return static_cast<uint16_t>((bits >> 16) | 0x0040u);
+    }
+    // round to nearest even
+    bits += 0x7fffu + ((bits >> 16) & 1u);
+    return static_cast<uint16_t>(bits >> 16);
+}
+
+template <typename src_t>
+void normalize_row_32f(const uint8_t* src, uint8_t* dst, const int width, float scale, float shift) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<float *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        out[i] = static_cast<float>(in[i]) * scale + shift;
+    }
+}
+
+template <typename src_t>
+void normalize_row_bf16(const uint8_t* src, uint8_t* dst, const int width, float scale, float shift) {
+    const auto *in  = reinterpret_cast<const src_t *>(src);
+          auto *out = reinterpret_cast<uint16_t *>(dst);
+
+    for (int i = 0; i < width; i++) {
+        out[i] = float_to_bf16(static_cast<float>(in[i]) * scale + shift);
+    }
+}
+
+}  // namespace
+
+GAPI_FLUID_KERNEL(FNormalizePlane, NormalizePlane, false) {
+    static const int Window = 1;
+
+    static void run(const cv::gapi::fluid::View& src, float mean, float scale, int /*depth*/,
+                    cv::gapi::fluid::Buffer& dst) {
+        GAPI_Assert(src.meta().depth == CV_8U || src.meta().depth == CV_32F);
+        GAPI_Assert(dst.meta().depth == CV_32F || dst.meta().depth == CV_16U);
+        GAPI_Assert(src.meta().chan == 1);
+        GAPI_Assert(dst.meta().chan == 1);
+        GAPI_Assert(src.length() == dst.length());
+
+        using p_f = void (*)(const uint8_t* src, uint8_t* dst, const int width, float scale, float shift);
+
+        const bool src_8u  = src.meta().depth == CV_8U;
+        const bool dst_32f = dst.meta().depth == CV_32F;
+        const p_f rowFunc = dst_32f ? (src_8u ? normalize_row_32f<uint8_t>  : normalize_row_32f<float>)
+                                    : (src_8u ? normalize_row_bf16<uint8_t> : normalize_row_bf16<float>);
+
+        // (x - mean) * scale == x * scale + shift
+        rowFunc(src.InLineB(0), dst.OutLineB(), dst.length(), scale, -mean * scale);
+    }
+};
+
 }  // namespace kernels
 
 //----------------------------------------------------------------------
@@ -2426,6 +2486,7 @@ cv::gapi::GKernelPackage preprocKernels() {
         , FNV12toRGB
         , FI420toRGB
         , FConvertDepth
+        , FNormalizePlane
         >();
 }
 
@@ -152,7 +152,17 @@ namespace gapi {
         }
     };
 
+    // Computes (x - mean) * scale and converts the result to the requested depth
+    // in the same pass. CV_16U output depth stands for BF16 here
+    G_TYPED_KERNEL(NormalizePlane, <cv::GMat(cv::GMat, float mean, float scale, int depth)>, "com.intel.ie.normalize_plane") {
+        static cv::GMatDesc outMeta(const cv::GMatDesc& in, float, float, int depth) {
+            GAPI_Assert(in.chan == 1);
+            GAPI_Assert(in.depth == CV_8U || in.depth == CV_32F);
+            GAPI_Assert(depth == CV_32F || depth == CV_16U);
 
+            return in.withDepth(depth);
+        }
+    };
 
     cv::gapi::GKernelPackage preprocKernels();
 
@@ -0,0 +1,511 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_ir_binary_reader.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <ngraph/ngraph.hpp>
+#include <ngraph/op/util/variable.hpp>
+#include <ngraph/opsets/opset.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/variant.hpp>
+#include <openvino/itt.hpp>
+#include <transformations/serialize_binary_format.hpp>
+
+using namespace InferenceEngine;
+namespace binary_ir = ngraph::binary_ir;
+
+namespace InferenceEngine {
+namespace itt {
+namespace domains {
+    OV_ITT_DOMAIN(BinaryIRReader);
+}
+}
+}
+
+namespace {
+
+/**
+ * @brief Bounds checked access to the records of the binary IR container kept in memory
+ */
+class BinaryIRView {
+public:
+    explicit BinaryIRView(std::istream& model) {
+        model.seekg(0, model.end);
+        _size = static_cast<size_t>(model.tellg());
+        model.seekg(0, model.beg);
+        // the storage of 64 bit words keeps the records aligned
+        _buffer.resize((_size + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        model.read(reinterpret_cast<char*>(_buffer.data()), _size);
+        if (static_cast<size_t>(model.gcount()) != _size || _size < sizeof(binary_ir::Header)) {
+            THROW_IE_EXCEPTION << "Binary IR is truncated";
+        }
+
+        const auto& h = header();
+        if (h.magic != binary_ir::magic) {
+            THROW_IE_EXCEPTION << "The model is not a binary IR";
+        }
+        if (h.version != binary_ir::version) {
+            THROW_IE_EXCEPTION << "Unsupported binary IR version: " << h.version;
+        }
+        if (h.data_offset % alignof(uint64_t) != 0 || h.data_offset > _size || h.data_size > _size - h.data_offset) {
+            THROW_IE_EXCEPTION << "Binary IR data section is out of the file bounds";
+        }
+        checkTable<binary_ir::Node>(h.nodes);
+        checkTable<binary_ir::Input>(h.inputs);
+        checkTable<binary_ir::Output>(h.outputs);
+        checkTable<binary_ir::Attribute>(h.attributes);
+        checkTable<uint32_t>(h.parameters);
+        checkTable<uint32_t>(h.results);
+        checkTable<uint32_t>(h.sinks);
+    }
+
+    const binary_ir::Header& header() const {
+        return *reinterpret_cast<const binary_ir::Header*>(_buffer.data());
+    }
+
+    template <typename T>
+    const T* table(const binary_ir::TableRef& ref) const {
+        return reinterpret_cast<const T*>(bytes() + ref.offset);
+    }
+
+    template <typename T>
+    const T* range(const binary_ir::TableRef& ref, const binary_ir::Range& range) const {
+        if (static_cast<uint64_t>(range.first) + range.count > ref.count) {
+            THROW_IE_EXCEPTION << "Binary IR record range is out of the table bounds";
+        }
+        return table<T>(ref) + range.first;
+    }
+
+    std::pair<const char*, size_t> string(const binary_ir::StringRef& ref) const {
+        checkData(ref.offset, ref.size);
+        return {data() + ref.offset, static_cast<size_t>(ref.size)};
+    }
+
+    std::string toString(const binary_ir::StringRef& ref) const {
+        auto str = string(ref);
+        return {str.first, str.second};
+    }
+
+    template <typename T>
+    const T* array(const binary_ir::ArrayRef& ref) const {
+        if (ref.count > _size / sizeof(T)) {
+            THROW_IE_EXCEPTION << "Binary IR array is out of the data section bounds";
+        }
+        checkData(ref.offset, ref.count * sizeof(T));
+        return reinterpret_cast<const T*>(data() + ref.offset);
+    }
+
+    std::vector<std::string> strings(const binary_ir::ArrayRef& ref) const {
+        std::vector<std::string> result;
+        auto refs = array<binary_ir::StringRef>(ref);
+        for (uint64_t i = 0; i < ref.count; ++i) {
+            result.emplace_back(toString(refs[i]));
+        }
+        return result;
+    }
+
+    bool equals(const binary_ir::StringRef& ref, const std::string& str) const {
+        auto value = string(ref);
+        return value.second == str.size() && std::memcmp(value.first, str.data(), str.size()) == 0;
+    }
+
+private:
+    const char* bytes() const {
+        return reinterpret_cast<const char*>(_buffer.data());
+    }
+
+    const char* data() const {
+        return bytes() + header().data_offset;
+    }
+
+    template <typename T>
+    void checkTable(const binary_ir::TableRef& ref) const {
+        if (ref.offset % alignof(T) != 0 || ref.offset > _size || ref.count > (_size - ref.offset) / sizeof(T)) {
+            THROW_IE_EXCEPTION << "Binary IR table is out of the file bounds";
+        }
+    }
+
+    void checkData(uint64_t offset, uint64_t size) const {
+        if (offset > header().data_size || size > header().data_size - offset) {
+            THROW_IE_EXCEPTION << "Binary IR value is out of the data section bounds";
+        }
+    }
+
+    std::vector<uint64_t> _buffer;
+    size_t _size = 0;
+};
+
+class BinaryDeserializer : public ngraph::AttributeVisitor {
+public:
+    BinaryDeserializer(const BinaryIRView& ir,
+                       const binary_ir::Node& node,
+                       const Blob::CPtr& weights,
+                       std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
+        : _ir(ir), _attributes(ir.range<binary_ir::Attribute>(ir.header().attributes, node.attributes)),
+          _count(node.attributes.count), _weights(weights), _variables(variables) {}
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<void>& adapter) override {
+        auto attribute = find(name);
+        if (attribute == nullptr) return;
+        if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            check(*attribute, name, binary_ir::AttributeType::variable, false);
+            auto variableId = _ir.strings(attribute->value).at(0);
+            auto& variable = _variables[variableId];
+            if (variable == nullptr) {
+                variable = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
+                    ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variableId});
+            }
+            a->set(variable);
+        } else if (auto a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            check(*attribute, name, binary_ir::AttributeType::weights, false);
+            const auto offset = attribute->value.offset;
+            const auto size = attribute->value.count;
+            if (_weights == nullptr || _weights->byteSize() == 0)
+                THROW_IE_EXCEPTION << "Empty weights data in bin file or bin file cannot be found!";
+            if (offset > _weights->byteSize() || size > _weights->byteSize() - offset)
+                THROW_IE_EXCEPTION << "Incorrect weights in bin file!";
+            if (size < dataSize(name))
+                THROW_IE_EXCEPTION << "Attribute and shape size are inconsistent for " << name << " attribute!";
+
+            // the Constant data points into the weights
+            using SharedBuffer = ngraph::runtime::SharedBuffer<const Blob::CPtr>;
+            a->set(std::make_shared<SharedBuffer>(_weights->cbuffer().as<char*>() + offset, size, _weights));
+        }
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        if (auto attribute = find(name)) {
+            check(*attribute, name, binary_ir::AttributeType::boolean, false);
+            adapter.set(*_ir.array<uint8_t>(attribute->value) != 0);
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        if (auto attribute = find(name)) {
+            check(*attribute, name, binary_ir::AttributeType::string, false);
+            adapter.set(_ir.strings(attribute->value).at(0));
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        setScalar(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        setVector(name, adapter);
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        if (auto attribute = find(name)) {
+            check(*attribute, name, binary_ir::AttributeType::string, true);
+            adapter.set(_ir.strings(attribute->value));
+        }
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<ngraph::Function>>&) override {
+        THROW_IE_EXCEPTION << "Binary IR does not support the operations with a body, attribute: " << name;
+    }
+
+private:
+    const binary_ir::Attribute* find(const std::string& name) const {
+        for (uint32_t i = 0; i < _count; ++i) {
+            if (_ir.equals(_attributes[i].name, name)) {
+                return _attributes + i;
+            }
+        }
+        return nullptr;
+    }
+
+    // the size of the data of the element type and the shape attributes stored with the weights attribute
+    size_t dataSize(const std::string& name) const {
+        auto typeAttribute = find("element_type");
+        auto shapeAttribute = find("shape");
+        if (typeAttribute == nullptr || shapeAttribute == nullptr)
+            THROW_IE_EXCEPTION << "Binary IR attribute " << name << " has no element type or shape";
+        check(*typeAttribute, "element_type", binary_ir::AttributeType::string, false);
+        check(*shapeAttribute, "shape", binary_ir::attribute_type<int64_t>::value, true);
+
+        ngraph::element::Type type;
+        ngraph::AttributeAdapter<ngraph::element::Type>(type).set(_ir.strings(typeAttribute->value).at(0));
+
+        auto dims = _ir.array<int64_t>(shapeAttribute->value);
+        const size_t maxElements = std::numeric_limits<size_t>::max() / std::max<size_t>(type.bitwidth(), 1);
+        size_t elements = 1;
+        for (uint64_t i = 0; i < shapeAttribute->value.count; ++i) {
+            if (dims[i] < 0 || (dims[i] != 0 && elements > maxElements / static_cast<size_t>(dims[i])))
+                THROW_IE_EXCEPTION << "Binary IR attribute shape has incorrect dimensions for " << name;
+            elements *= static_cast<size_t>(dims[i]);
+        }
+        return (elements * type.bitwidth() + 7) / 8;
+    }
+
+    static void check(const binary_ir::Attribute& attribute, const std::string& name,
+                      binary_ir::AttributeType type, bool isVector) {
+        if (attribute.type != type || (attribute.is_vector != 0) != isVector) {
+            THROW_IE_EXCEPTION << "Binary IR attribute " << name << " has unexpected type";
+        }
+    }
+
+    template <typename T>
+    void setScalar(const std::string& name, ngraph::ValueAccessor<T>& adapter) {
+        if (auto attribute = find(name)) {
+            check(*attribute, name, binary_ir::attribute_type<T>::value, false);
+            T value;
+            std::memcpy(&value, _ir.array<T>(attribute->value), sizeof(T));
+            adapter.set(value);
+        }
+    }
+
+    template <typename T>
+    void setVector(const std::string& name, ngraph::ValueAccessor<std::vector<T>>& adapter) {
+        if (auto attribute = find(name)) {
+            check(*attribute, name, binary_ir::attribute_type<T>::value, true);
+            auto values = _ir.array<T>(attribute->value);
+            adapter.set(std::vector<T>(values, values + attribute->value.count));
+        }
+    }
+
+    const BinaryIRView& _ir;
+    const binary_ir::Attribute* _attributes;
+    uint32_t _count;
+    const Blob::CPtr& _weights;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& _variables;
+};
+
+class BinaryIRParser {
+public:
+    explicit BinaryIRParser(const std::vector<IExtensionPtr>& exts) {
+        _opsets["opset1"] = ngraph::get_opset1();
+        _opsets["opset2"] = ngraph::get_opset2();
+        _opsets["opset3"] = ngraph::get_opset3();
+        _opsets["opset4"] = ngraph::get_opset4();
+        _opsets["opset5"] = ngraph::get_opset5();
+        _opsets["opset6"] = ngraph::get_opset6();
+
+        for (const auto& ext : exts) {
+            for (const auto& it : ext->getOpSets()) {
+                if (_opsets.find(it.first) != _opsets.end())
+                    THROW_IE_EXCEPTION << "Cannot add opset with name: " << it.first
+                                       << ". Opset with the same name already exists.";
+                _opsets[it.first] = it.second;
+            }
+        }
+    }
+
+    std::shared_ptr<ngraph::Function> parse(const BinaryIRView& ir, const Blob::CPtr& weights) {
+        const auto& header = ir.header();
+        auto nodes = ir.table<binary_ir::Node>(header.nodes);
+
+        std::vector<std::shared_ptr<ngraph::Node>> created;
+        created.reserve(header.nodes.count);
+        std::map<std::string, std::shared_ptr<ngraph::Node>> variableIdToReadValue;
+        for (uint64_t id = 0; id < header.nodes.count; ++id) {
+            const auto& node = nodes[id];
+            ngraph::OutputVector inputs;
+            auto nodeInputs = ir.range<binary_ir::Input>(header.inputs, node.inputs);
+            for (uint32_t i = 0; i < node.inputs.count; ++i) {
+                // the nodes are stored in the topological order, so the producers are already created
+                if (nodeInputs[i].node >= created.size() ||
+                    nodeInputs[i].output >= created[nodeInputs[i].node]->get_output_size()) {
+                    THROW_IE_EXCEPTION << "Binary IR node " << ir.toString(node.name) << " has incorrect input " << i;
+                }
+                inputs.push_back(created[nodeInputs[i].node]->output(nodeInputs[i].output));
+            }
+
+            auto ngraphNode = createNode(ir, node, inputs, weights);
+            if (const auto& readValue = std::dynamic_pointer_cast<ngraph::op::ReadValueBase>(ngraphNode)) {
+                variableIdToReadValue[readValue->get_variable_id()] = readValue;
+            }
+            created.emplace_back(std::move(ngraphNode));
+        }
+
+        auto getNodes = [&] (const binary_ir::TableRef& ref) {
+            std::vector<std::shared_ptr<ngraph::Node>> result;
+            auto ids = ir.table<uint32_t>(ref);
+            for (uint64_t i = 0; i < ref.count; ++i) {
+                if (ids[i] >= created.size()) {
+                    THROW_IE_EXCEPTION << "Binary IR refers to unknown node " << ids[i];
+                }
+                result.push_back(created[ids[i]]);
+            }
+            return result;
+        };
+
+        ngraph::ParameterVector parameters;
+        for (const auto& node : getNodes(header.parameters)) {
+            auto parameter = std::dynamic_pointer_cast<ngraph::op::Parameter>(node);
+            if (!parameter) THROW_IE_EXCEPTION << "Binary IR parameter " << node->get_friendly_name() << " is not a Parameter";
+            parameters.emplace_back(parameter);
+        }
+        ngraph::ResultVector results;
+        for (const auto& node : getNodes(header.results)) {
+            auto result = std::dynamic_pointer_cast<ngraph::op::Result>(node);
+            if (!result) THROW_IE_EXCEPTION << "Binary IR result " << node->get_friendly_name() << " is not a Result";
+            results.emplace_back(result);
+        }
+        ngraph::SinkVector sinks;
+        for (const auto& node : getNodes(header.sinks)) {
+            auto sink = std::dynamic_pointer_cast<ngraph::op::Sink>(node);
+            if (!sink) THROW_IE_EXCEPTION << "Binary IR sink " << node->get_friendly_name() << " is not a Sink";
+            sinks.emplace_back(sink);
+        }
+
+        auto function = std::make_shared<ngraph::Function>(results, sinks, parameters, ir.toString(header.name));
+        for (const auto& sink : sinks) {
+            if (const auto& assign = std::dynamic_pointer_cast<ngraph::op::AssignBase>(sink)) {
+                assign->add_control_dependency(variableIdToReadValue.at(assign->get_variable_id()));
+            }
+        }
+        return function;
+    }
+
+private:
+    std::shared_ptr<ngraph::Node> createNode(const BinaryIRView& ir,
+                                             const binary_ir::Node& node,
+                                             const ngraph::OutputVector& inputs,
+                                             const Blob::CPtr& weights) {
+        const auto type = ir.toString(node.type);
+        const auto version = ir.toString(node.opset);
+        const auto name = ir.toString(node.name);
+
+        std::shared_ptr<ngraph::Node> ngraphNode;
+        auto opsetIt = _opsets.find(version);
+        if (opsetIt != _opsets.end()) {
+            ngraphNode.reset(opsetIt->second.create(type));
+        } else {
+            // the experimental operations which were added to the opsets later
+            for (auto&& opset : {"opset6", "opset5", "opset4", "opset3", "opset2", "opset1"}) {
+                ngraphNode.reset(_opsets.at(opset).create(type));
+                if (ngraphNode) break;
+            }
+        }
+        if (!ngraphNode) {
+            THROW_IE_EXCEPTION << "Cannot create " << type << " layer " << name << " from unsupported opset: " << version;
+        }
+
+        // Share Weights form constant blob
+        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
+            constant->alloc_buffer_on_visit_attributes(false);
+        }
+        ngraphNode->set_arguments(inputs);
+        BinaryDeserializer visitor(ir, node, weights, _variables);
+        if (ngraphNode->visit_attributes(visitor)) {
+            ngraphNode->constructor_validate_and_infer_types();
+        }
+        // To be sure that all default values will be initialized:
+        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+
+        auto& rtInfo = ngraphNode->get_rt_info();
+        auto rtInfoAttributes = ir.range<binary_ir::Attribute>(ir.header().attributes, node.rt_info);
+        for (uint32_t i = 0; i < node.rt_info.count; ++i) {
+            rtInfo[ir.toString(rtInfoAttributes[i].name)] =
+                std::make_shared<ngraph::VariantWrapper<std::string>>(ir.strings(rtInfoAttributes[i].value).at(0));
+        }
+
+        ngraphNode->set_friendly_name(name);
+        auto outputs = ir.range<binary_ir::Output>(ir.header().outputs, node.outputs);
+        for (uint32_t i = 0; i < node.outputs.count && i < ngraphNode->get_output_size(); ++i) {
+            auto names = ir.strings(outputs[i].names);
+            if (!names.empty())
+                ngraphNode->get_output_tensor(i).set_names({names.begin(), names.end()});
+        }
+        return ngraphNode;
+    }
+
+    std::unordered_map<std::string, ngraph::OpSet> _opsets;
+    std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> _variables;
+};
+
+}  // namespace
+
+bool IRBinaryReader::supportModel(std::istream& model) const {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryIRReader, "IRBinaryReader::supportModel");
+
+    uint32_t magic = 0;
+    model.seekg(0, model.beg);
+    model.read(reinterpret_cast<char*>(&magic), sizeof(magic));
+    model.clear();
+    model.seekg(0, model.beg);
+    return magic == binary_ir::magic;
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const std::vector<IExtensionPtr>& exts) const {
+    return read(model, nullptr, exts);
+}
+
+CNNNetwork IRBinaryReader::read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const {
+    OV_ITT_SCOPED_TASK(itt::domains::BinaryIRReader, "IRBinaryReader::read");
+
+    BinaryIRView ir(model);
+    BinaryIRParser parser(exts);
+    return CNNNetwork(parser.parse(ir, weights), exts);
+}
+
+INFERENCE_PLUGIN_API(StatusCode) InferenceEngine::CreateReader(IReader*& reader, ResponseDesc *resp) noexcept {
+    try {
+        reader = new IRBinaryReader();
+        return OK;
+    }
+    catch (std::exception &) {
+        return GENERAL_ERROR;
+    }
+}
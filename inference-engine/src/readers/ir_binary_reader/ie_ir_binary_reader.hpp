@@ -0,0 +1,56 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_api.h>
+#include <ie_blob.h>
+#include <ie_common.h>
+#include <ie_iextension.h>
+
+#include <ie_reader.hpp>
+#include <istream>
+#include <string>
+#include <vector>
+
+namespace InferenceEngine {
+
+/**
+ * @brief This class reads the binary IR written by the ngraph::pass::Serialize with the IR_V10_BINARY version
+ */
+class IRBinaryReader: public IReader {
+public:
+    void Release() noexcept override {
+        delete this;
+    }
+    /**
+     * @brief Checks that reader supports format of the model
+     * @param model stream with model
+     * @return true if the stream starts with the binary IR header
+     */
+    bool supportModel(std::istream& model) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const std::vector<IExtensionPtr>& exts) const override;
+    /**
+     * @brief Reads the model to CNNNetwork
+     * @param model stream with model
+     * @param weights blob with binary data
+     * @param exts vector with extensions
+     *
+     * @return CNNNetwork
+     */
+    CNNNetwork read(std::istream& model, const Blob::CPtr& weights, const std::vector<IExtensionPtr>& exts) const override;
+
+    std::vector<std::string> getDataFileExtensions() const override {
+        return {"bin"};
+    }
+};
+
+}  // namespace InferenceEngine
@@ -7,6 +7,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <exception>
 #include <map>
 #include <memory>
 #include <ngraph/ngraph.hpp>
@@ -27,6 +28,7 @@
 
 #include <cpp/ie_cnn_network.h>
 #include <ie_ngraph_utils.hpp>
+#include <ie_parallel.hpp>
 #include "blob_factory.hpp"
 #include "caseless.hpp"
 #include "precision_utils.h"
@@ -36,10 +38,10 @@ namespace InferenceEngine {
 
 IRParser::IRParser(size_t version) : IRParser(version, {}) {}
 
-IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts) {
+IRParser::IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts, bool parallel) {
     switch (version) {
     case 10:
-        parser = std::make_shared<V10Parser>(exts);
+        parser = std::make_shared<V10Parser>(exts, parallel);
         break;
     default:
         THROW_IE_EXCEPTION << "Unsupported IR version: " << version;
@@ -88,6 +90,26 @@ bool stringToType(const std::string& valStr, T& value) {
     return !ss.fail();
 }
 
+/// \brief Runs func(i) for i in [0, size), concurrently if parallel is set. The exceptions do not leave
+/// the loop, they are returned per index, so the caller can report them in the sequential order
+template <class F>
+std::vector<std::exception_ptr> parallelForEach(bool parallel, size_t size, const F& func) {
+    std::vector<std::exception_ptr> errors(size);
+    auto body = [&](size_t i) {
+        try {
+            func(i);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+    if (parallel) {
+        parallel_for(size, body);
+    } else {
+        for (size_t i = 0; i < size; ++i) body(i);
+    }
+    return errors;
+}
+
 class XmlDeserializer : public ngraph::AttributeVisitor {
 public:
     /// TODO: move whole class to src file
@@ -95,8 +117,11 @@ public:
         const pugi::xml_node& node,
         const Blob::CPtr& weights,
         const std::unordered_map<std::string, ngraph::OpSet>& opsets,
-        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables)
-        : node(node), weights(weights), opsets(opsets), variables(variables) {}
+        std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables,
+        std::mutex& variables_mutex,
+        bool parallel)
+        : node(node), weights(weights), opsets(opsets), variables(variables),
+          variables_mutex(variables_mutex), parallel(parallel) {}
 
     void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& value) override {
         std::string val;
@@ -203,10 +228,25 @@ private:
 
     V10Parser::GenericLayerParams parseGenericParams(const pugi::xml_node& node);
 
+    /// \brief The operation with the attributes read from xml, but not connected to the inputs yet
+    struct DecodedNode {
+        std::shared_ptr<ngraph::Node> node;
+        bool validate = false;
+        std::exception_ptr error;
+    };
+
+    /// \brief Creates the operation and reads its attributes. Does not touch the other operations,
+    /// so the layers can be decoded concurrently
+    DecodedNode decodeNode(
+        const pugi::xml_node& node,
+        const Blob::CPtr& weights,
+        const V10Parser::GenericLayerParams& params);
+
+    /// \brief Connects the decoded operation to the inputs and infers its output types
     std::shared_ptr<ngraph::Node> createNode(
         const ngraph::OutputVector& inputs,
         const pugi::xml_node& node,
-        const Blob::CPtr& weights,
+        const DecodedNode& decoded,
         const V10Parser::GenericLayerParams& params);
 
     // -- DATA --
@@ -214,6 +254,9 @@ private:
     const Blob::CPtr& weights;
     const std::unordered_map<std::string, ngraph::OpSet>& opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>>& variables;
+    // the layers may be decoded concurrently, see parse_function
+    std::mutex& variables_mutex;
+    const bool parallel;
 
     ///
     /// store information about parameters/results order during function creation
@@ -477,6 +520,7 @@ void XmlDeserializer::on_adapter(const std::string& name, ngraph::ValueAccessor<
             &adapter)) {
         std::string variable_id;
         if (!getStrAttribute(node.child("data"), name, variable_id)) return;
+        std::lock_guard<std::mutex> lock(variables_mutex);
         if (!variables.count(variable_id)) {
             variables[variable_id] = std::make_shared<ngraph::Variable>(ngraph::VariableInfo{
                 ngraph::PartialShape::dynamic(), ngraph::element::dynamic, variable_id});
@@ -569,15 +613,24 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::unordered_set<std::string> opName;
 
     // Read all layers and store their parameters in params map
+    std::vector<pugi::xml_node> layers;
     FOREACH_CHILD(node, root.child("layers"), "layer") {
-        auto node_param = parseGenericParams(node);
+        layers.push_back(node);
+    }
+    std::vector<V10Parser::GenericLayerParams> layers_params(layers.size());
+    auto parse_errors = parallelForEach(parallel, layers.size(), [&](size_t i) {
+        layers_params[i] = parseGenericParams(layers[i]);
+    });
+    for (size_t i = 0; i < layers.size(); ++i) {
+        if (parse_errors[i]) std::rethrow_exception(parse_errors[i]);
+        auto& node_param = layers_params[i];
         if (opName.find(node_param.name) != opName.end() && node_param.type != "Result")
             THROW_IE_EXCEPTION << "Invalid IR! " << node_param.name << " name is not unique!";
         opName.insert(node_param.name);
-        params[node_param.layerId] = {node, node_param};
         if (node_param.type == "Result" || node_param.type == "Assign") {
             outputs.push_back(node_param.layerId);
         }
+        params[node_param.layerId] = {layers[i], std::move(node_param)};
     }
 
     std::map<size_t/*to-layer-id*/, std::vector<edge>> edges;
@@ -605,6 +658,33 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     };
     std::for_each(outputs.begin(), outputs.end(), dfs);
 
+    OV_ITT_TASK_NEXT(taskChain, "DecodeNgraphNodes");
+
+    // Decode the attributes of all the layers, concurrently if the parallel read is enabled. The layers
+    // without inputs (Constants, Parameters) do not depend on the other layers and are created completely
+    // at this step.
+    // The rest are connected and validated below in the topological order, since the validation
+    // of an operation modifies its producers (the consumers list, the cached bounds of the values)
+    std::vector<node_params*> ordered_params(order.size());
+    std::vector<bool> has_inputs(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        ordered_params[i] = &params[order[i]];
+        has_inputs[i] = !edges[order[i]].empty();
+    }
+    std::vector<DecodedNode> decoded(order.size());
+    std::vector<std::shared_ptr<ngraph::Node>> created(order.size());
+    parallelForEach(parallel, order.size(), [&](size_t i) {
+        const auto& p = *ordered_params[i];
+        decoded[i] = decodeNode(p.xml, weights, p.params);
+        if (!has_inputs[i]) {
+            try {
+                created[i] = createNode({}, p.xml, decoded[i], p.params);
+            } catch (...) {
+                decoded[i].error = std::current_exception();
+            }
+        }
+    });
+
     OV_ITT_TASK_NEXT(taskChain, "ConstructNgraphNodes");
 
     FunctionNodes func_nodes;
@@ -612,8 +692,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
     std::map<std::string, std::shared_ptr<ngraph::Node>> variable_id_to_read_value;
 
     //  Following topological order create nGraph operations
-    for (auto& layer_id : order) {
-        auto& p = params[layer_id];
+    for (size_t order_id = 0; order_id < order.size(); ++order_id) {
+        const auto layer_id = order[order_id];
+        auto& p = *ordered_params[order_id];
         ngraph::OutputVector inputs(edges[layer_id].size());
         for (auto& e : edges[layer_id]) {
             auto input_node = id_to_node[e.fromLayerId];
@@ -630,7 +711,9 @@ std::shared_ptr<ngraph::Function> XmlDeserializer::parse_function(
                 input_node->output(p_output.getRealOutputPortId(e.fromPortId));
         }
 
-        auto node = createNode(inputs, p.xml, weights, p.params);
+        auto node = created[order_id] ? created[order_id]
+                                      : createNode(inputs, p.xml, decoded[order_id], p.params);
+        decoded[order_id] = {};
         id_to_node[layer_id] = node;
 
         // Check that output shape after nGraph node validation the same as in IR
@@ -750,10 +833,77 @@ V10Parser::V10Parser::GenericLayerParams XmlDeserializer::parseGenericParams(
     return params;
 }
 
+XmlDeserializer::DecodedNode XmlDeserializer::decodeNode(
+    const pugi::xml_node& node,
+    const Blob::CPtr& weights,
+    const V10Parser::GenericLayerParams& params) {
+    DecodedNode decoded;
+    try {
+        // Find registered opset
+        auto opsetIt = opsets.find(params.version);
+
+        // Try to create operation from loaded opsets
+        static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
+            "ExperimentalDetectronDetectionOutput",
+            "ExperimentalDetectronGenerateProposalsSingleImage",
+            "ExperimentalDetectronPriorGridGenerator",
+            "ExperimentalDetectronROIFeatureExtractor",
+            "ExperimentalDetectronTopKROIs",
+            "GRUCell",
+            "RNNCell",
+            "Proposal"};
+
+        if (experimental_ops_added_to_opset.count(params.type) &&
+            (params.version == "experimental" || params.version == "extension")) {
+            opsetIt = opsets.find("opset6");
+        }
+
+        if (opsetIt != opsets.end()) {
+            auto const& type = params.type == "Const" ? "Constant" : params.type;
+
+            if (params.version == "opset1") {
+                // MVN, ROIPooling and ReorgYolo were missing in opset1
+                if (type == "MVN" || type == "ROIPooling" || type == "ReorgYolo") {
+                    opsetIt = opsets.find("opset2");
+                    if (opsetIt == opsets.end()) {
+                        THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer "
+                                           << params.name << " id:" << params.layerId
+                                           << " from unsupported opset: " << params.version;
+                    }
+                }
+            }
+
+            auto const& opset = opsetIt->second;
+
+            decoded.node = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
+            if (!decoded.node) {
+                THROW_IE_EXCEPTION << "Opset " << params.version
+                                   << " doesn't contain the operation with type: " << type;
+            }
+            // Share Weights form constant blob
+            if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(decoded.node)) {
+                constant->alloc_buffer_on_visit_attributes(false);
+            }
+            XmlDeserializer visitor(node, weights, opsets, variables, variables_mutex, parallel);
+            decoded.validate = decoded.node->visit_attributes(visitor);
+        }
+
+        if (!decoded.node) {
+            THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer " << params.name
+                               << " id:" << params.layerId
+                               << " from unsupported opset: " << params.version;
+        }
+    } catch (...) {
+        decoded.node.reset();
+        decoded.error = std::current_exception();
+    }
+    return decoded;
+}
+
 std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
     const std::vector<ngraph::Output<ngraph::Node>>& inputs,
     const pugi::xml_node& node,
-    const Blob::CPtr& weights,
+    const DecodedNode& decoded,
     const V10Parser::GenericLayerParams& params) {
     // Check that inputs are correctly defined
     for (size_t i = 0; i < inputs.size(); i++) {
@@ -767,68 +917,18 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
                                << " has undefined element type for input with index " << i << "!";
     }
 
-    std::shared_ptr<ngraph::Node> ngraphNode;
-
-    // Find registered opset
-    auto opsetIt = opsets.find(params.version);
-
-    // Try to create operation from loaded opsets
-    static const std::unordered_set<std::string> experimental_ops_added_to_opset = {
-        "ExperimentalDetectronDetectionOutput",
-        "ExperimentalDetectronGenerateProposalsSingleImage",
-        "ExperimentalDetectronPriorGridGenerator",
-        "ExperimentalDetectronROIFeatureExtractor",
-        "ExperimentalDetectronTopKROIs",
-        "GRUCell",
-        "RNNCell",
-        "Proposal"};
-
-    if (experimental_ops_added_to_opset.count(params.type) &&
-        (params.version == "experimental" || params.version == "extension")) {
-        opsetIt = opsets.find("opset6");
+    if (decoded.error) {
+        std::rethrow_exception(decoded.error);
     }
 
-    if (!ngraphNode && opsetIt != opsets.end()) {
-        auto const& type = params.type == "Const" ? "Constant" : params.type;
-
-        if (params.version == "opset1") {
-            // MVN, ROIPooling and ReorgYolo were missing in opset1
-            if (type == "MVN" || type == "ROIPooling" || type == "ReorgYolo") {
-                opsetIt = opsets.find("opset2");
-                if (opsetIt == opsets.end()) {
-                    THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer "
-                                       << params.name << " id:" << params.layerId
-                                       << " from unsupported opset: " << params.version;
-                }
-            }
-        }
-
-        auto const& opset = opsetIt->second;
-
-        ngraphNode = std::shared_ptr<ngraph::Node>(opset.create_insensitive(type));
-        if (!ngraphNode) {
-            THROW_IE_EXCEPTION << "Opset " << params.version
-                               << " doesn't contain the operation with type: " << type;
-        }
-        // Share Weights form constant blob
-        if (auto constant = std::dynamic_pointer_cast<ngraph::opset6::Constant>(ngraphNode)) {
-            constant->alloc_buffer_on_visit_attributes(false);
-        }
-        ngraphNode->set_arguments(inputs);
-        XmlDeserializer visitor(node, weights, opsets, variables);
-        if (ngraphNode->visit_attributes(visitor)) {
-            ngraphNode->constructor_validate_and_infer_types();
-        }
-
-        // To be sure that all default values will be initialized:
-        ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
+    std::shared_ptr<ngraph::Node> ngraphNode = decoded.node;
+    ngraphNode->set_arguments(inputs);
+    if (decoded.validate) {
+        ngraphNode->constructor_validate_and_infer_types();
     }
 
-    if (!ngraphNode) {
-        THROW_IE_EXCEPTION << "Cannot create " << params.type << " layer " << params.name
-                           << " id:" << params.layerId
-                           << " from unsupported opset: " << params.version;
-    }
+    // To be sure that all default values will be initialized:
+    ngraphNode = ngraphNode->clone_with_new_inputs(ngraphNode->input_values());
 
     // Save run time info
     auto& rtInfo = ngraphNode->get_rt_info();
@@ -857,7 +957,7 @@ std::shared_ptr<ngraph::Node> XmlDeserializer::createNode(
 
 }  // namespace
 
-V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
+V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts, bool parallel) : _exts(exts), _parallel(parallel) {
     // Load default opsets
     opsets["opset1"] = ngraph::get_opset1();
     opsets["opset2"] = ngraph::get_opset2();
@@ -880,7 +980,7 @@ V10Parser::V10Parser(const std::vector<IExtensionPtr>& exts) : _exts(exts) {
 std::shared_ptr<ICNNNetwork> V10Parser::parse(
     const pugi::xml_node& root, const Blob::CPtr& weights) {
     std::shared_ptr<ngraph::Function> function;
-    XmlDeserializer visitor(root, weights, opsets, variables);
+    XmlDeserializer visitor(root, weights, opsets, variables, variablesMutex, _parallel);
     visitor.on_attribute("net", function);
 
     OV_ITT_SCOPED_TASK(itt::domains::V10Reader_RT, "ConstructCNNNetwork");
@@ -22,6 +22,7 @@
 #include <cctype>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <sstream>
 #include <string>
@@ -41,7 +42,7 @@ public:
 class IRParser {
 public:
     explicit IRParser(size_t version);
-    IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts);
+    IRParser(size_t version, const std::vector<InferenceEngine::IExtensionPtr>& exts, bool parallel = false);
     std::shared_ptr<ICNNNetwork> parse(const pugi::xml_node& root, const Blob::CPtr& weights);
     virtual ~IRParser() = default;
 
@@ -59,7 +60,7 @@ public:
 #ifdef IR_READER_V10
 class V10Parser : public IParser {
 public:
-    explicit V10Parser(const std::vector<IExtensionPtr>& exts);
+    explicit V10Parser(const std::vector<IExtensionPtr>& exts, bool parallel = false);
 
     std::shared_ptr<ICNNNetwork> parse(
         const pugi::xml_node& root, const Blob::CPtr& weights) override;
@@ -89,7 +90,9 @@ private:
 
     std::unordered_map<std::string, ngraph::OpSet> opsets;
     std::unordered_map<std::string, std::shared_ptr<ngraph::Variable>> variables;
+    std::mutex variablesMutex;
     const std::vector<IExtensionPtr> _exts;
+    const bool _parallel;
 };
 
 #endif  // IR_READER_V10
@@ -44,7 +44,7 @@ CNNNetwork IRReader::read(std::istream& model, const Blob::CPtr& weights, const
     pugi::xml_node root = xmlDoc.document_element();
 
     auto version = details::GetIRVersion(root);
-    IRParser parser(version, exts);
+    IRParser parser(version, exts, model.iword(ParallelReadStreamIndex()) != 0);
     return CNNNetwork(parser.parse(root, weights));
 }
 
@@ -14,6 +14,15 @@
 
 namespace InferenceEngine {
 
+/**
+ * @brief Returns the index of the flag in the extensible array of the model stream (model.iword) which allows the
+ * reader to parse the model layers concurrently. The index is allocated once by std::ios_base::xalloc, so it does not
+ * clash with the other users of the stream storage. The flag is not set by default, the readers which do not support
+ * it ignore it
+ * @return The index for the std::ios_base::iword calls
+ */
+INFERENCE_ENGINE_API_CPP(int) ParallelReadStreamIndex();
+
 /**
  * @brief IReader an abstract interface for Inference Engine readers
  */
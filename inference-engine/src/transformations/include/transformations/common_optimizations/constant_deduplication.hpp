@@ -0,0 +1,34 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include <transformations_visibility.hpp>
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ngraph {
+namespace pass {
+
+class TRANSFORMATIONS_API ConstantDeduplication;
+
+}  // namespace pass
+}  // namespace ngraph
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief ConstantDeduplication merges the Constants with the same element type, shape and data.
+ *
+ * The Constants are hashed by their data, the candidates with the same hash are compared bytewise.
+ * The consumers of a duplicate are reconnected to the first Constant, which receives the runtime info
+ * and the tensor names of the duplicate. The Constants connected to the Results are not merged, since
+ * their names define the names of the network outputs. The sub-graph bodies are processed separately.
+ */
+class ngraph::pass::ConstantDeduplication : public ngraph::pass::FunctionPass {
+public:
+    NGRAPH_RTTI_DECLARATION;
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
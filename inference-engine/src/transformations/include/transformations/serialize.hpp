@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include "ngraph/opsets/opset.hpp"
@@ -25,10 +26,23 @@ class TRANSFORMATIONS_API Serialize;
  * - order of generated layers in xml file is ngraph specific (given by
  * get_ordered_ops()); MO generates file with different order, but they are
  * logically equivalent
+ * - the xml file is written layer by layer, the Constants with identical data share one
+ * region of the bin file
  */
 class ngraph::pass::Serialize : public ngraph::pass::FunctionPass {
 public:
-    enum class Version { IR_V10 };
+    /**
+     * IR_V10 writes the XML IR, IR_V10_BINARY writes the same operations to the binary container
+     * (see serialize_binary_format.hpp, the model file has the 'irb' extension) which is read without parsing.
+     * The binary IR does not support the operations with a body (TensorIterator, Loop) and the execution graphs
+     */
+    enum class Version { IR_V10, IR_V10_BINARY };
+    /**
+     * The destination of the Constant data. The data is passed as the pointer into the Constant buffer,
+     * which stays valid while the serialized Function is alive, so the sink can keep or write it to the
+     * final destination without the intermediate copies. Identical Constants are passed only once.
+     */
+    using BinSink = std::function<void(const char* data, size_t size)>;
     NGRAPH_RTTI_DECLARATION;
     bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
 
@@ -36,6 +50,10 @@ public:
               Version version = Version::IR_V10,
               std::map<std::string, ngraph::OpSet> custom_opsets = {});
 
+    Serialize(std::ostream & xmlFile, BinSink binSink,
+              Version version = Version::IR_V10,
+              std::map<std::string, ngraph::OpSet> custom_opsets = {});
+
     Serialize(const std::string& xmlPath, const std::string& binPath,
               Version version = Version::IR_V10,
               std::map<std::string, ngraph::OpSet> custom_opsets = {});
@@ -43,6 +61,7 @@ public:
 private:
     std::ostream * m_xmlFile;
     std::ostream * m_binFile;
+    const BinSink m_binSink;
     const std::string m_xmlPath;
     const std::string m_binPath;
     const Version m_version;
@@ -0,0 +1,117 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief Layout of the binary IR container written by the Serialize pass with the IR_V10_BINARY version.
+ *
+ * The container is a flat buffer: a Header, the tables of the fixed size records it refers to and a data
+ * section with the strings, the attribute values and the output names. All the references are offsets,
+ * so the container can be used in place (e.g. memory mapped) without parsing. The Constant values are not
+ * stored in the container, they are references to the weights file, as in the XML IR.
+ */
+namespace ngraph {
+namespace binary_ir {
+
+constexpr uint32_t magic = 0x52494249;  // "IBIR"
+constexpr uint32_t version = 1;
+
+/// @brief A [first, first + count) range of the records in one of the tables
+struct Range {
+    uint32_t first;
+    uint32_t count;
+};
+
+/// @brief An array of count elements at offset bytes from the beginning of the data section
+struct ArrayRef {
+    uint64_t offset;
+    uint64_t count;
+};
+
+/// @brief A not null terminated string at offset bytes from the beginning of the data section
+struct StringRef {
+    uint64_t offset;
+    uint64_t size;
+};
+
+/// @brief A table of records at offset bytes from the beginning of the container
+struct TableRef {
+    uint64_t offset;
+    uint64_t count;
+};
+
+struct Header {
+    uint32_t magic;
+    uint32_t version;
+    StringRef name;
+    TableRef nodes;         // Node records in the topological order
+    TableRef inputs;        // Input records
+    TableRef outputs;       // Output records
+    TableRef attributes;    // Attribute records
+    TableRef parameters;    // uint32_t indices of the Parameter nodes in the Function order
+    TableRef results;       // uint32_t indices of the Result nodes in the Function order
+    TableRef sinks;         // uint32_t indices of the Sink nodes
+    uint64_t data_offset;
+    uint64_t data_size;
+};
+
+struct Node {
+    StringRef name;
+    StringRef type;
+    StringRef opset;
+    Range inputs;
+    Range outputs;
+    Range attributes;
+    Range rt_info;          // Attribute records with the string values
+};
+
+struct Input {
+    uint32_t node;          // index of the producer node
+    uint32_t output;        // index of the producer output
+};
+
+struct Output {
+    ArrayRef names;         // StringRef array of the tensor names
+};
+
+enum class AttributeType : uint32_t {
+    boolean,
+    i8, i16, i32, i64,
+    u8, u16, u32, u64,
+    f32, f64,
+    string,                 // value is a StringRef array
+    variable,               // value is a StringRef array of one variable id
+    weights,                // value is the offset and the size in bytes of the data in the weights file
+};
+
+struct Attribute {
+    StringRef name;
+    AttributeType type;
+    uint32_t is_vector;
+    ArrayRef value;
+};
+
+/// @brief The AttributeType of the numeric attribute values stored as is
+template <typename T> struct attribute_type;
+#define BINARY_IR_ATTRIBUTE_TYPE(T, type_name)                          \
+    template <> struct attribute_type<T> {                              \
+        static constexpr AttributeType value = AttributeType::type_name; \
+    };
+BINARY_IR_ATTRIBUTE_TYPE(int8_t, i8)
+BINARY_IR_ATTRIBUTE_TYPE(int16_t, i16)
+BINARY_IR_ATTRIBUTE_TYPE(int32_t, i32)
+BINARY_IR_ATTRIBUTE_TYPE(int64_t, i64)
+BINARY_IR_ATTRIBUTE_TYPE(uint8_t, u8)
+BINARY_IR_ATTRIBUTE_TYPE(uint16_t, u16)
+BINARY_IR_ATTRIBUTE_TYPE(uint32_t, u32)
+BINARY_IR_ATTRIBUTE_TYPE(uint64_t, u64)
+BINARY_IR_ATTRIBUTE_TYPE(float, f32)
+BINARY_IR_ATTRIBUTE_TYPE(double, f64)
+#undef BINARY_IR_ATTRIBUTE_TYPE
+
+}  // namespace binary_ir
+}  // namespace ngraph
@@ -0,0 +1,115 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "itt.hpp"
+#include "transformations/common_optimizations/constant_deduplication.hpp"
+
+#include <cstring>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <ngraph/op/util/op_types.hpp>
+#include <ngraph/op/util/sub_graph_base.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/rt_info.hpp>
+
+NGRAPH_RTTI_DEFINITION(ngraph::pass::ConstantDeduplication, "ConstantDeduplication", 0);
+
+namespace {
+
+size_t get_data_size(const ngraph::opset6::Constant& constant) {
+    // the low precisions (u1) are packed
+    return (ngraph::shape_size(constant.get_shape()) * constant.get_element_type().bitwidth() + 7) / 8;
+}
+
+// FNV-1a over the 64 bit words of the data, the element type and the shape are mixed in as well
+uint64_t hash_constant(const ngraph::opset6::Constant& constant) {
+    constexpr uint64_t prime = 0x100000001b3ULL;
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mix = [&] (uint64_t value) {
+        hash = (hash ^ value) * prime;
+    };
+    mix(static_cast<uint64_t>(static_cast<ngraph::element::Type_t>(constant.get_element_type())));
+    for (auto dim : constant.get_shape()) {
+        mix(dim);
+    }
+
+    const auto data = constant.get_data_ptr<char>();
+    const auto size = get_data_size(constant);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        mix(word);
+    }
+    for (; i < size; ++i) {
+        mix(static_cast<uint8_t>(data[i]));
+    }
+    return hash;
+}
+
+bool is_same_constant(const ngraph::opset6::Constant& lhs, const ngraph::opset6::Constant& rhs) {
+    return lhs.get_element_type() == rhs.get_element_type() &&
+           lhs.get_shape() == rhs.get_shape() &&
+           (lhs.get_data_ptr() == rhs.get_data_ptr() ||
+            std::memcmp(lhs.get_data_ptr(), rhs.get_data_ptr(), get_data_size(lhs)) == 0);
+}
+
+bool is_connected_to_result(const ngraph::Node& node) {
+    for (const auto& input : node.output(0).get_target_inputs()) {
+        if (ngraph::op::is_output(input.get_node())) {
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+bool ngraph::pass::ConstantDeduplication::run_on_function(std::shared_ptr<ngraph::Function> f) {
+    RUN_ON_FUNCTION_SCOPE(ConstantDeduplication);
+    bool rewritten = false;
+    std::unordered_map<uint64_t, std::vector<std::shared_ptr<opset6::Constant>>> constants;
+    for (const auto& node : f->get_ordered_ops()) {
+        // Recursively apply transformation for sub-graph based operations
+        if (auto sub_graph_node = std::dynamic_pointer_cast<op::util::SubGraphOp>(node)) {
+            if (auto sub_graph = sub_graph_node->get_function()) {
+                rewritten |= run_on_function(sub_graph);
+            }
+            continue;
+        }
+
+        auto constant = std::dynamic_pointer_cast<opset6::Constant>(node);
+        if (!constant || is_connected_to_result(*constant)) {
+            continue;
+        }
+
+        auto& candidates = constants[hash_constant(*constant)];
+        std::shared_ptr<opset6::Constant> original;
+        for (const auto& candidate : candidates) {
+            if (is_same_constant(*candidate, *constant)) {
+                original = candidate;
+                break;
+            }
+        }
+        if (!original) {
+            candidates.push_back(constant);
+            continue;
+        }
+
+        copy_runtime_info({original, constant}, original);
+        auto& tensor = original->get_output_tensor(0);
+        if (!constant->get_output_tensor(0).get_names().empty()) {
+            auto names = tensor.get_names();
+            const auto& duplicate_names = constant->get_output_tensor(0).get_names();
+            names.insert(duplicate_names.begin(), duplicate_names.end());
+            tensor.set_names(names);
+        }
+        constant->output(0).replace(original->output(0));
+        rewritten = true;
+    }
+    return rewritten;
+}
@@ -6,6 +6,7 @@
 #include <array>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -15,6 +16,7 @@
 #include "ngraph/opsets/opset.hpp"
 #include "pugixml.hpp"
 #include "transformations/serialize.hpp"
+#include "transformations/serialize_binary_format.hpp"
 
 using namespace ngraph;
 
@@ -32,6 +34,60 @@ std::string join(const Container& c, const char* glue = ", ") {
     return oss.str();
 }
 
+// Writes the Constant data to the bin sink. The identical data is written only once, the following
+// Constants refer to the same offset. The data is hashed to find the candidates and compared bytewise
+class ConstantWriter {
+public:
+    using FilePosition = int64_t;
+
+    explicit ConstantWriter(const pass::Serialize::BinSink& sink, FilePosition offset = 0)
+        : m_sink(sink), m_offset(offset) {
+    }
+
+    FilePosition write(const char* ptr, size_t size) {
+        const auto hash = hash_data(ptr, size);
+        auto& candidates = m_written[hash];
+        for (const auto& candidate : candidates) {
+            if (candidate.size == size && std::memcmp(candidate.ptr, ptr, size) == 0) {
+                return candidate.offset;
+            }
+        }
+        const auto offset = m_offset;
+        m_sink(ptr, size);
+        m_offset += static_cast<FilePosition>(size);
+        // the Constants are alive until the end of the serialization, so the data is not copied
+        candidates.push_back({ptr, size, offset});
+        return offset;
+    }
+
+private:
+    struct Written {
+        const char* ptr;
+        size_t size;
+        FilePosition offset;
+    };
+
+    // FNV-1a over the 64 bit words
+    static uint64_t hash_data(const char* ptr, size_t size) {
+        constexpr uint64_t prime = 0x100000001b3ULL;
+        uint64_t hash = 0xcbf29ce484222325ULL ^ size;
+        size_t i = 0;
+        for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, ptr + i, sizeof(word));
+            hash = (hash ^ word) * prime;
+        }
+        for (; i < size; ++i) {
+            hash = (hash ^ static_cast<uint8_t>(ptr[i])) * prime;
+        }
+        return hash;
+    }
+
+    pass::Serialize::BinSink m_sink;
+    FilePosition m_offset;
+    std::unordered_map<uint64_t, std::vector<Written>> m_written;
+};
+
 struct Edge {
     int from_layer = 0;
     int from_port = 0;
@@ -58,7 +114,7 @@ std::string translate_type_name(const std::string& name) {
 }
 
 void ngfunction_2_irv10(pugi::xml_node& node,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_writer,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets);
 
@@ -115,7 +171,7 @@ private:
 
 class XmlSerializer : public ngraph::AttributeVisitor {
     pugi::xml_node& m_xml_node;
-    std::ostream& m_bin_data;
+    ConstantWriter& m_constant_writer;
     std::string& m_node_type_name;
     const std::map<std::string, ngraph::OpSet>& m_custom_opsets;
 
@@ -127,11 +183,11 @@ class XmlSerializer : public ngraph::AttributeVisitor {
 
 public:
     XmlSerializer(pugi::xml_node& data,
-                  std::ostream& bin_data,
+                  ConstantWriter& constant_writer,
                   std::string& node_type_name,
                   const std::map<std::string, ngraph::OpSet>& custom_opsets)
         : m_xml_node(data)
-        , m_bin_data(bin_data)
+        , m_constant_writer(constant_writer)
         , m_node_type_name(node_type_name)
         , m_custom_opsets(custom_opsets) {
     }
@@ -250,13 +306,10 @@ public:
         } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
             if (name == "value" &&  translate_type_name(m_node_type_name) == "Const") {
                 const int64_t size = a->get()->size();
-                const int64_t offset = m_bin_data.tellp();
+                const int64_t offset = m_constant_writer.write(static_cast<const char*>(a->get()->get_ptr()), size);
 
                 m_xml_node.append_attribute("offset").set_value(offset);
                 m_xml_node.append_attribute("size").set_value(size);
-
-                auto data = static_cast<const char*>(a->get()->get_ptr());
-                m_bin_data.write(data, size);
             }
         }
     }
@@ -316,11 +369,9 @@ public:
             // to layer above (m_xml_node.parent()) as in ngfunction_2_irv10() layer (m_xml_node) with empty attributes
             // is removed.
             pugi::xml_node xml_body = m_xml_node.parent().append_child(name.c_str());
-            ngfunction_2_irv10(xml_body, m_bin_data, *adapter.get(), m_custom_opsets);
+            ngfunction_2_irv10(xml_body, m_constant_writer, *adapter.get(), m_custom_opsets);
             xml_body.remove_attribute("name");
             xml_body.remove_attribute("version");
-        } else if (name == "net") {
-            ngfunction_2_irv10(m_xml_node, m_bin_data, *adapter.get(), m_custom_opsets);
         } else {
             NGRAPH_CHECK(false, "Unsupported Function name.");
         }
@@ -577,8 +628,129 @@ bool resolve_dynamic_shapes(const ngraph::Function& f) {
     return true;
 }
 
+void append_layer(pugi::xml_node& layers,
+                  ngraph::Node* node,
+                  const std::unordered_map<ngraph::Node*, int>& layer_ids,
+                  std::unordered_set<std::string>& unique_names,
+                  const bool exec_graph,
+                  ConstantWriter& constant_writer,
+                  const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    NGRAPH_CHECK(layer_ids.find(node) != layer_ids.end(), "Internal error");
+    // <layers>
+    pugi::xml_node layer = layers.append_child("layer");
+    layer.append_attribute("id").set_value(layer_ids.find(node)->second);
+    layer.append_attribute("name").set_value(
+        get_node_unique_name(unique_names, node).c_str());
+    auto layer_type_attribute = layer.append_attribute("type");
+    if (!exec_graph) {
+        layer.append_attribute("version").set_value(
+            get_opset_name(node, custom_opsets).c_str());
+    }
+
+    // <layers/data>
+    pugi::xml_node data = layer.append_child("data");
+    std::string node_type_name{node->get_type_name()};
+
+    // <layers/data> general attributes
+    if (exec_graph) {
+        visit_exec_graph_node(data, node_type_name, node);
+    } else {
+        XmlSerializer visitor(data, constant_writer, node_type_name, custom_opsets);
+        NGRAPH_CHECK(node->visit_attributes(visitor),
+                     "Visitor API is not supported in ", node);
+        rt_info::XmlSerializer{data}.serialize(node->get_rt_info());
+    }
+    layer_type_attribute.set_value(
+        translate_type_name(node_type_name).c_str());
+
+    const bool data_attr_size =
+        data.attributes().begin() == data.attributes().end();
+    if (data_attr_size) {
+        layer.remove_child(data);
+    }
+
+    int port_id = 0;
+    // <layers/input>
+    if (node->get_input_size() > 0) {
+        pugi::xml_node input = layer.append_child("input");
+        for (auto i : node->inputs()) {
+            NGRAPH_CHECK(i.get_partial_shape().is_static(),
+                         "Unsupported dynamic input shape in ", node);
+
+            // WA for LSTMCellv0, peephole input shall not be serialized
+            if (i.get_index() == 6) {
+                auto type_info = node->get_type_info();
+                if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
+                    port_id++;
+                    continue;
+                }
+            }
+
+            pugi::xml_node port = input.append_child("port");
+            port.append_attribute("id").set_value(port_id++);
+            for (auto d : i.get_shape()) {
+                pugi::xml_node dim = port.append_child("dim");
+                dim.append_child(pugi::xml_node_type::node_pcdata)
+                    .set_value(std::to_string(d).c_str());
+            }
+        }
+
+        if (node_type_name == "TensorIterator" || node_type_name == "Loop") {
+            layer.prepend_move(input);
+        }
+    }
+    // <layers/output>
+    if ((node->get_output_size() > 0) && !ngraph::op::is_output(node)) {
+        pugi::xml_node output = layer.append_child("output");
+        for (auto o : node->outputs()) {
+            NGRAPH_CHECK(o.get_partial_shape().is_static(),
+                         "Unsupported dynamic output shape in ", node);
+
+            pugi::xml_node port = output.append_child("port");
+            port.append_attribute("id").set_value(port_id++);
+            port.append_attribute("precision")
+                .set_value(get_output_precision_name(o).c_str());
+            std::string names;
+            for (const auto& name : o.get_tensor().get_names()) {
+                if (!names.empty())
+                    names += ", ";
+                names += escape_delim(name);
+            }
+            if (!names.empty()) {
+                port.append_attribute("names").set_value(names.c_str());
+            }
+            for (auto d : o.get_shape()) {
+                pugi::xml_node dim = port.append_child("dim");
+                dim.append_child(pugi::xml_node_type::node_pcdata)
+                    .set_value(std::to_string(d).c_str());
+            }
+        }
+        if (node_type_name == "TensorIterator" || node_type_name == "Loop") {
+            layer.insert_move_after(output, layer.first_child());
+        }
+    }
+}
+
+std::vector<Edge> create_serialized_edges(
+    const std::unordered_map<ngraph::Node*, int>& layer_ids,
+    const ngraph::Function& f) {
+    const auto ordered_ops = f.get_ordered_ops();
+    std::vector<Edge> edges;
+    for (const auto& e : create_edge_mapping(layer_ids, f)) {
+        // WA for LSTMCellv0, peephole input shall not be serialized
+        if (e.to_port == 6) {
+            auto type_info = ordered_ops[e.to_layer]->get_type_info();
+            if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
+                continue;
+            }
+        }
+        edges.push_back(e);
+    }
+    return edges;
+}
+
 void ngfunction_2_irv10(pugi::xml_node& netXml,
-                        std::ostream& bin_file,
+                        ConstantWriter& constant_writer,
                         const ngraph::Function& f,
                         const std::map<std::string, ngraph::OpSet>& custom_opsets) {
     const bool exec_graph = is_exec_graph(f);
@@ -594,124 +766,328 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
     bool has_dynamic_shapes = resolve_dynamic_shapes(f);
 
     for (const auto& n : f.get_ordered_ops()) {
-        ngraph::Node* node = n.get();
-
-        NGRAPH_CHECK(layer_ids.find(node) != layer_ids.end(), "Internal error");
-        // <layers>
-        pugi::xml_node layer = layers.append_child("layer");
-        layer.append_attribute("id").set_value(layer_ids.find(node)->second);
-        layer.append_attribute("name").set_value(
-            get_node_unique_name(unique_names, node).c_str());
-        auto layer_type_attribute = layer.append_attribute("type");
-        if (!exec_graph) {
-            layer.append_attribute("version").set_value(
-                get_opset_name(node, custom_opsets).c_str());
+        append_layer(layers, n.get(), layer_ids, unique_names, exec_graph, constant_writer, custom_opsets);
+    }
+    // <edges>
+    pugi::xml_node edges = netXml.append_child("edges");
+    for (auto e : create_serialized_edges(layer_ids, f)) {
+        pugi::xml_node edge = edges.append_child("edge");
+        edge.append_attribute("from-layer").set_value(e.from_layer);
+        edge.append_attribute("from-port").set_value(e.from_port);
+        edge.append_attribute("to-layer").set_value(e.to_layer);
+        edge.append_attribute("to-port").set_value(e.to_port);
+    }
+    // move back dynamic shapes
+    if (has_dynamic_shapes) {
+        f.validate_nodes_and_infer_types();
+    }
+}
+
+std::string escape_xml_attribute(const std::string& value) {
+    std::string escaped;
+    escaped.reserve(value.size());
+    for (const char c : value) {
+        switch (c) {
+        case '&': escaped += "&amp;"; break;
+        case '<': escaped += "&lt;"; break;
+        case '>': escaped += "&gt;"; break;
+        case '"': escaped += "&quot;"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 32) {
+                escaped += "&#" + std::to_string(static_cast<int>(c)) + ";";
+            } else {
+                escaped += c;
+            }
         }
+    }
+    return escaped;
+}
 
-        // <layers/data>
-        pugi::xml_node data = layer.append_child("data");
-        std::string node_type_name{node->get_type_name()};
+// Writes the same document as ngfunction_2_irv10 above, but layer by layer, so only the xml of
+// one layer is kept in memory instead of the xml of the whole network
+void ngfunction_2_irv10(std::ostream& xml_file,
+                        ConstantWriter& constant_writer,
+                        const ngraph::Function& f,
+                        const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    const bool exec_graph = is_exec_graph(f);
 
-        // <layers/data> general attributes
-        if (exec_graph) {
-            visit_exec_graph_node(data, node_type_name, node);
-        } else {
-            XmlSerializer visitor(data, bin_file, node_type_name, custom_opsets);
-            NGRAPH_CHECK(node->visit_attributes(visitor),
-                         "Visitor API is not supported in ", node);
-            rt_info::XmlSerializer{data}.serialize(node->get_rt_info());
-        }
-        layer_type_attribute.set_value(
-            translate_type_name(node_type_name).c_str());
+    const std::unordered_map<ngraph::Node*, int> layer_ids =
+        create_layer_ids(f);
+    std::unordered_set<std::string> unique_names;
+
+    bool has_dynamic_shapes = resolve_dynamic_shapes(f);
+
+    xml_file << "<?xml version=\"1.0\"?>\n"
+             << "<net name=\"" << escape_xml_attribute(f.get_friendly_name()) << "\" version=\"10\">\n"
+             << "\t<layers>\n";
+    for (const auto& n : f.get_ordered_ops()) {
+        pugi::xml_document layer_doc;
+        pugi::xml_node layers = layer_doc.append_child("layers");
+        append_layer(layers, n.get(), layer_ids, unique_names, exec_graph, constant_writer, custom_opsets);
+        layers.first_child().print(xml_file, "\t", pugi::format_default, pugi::encoding_auto, 2);
+    }
+    xml_file << "\t</layers>\n"
+             << "\t<edges>\n";
+    for (auto e : create_serialized_edges(layer_ids, f)) {
+        xml_file << "\t\t<edge from-layer=\"" << e.from_layer << "\" from-port=\"" << e.from_port
+                 << "\" to-layer=\"" << e.to_layer << "\" to-port=\"" << e.to_port << "\" />\n";
+    }
+    xml_file << "\t</edges>\n"
+             << "</net>\n";
+    NGRAPH_CHECK(xml_file, "Failed to write the xml file");
+
+    // move back dynamic shapes
+    if (has_dynamic_shapes) {
+        f.validate_nodes_and_infer_types();
+    }
+}
+
+// Collects the binary IR records, the data section is built in place
+class BinaryIRBuilder {
+public:
+    std::vector<binary_ir::Node> nodes;
+    std::vector<binary_ir::Input> inputs;
+    std::vector<binary_ir::Output> outputs;
+    std::vector<binary_ir::Attribute> attributes;
+    std::string data;
+
+    binary_ir::StringRef add_string(const std::string& str) {
+        binary_ir::StringRef ref{data.size(), str.size()};
+        data += str;
+        return ref;
+    }
+
+    template <typename T>
+    binary_ir::ArrayRef add_array(const T* values, size_t count) {
+        // keep the values aligned, so they can be used in place
+        data.resize((data.size() + alignof(uint64_t) - 1) / alignof(uint64_t) * alignof(uint64_t));
+        binary_ir::ArrayRef ref{data.size(), count};
+        data.append(reinterpret_cast<const char*>(values), count * sizeof(T));
+        return ref;
+    }
 
-        const bool data_attr_size =
-            data.attributes().begin() == data.attributes().end();
-        if (data_attr_size) {
-            layer.remove_child(data);
+    binary_ir::ArrayRef add_strings(const std::vector<std::string>& strs) {
+        std::vector<binary_ir::StringRef> refs;
+        for (const auto& str : strs) {
+            refs.push_back(add_string(str));
         }
+        return add_array(refs.data(), refs.size());
+    }
 
-        int port_id = 0;
-        // <layers/input>
-        if (node->get_input_size() > 0) {
-            pugi::xml_node input = layer.append_child("input");
-            for (auto i : node->inputs()) {
-                NGRAPH_CHECK(i.get_partial_shape().is_static(),
-                             "Unsupported dynamic input shape in ", node);
-
-                // WA for LSTMCellv0, peephole input shall not be serialized
-                if (i.get_index() == 6) {
-                    auto type_info = node->get_type_info();
-                    if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
-                        port_id++;
-                        continue;
-                    }
-                }
+    void add_attribute(const std::string& name, binary_ir::AttributeType type, bool is_vector,
+                       binary_ir::ArrayRef value) {
+        attributes.push_back({add_string(name), type, static_cast<uint32_t>(is_vector), value});
+    }
+};
 
-                pugi::xml_node port = input.append_child("port");
-                port.append_attribute("id").set_value(port_id++);
-                for (auto d : i.get_shape()) {
-                    pugi::xml_node dim = port.append_child("dim");
-                    dim.append_child(pugi::xml_node_type::node_pcdata)
-                        .set_value(std::to_string(d).c_str());
-                }
-            }
+class BinarySerializer : public ngraph::AttributeVisitor {
+    BinaryIRBuilder& m_builder;
+    ConstantWriter& m_constant_writer;
+    const ngraph::Node& m_node;
 
-            if (node_type_name == "TensorIterator" || node_type_name == "Loop") {
-                layer.prepend_move(input);
+    template <typename T>
+    void add_scalar(const std::string& name, const T& value) {
+        m_builder.add_attribute(name, binary_ir::attribute_type<T>::value, false, m_builder.add_array(&value, 1));
+    }
+
+    template <typename T>
+    void add_vector(const std::string& name, const std::vector<T>& value) {
+        m_builder.add_attribute(name, binary_ir::attribute_type<T>::value, true,
+                                m_builder.add_array(value.data(), value.size()));
+    }
+
+public:
+    BinarySerializer(BinaryIRBuilder& builder, ConstantWriter& constant_writer, const ngraph::Node& node)
+        : m_builder(builder), m_constant_writer(constant_writer), m_node(node) {
+    }
+
+    void on_adapter(const std::string& name,
+                    ngraph::ValueAccessor<void>& adapter) override {
+        if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::Variable>>>(&adapter)) {
+            m_builder.add_attribute(name, binary_ir::AttributeType::variable, false,
+                                    m_builder.add_strings({a->get()->get_info().variable_id}));
+        } else if (const auto& a = ngraph::as_type<ngraph::AttributeAdapter<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(&adapter)) {
+            if (name == "value" && ngraph::op::is_constant(&m_node)) {
+                const uint64_t size = a->get()->size();
+                const uint64_t offset = m_constant_writer.write(static_cast<const char*>(a->get()->get_ptr()), size);
+                m_builder.add_attribute(name, binary_ir::AttributeType::weights, false, {offset, size});
             }
         }
-        // <layers/output>
-        if ((node->get_output_size() > 0) && !ngraph::op::is_output(node)) {
-            pugi::xml_node output = layer.append_child("output");
-            for (auto o : node->outputs()) {
-                NGRAPH_CHECK(o.get_partial_shape().is_static(),
-                             "Unsupported dynamic output shape in ", node);
-
-                pugi::xml_node port = output.append_child("port");
-                port.append_attribute("id").set_value(port_id++);
-                port.append_attribute("precision")
-                    .set_value(get_output_precision_name(o).c_str());
-                std::string names;
-                for (const auto& name : o.get_tensor().get_names()) {
-                    if (!names.empty())
-                        names += ", ";
-                    names += escape_delim(name);
-                }
-                if (!names.empty()) {
-                    port.append_attribute("names").set_value(names.c_str());
-                }
-                for (auto d : o.get_shape()) {
-                    pugi::xml_node dim = port.append_child("dim");
-                    dim.append_child(pugi::xml_node_type::node_pcdata)
-                        .set_value(std::to_string(d).c_str());
+    }
+
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<bool>& adapter) override {
+        const uint8_t value = adapter.get();
+        m_builder.add_attribute(name, binary_ir::AttributeType::boolean, false, m_builder.add_array(&value, 1));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::string>& adapter) override {
+        m_builder.add_attribute(name, binary_ir::AttributeType::string, false, m_builder.add_strings({adapter.get()}));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int8_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int16_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int32_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<int64_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint8_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint16_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint32_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<uint64_t>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<float>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<double>& adapter) override {
+        add_scalar(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int8_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int16_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int32_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<int64_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<float>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<double>>& adapter) override {
+        add_vector(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::vector<std::string>>& adapter) override {
+        m_builder.add_attribute(name, binary_ir::AttributeType::string, true, m_builder.add_strings(adapter.get()));
+    }
+    void on_adapter(const std::string& name, ngraph::ValueAccessor<std::shared_ptr<Function>>& adapter) override {
+        NGRAPH_CHECK(false, "Operations with a body are not supported by the binary IR: ", m_node);
+    }
+};
+
+template <typename T>
+binary_ir::TableRef write_table(std::ostream& model_file, const std::vector<T>& table) {
+    binary_ir::TableRef ref{static_cast<uint64_t>(model_file.tellp()), table.size()};
+    model_file.write(reinterpret_cast<const char*>(table.data()), table.size() * sizeof(T));
+    return ref;
+}
+
+void ngfunction_2_binary_ir(std::ostream& model_file,
+                            ConstantWriter& constant_writer,
+                            const ngraph::Function& f,
+                            const std::map<std::string, ngraph::OpSet>& custom_opsets) {
+    NGRAPH_CHECK(!is_exec_graph(f), "Execution graph is not supported by the binary IR");
+
+    BinaryIRBuilder builder;
+    std::unordered_map<const ngraph::Node*, uint32_t> node_ids;
+    for (const auto& n : f.get_ordered_ops()) {
+        binary_ir::Node node{};
+        node.name = builder.add_string(n->get_friendly_name());
+        node.type = builder.add_string(n->get_type_name());
+        node.opset = builder.add_string(get_opset_name(n.get(), custom_opsets));
+
+        node.inputs.first = static_cast<uint32_t>(builder.inputs.size());
+        for (const auto& input : n->inputs()) {
+            auto source = input.get_source_output();
+            builder.inputs.push_back({node_ids.at(source.get_node()), static_cast<uint32_t>(source.get_index())});
+        }
+        node.inputs.count = static_cast<uint32_t>(builder.inputs.size()) - node.inputs.first;
+
+        node.outputs.first = static_cast<uint32_t>(builder.outputs.size());
+        for (const auto& output : n->outputs()) {
+            const auto& names = output.get_tensor().get_names();
+            builder.outputs.push_back({builder.add_strings({names.begin(), names.end()})});
+        }
+        node.outputs.count = static_cast<uint32_t>(builder.outputs.size()) - node.outputs.first;
+
+        node.attributes.first = static_cast<uint32_t>(builder.attributes.size());
+        BinarySerializer visitor(builder, constant_writer, *n);
+        NGRAPH_CHECK(n->visit_attributes(visitor), "Visitor API is not supported in ", n);
+        node.attributes.count = static_cast<uint32_t>(builder.attributes.size()) - node.attributes.first;
+
+        node.rt_info.first = static_cast<uint32_t>(builder.attributes.size());
+        const auto& rt_info = n->get_rt_info();
+        for (const auto& rt_info_name : rt_info::list_of_names) {
+            const auto found = rt_info.find(rt_info_name);
+            if (found != rt_info.end()) {
+                if (auto v = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(found->second)) {
+                    builder.add_attribute(rt_info_name, binary_ir::AttributeType::string, false,
+                                          builder.add_strings({v->get()}));
                 }
             }
-            if (node_type_name == "TensorIterator" || node_type_name == "Loop") {
-                layer.insert_move_after(output, layer.first_child());
-            }
         }
+        node.rt_info.count = static_cast<uint32_t>(builder.attributes.size()) - node.rt_info.first;
+
+        node_ids.emplace(n.get(), static_cast<uint32_t>(builder.nodes.size()));
+        builder.nodes.push_back(node);
     }
-    // <edges>
-    const std::vector<Edge> edge_mapping = create_edge_mapping(layer_ids, f);
-    pugi::xml_node edges = netXml.append_child("edges");
-    for (auto e : edge_mapping) {
-        // WA for LSTMCellv0, peephole input shall not be serialized
-        if (e.to_port == 6) {
-            auto type_info = f.get_ordered_ops()[e.to_layer]->get_type_info();
-            if (!strcmp(type_info.name, "LSTMCell") && type_info.version == 0) {
-                continue;
-            }
+
+    auto get_ids = [&] (const std::vector<std::shared_ptr<ngraph::Node>>& nodes) {
+        std::vector<uint32_t> ids;
+        for (const auto& node : nodes) {
+            ids.push_back(node_ids.at(node.get()));
         }
-        pugi::xml_node edge = edges.append_child("edge");
-        edge.append_attribute("from-layer").set_value(e.from_layer);
-        edge.append_attribute("from-port").set_value(e.from_port);
-        edge.append_attribute("to-layer").set_value(e.to_layer);
-        edge.append_attribute("to-port").set_value(e.to_port);
-    }
-    // move back dynamic shapes
-    if (has_dynamic_shapes) {
-        f.validate_nodes_and_infer_types();
+        return ids;
+    };
+    const auto parameters = get_ids({f.get_parameters().begin(), f.get_parameters().end()});
+    const auto results = get_ids({f.get_results().begin(), f.get_results().end()});
+    const auto sinks = get_ids({f.get_sinks().begin(), f.get_sinks().end()});
+
+    binary_ir::Header header{};
+    header.magic = binary_ir::magic;
+    header.version = binary_ir::version;
+    header.name = builder.add_string(f.get_friendly_name());
+
+    const auto start = model_file.tellp();
+    model_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    header.nodes = write_table(model_file, builder.nodes);
+    header.inputs = write_table(model_file, builder.inputs);
+    header.outputs = write_table(model_file, builder.outputs);
+    header.attributes = write_table(model_file, builder.attributes);
+    header.parameters = write_table(model_file, parameters);
+    header.results = write_table(model_file, results);
+    header.sinks = write_table(model_file, sinks);
+    for (auto table : {&header.nodes, &header.inputs, &header.outputs, &header.attributes,
+                       &header.parameters, &header.results, &header.sinks}) {
+        table->offset -= start;
     }
+
+    const auto written = static_cast<size_t>(model_file.tellp() - start);
+    const std::vector<char> padding((alignof(uint64_t) - written % alignof(uint64_t)) % alignof(uint64_t), 0);
+    model_file.write(padding.data(), padding.size());
+    header.data_offset = model_file.tellp() - start;
+    header.data_size = builder.data.size();
+    model_file.write(builder.data.data(), builder.data.size());
+
+    const auto end = model_file.tellp();
+    model_file.seekp(start);
+    model_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    model_file.seekp(end);
 }
 }  // namespace
 
@@ -720,38 +1096,47 @@ void ngfunction_2_irv10(pugi::xml_node& netXml,
 bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
     RUN_ON_FUNCTION_SCOPE(Serialize);
 
-    auto serializeFunc = [&] (std::ostream & xml_file, std::ostream & bin_file) {
+    auto serializeFunc = [&] (std::ostream & xml_file, ConstantWriter& constant_writer) {
         switch (m_version) {
         case Version::IR_V10:
-            {
-                std::string name = "net";
-                pugi::xml_document xml_doc;
-                pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-                XmlSerializer visitor(net_node, bin_file, name, m_custom_opsets);
-                visitor.on_attribute(name, f);
-
-                xml_doc.save(xml_file);
-                xml_file.flush();
-                bin_file.flush();
-            }
+            ngfunction_2_irv10(xml_file, constant_writer, *f, m_custom_opsets);
+            break;
+        case Version::IR_V10_BINARY:
+            ngfunction_2_binary_ir(xml_file, constant_writer, *f, m_custom_opsets);
             break;
         default:
             NGRAPH_UNREACHABLE("Unsupported version");
             break;
         }
+        xml_file.flush();
+    };
+
+    // the offsets in the bin file are counted from the current position of the stream
+    auto stream_writer = [] (std::ostream& bin_file) {
+        const auto position = static_cast<ConstantWriter::FilePosition>(bin_file.tellp());
+        return ConstantWriter([&bin_file] (const char* data, size_t size) {
+            bin_file.write(data, size);
+        }, position < 0 ? 0 : position);
     };
 
-    if (m_xmlFile && m_binFile) {
-        serializeFunc(*m_xmlFile, *m_binFile);
+    if (m_xmlFile && m_binSink) {
+        ConstantWriter constant_writer(m_binSink);
+        serializeFunc(*m_xmlFile, constant_writer);
+    } else if (m_xmlFile && m_binFile) {
+        auto constant_writer = stream_writer(*m_binFile);
+        serializeFunc(*m_xmlFile, constant_writer);
+        m_binFile->flush();
     } else {
         std::ofstream bin_file(m_binPath, std::ios::out | std::ios::binary);
         NGRAPH_CHECK(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        std::ofstream xml_file(m_xmlPath, m_version == Version::IR_V10_BINARY ? std::ios::out | std::ios::binary : std::ios::out);
         NGRAPH_CHECK(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
-        serializeFunc(xml_file, bin_file);
+        auto constant_writer = stream_writer(bin_file);
+        serializeFunc(xml_file, constant_writer);
+        bin_file.flush();
     }
 
     // Return false because we didn't change nGraph Function
@@ -760,14 +1145,14 @@ bool pass::Serialize::run_on_function(std::shared_ptr<ngraph::Function> f) {
 
 namespace {
 
-std::string valid_xml_path(const std::string &path) {
+std::string valid_xml_path(const std::string &path, pass::Serialize::Version version) {
     NGRAPH_CHECK(path.length() > 4, "Path for xml file is to short: \"" + path + "\"");
 
-    const char *const extension = ".xml";
+    const char *const extension = version == pass::Serialize::Version::IR_V10_BINARY ? ".irb" : ".xml";
     const bool has_xml_extension = path.rfind(extension) == path.size() - std::strlen(extension);
     NGRAPH_CHECK(has_xml_extension,
-                 "Path for xml file doesn't contains file name with 'xml' extension: \"" +
-                     path + "\"");
+                 "Path for model file doesn't contains file name with '" + std::string(extension + 1) +
+                     "' extension: \"" + path + "\"");
     return path;
 }
 
@@ -798,13 +1183,28 @@ pass::Serialize::Serialize(std::ostream& xmlFile,
 {
 }
 
+pass::Serialize::Serialize(std::ostream& xmlFile,
+                           BinSink binSink,
+                           pass::Serialize::Version version,
+                           std::map<std::string, OpSet> custom_opsets)
+    : m_xmlFile{&xmlFile}
+    , m_binFile{nullptr}
+    , m_binSink{std::move(binSink)}
+    , m_xmlPath{}
+    , m_binPath{}
+    , m_version{version}
+    , m_custom_opsets{custom_opsets}
+{
+    NGRAPH_CHECK(m_binSink, "The bin sink is empty");
+}
+
 pass::Serialize::Serialize(const std::string& xmlPath,
                            const std::string& binPath,
                            pass::Serialize::Version version,
                            std::map<std::string, OpSet> custom_opsets)
     : m_xmlFile{nullptr}
     , m_binFile{nullptr}
-    , m_xmlPath{valid_xml_path(xmlPath)}
+    , m_xmlPath{valid_xml_path(xmlPath, version)}
     , m_binPath{provide_bin_path(xmlPath, binPath)}
     , m_version{version}
     , m_custom_opsets{custom_opsets}
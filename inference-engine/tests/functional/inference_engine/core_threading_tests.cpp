@@ -80,6 +80,20 @@ TEST_F(CoreThreadingTests, RegisterPlugin) {
     }, 4000);
 }
 
+// tested function: GetVersions, plugins of the different devices are loaded concurrently
+TEST_F(CoreThreadingTests, LoadPluginsConcurrently) {
+    InferenceEngine::Core ie;
+    const unsigned int devicesNum = 8;
+    for (unsigned int i = 0; i < devicesNum; ++i) {
+        ie.RegisterPlugin(std::string("mock_engine") + IE_BUILD_POSTFIX, "MOCK" + std::to_string(i));
+    }
+    std::atomic<unsigned int> index{0};
+    runParallel([&] () {
+        const std::string deviceName = "MOCK" + std::to_string(index++ % devicesNum);
+        ASSERT_EQ(1, ie.GetVersions(deviceName).size());
+    }, 100, 16);
+}
+
 // tested function: RegisterPlugins
 TEST_F(CoreThreadingTests, RegisterPlugins) {
     InferenceEngine::Core ie;
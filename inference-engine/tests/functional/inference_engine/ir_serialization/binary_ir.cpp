@@ -0,0 +1,147 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstring>
+#include <fstream>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+#include "gtest/gtest.h"
+#include "ie_core.hpp"
+#include "transformations/serialize.hpp"
+#include "transformations/serialize_binary_format.hpp"
+
+#ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
+#define IR_SERIALIZATION_MODELS_PATH ""
+#endif
+
+typedef std::tuple<std::string, std::string> BinaryIRParams;
+
+class BinaryIRSerializationTest: public CommonTestUtils::TestsCommon,
+                                 public testing::WithParamInterface<BinaryIRParams> {
+public:
+    std::string m_model_path;
+    std::string m_binary_path;
+    std::string m_out_irb_path;
+    std::string m_out_bin_path;
+
+    void SetUp() override {
+        m_model_path = IR_SERIALIZATION_MODELS_PATH + std::get<0>(GetParam());
+        if (!std::get<1>(GetParam()).empty()) {
+            m_binary_path = IR_SERIALIZATION_MODELS_PATH + std::get<1>(GetParam());
+        }
+
+        const std::string test_name =  GetTestName() + "_" + GetTimestamp();
+        m_out_irb_path = test_name + ".irb";
+        m_out_bin_path = test_name + ".bin";
+    }
+
+    void TearDown() override {
+        std::remove(m_out_irb_path.c_str());
+        std::remove(m_out_bin_path.c_str());
+    }
+};
+
+TEST_P(BinaryIRSerializationTest, CompareFunctions) {
+    InferenceEngine::Core ie;
+    auto expected = ie.ReadNetwork(m_model_path, m_binary_path);
+
+    ngraph::pass::Serialize(m_out_irb_path, m_out_bin_path,
+                            ngraph::pass::Serialize::Version::IR_V10_BINARY)
+        .run_on_function(expected.getFunction());
+    auto result = ie.ReadNetwork(m_out_irb_path, m_out_bin_path);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(result.getFunction(), expected.getFunction(), true, false, true, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+INSTANTIATE_TEST_CASE_P(BinaryIRSerialization, BinaryIRSerializationTest,
+        testing::Values(std::make_tuple("add_abc.xml", "add_abc.bin"),
+                        std::make_tuple("add_abc_f64.xml", ""),
+                        std::make_tuple("split_equal_parts_2d.xml", "split_equal_parts_2d.bin"),
+                        std::make_tuple("addmul_abc.xml", "addmul_abc.bin"),
+                        std::make_tuple("add_abc_initializers.xml", "add_abc_initializers.bin"),
+                        std::make_tuple("add_abc_initializers_u1_const.xml", "add_abc_initializers_u1_const.bin"),
+                        std::make_tuple("experimental_detectron_roi_feature_extractor.xml", ""),
+                        std::make_tuple("experimental_detectron_detection_output_opset6.xml", ""),
+                        std::make_tuple("nms5.xml", "nms5.bin"),
+                        std::make_tuple("pad_with_shape_of.xml", ""),
+                        std::make_tuple("conv_with_rt_info.xml", "")));
+
+TEST(BinaryIRSerialization, LoopIsNotSupported) {
+    InferenceEngine::Core ie;
+    auto network = ie.ReadNetwork(IR_SERIALIZATION_MODELS_PATH "loop_2d_add.xml",
+                                  IR_SERIALIZATION_MODELS_PATH "loop_2d_add.bin");
+    const std::string irb_path = "binary_ir_loop_2d_add.irb";
+    const std::string bin_path = "binary_ir_loop_2d_add.bin";
+    ASSERT_ANY_THROW(ngraph::pass::Serialize(irb_path, bin_path, ngraph::pass::Serialize::Version::IR_V10_BINARY)
+                         .run_on_function(network.getFunction()));
+    std::remove(irb_path.c_str());
+    std::remove(bin_path.c_str());
+}
+
+TEST(BinaryIRSerialization, ReadTruncatedModelThrows) {
+    InferenceEngine::Core ie;
+    auto network = ie.ReadNetwork(IR_SERIALIZATION_MODELS_PATH "add_abc.xml",
+                                  IR_SERIALIZATION_MODELS_PATH "add_abc.bin");
+    std::stringstream irb, bin;
+    ngraph::pass::Serialize(irb, bin, ngraph::pass::Serialize::Version::IR_V10_BINARY)
+        .run_on_function(network.getFunction());
+
+    const std::string irb_path = "binary_ir_truncated.irb";
+    {
+        const auto content = irb.str();
+        std::ofstream out(irb_path, std::ios::binary);
+        out.write(content.data(), content.size() / 2);
+    }
+    ASSERT_ANY_THROW(ie.ReadNetwork(irb_path, IR_SERIALIZATION_MODELS_PATH "add_abc.bin"));
+    std::remove(irb_path.c_str());
+}
+
+TEST(BinaryIRSerialization, ReadWeightsSmallerThanShapeThrows) {
+    InferenceEngine::Core ie;
+    auto network = ie.ReadNetwork(IR_SERIALIZATION_MODELS_PATH "add_abc_initializers.xml",
+                                  IR_SERIALIZATION_MODELS_PATH "add_abc_initializers.bin");
+    std::stringstream irb, bin;
+    ngraph::pass::Serialize(irb, bin, ngraph::pass::Serialize::Version::IR_V10_BINARY)
+        .run_on_function(network.getFunction());
+
+    // the weights of every Constant are one byte shorter than its shape requires, but still within the bin file
+    auto content = irb.str();
+    ngraph::binary_ir::Header header;
+    ASSERT_GE(content.size(), sizeof(header));
+    std::memcpy(&header, content.data(), sizeof(header));
+    size_t patched = 0;
+    for (uint64_t i = 0; i < header.attributes.count; ++i) {
+        ngraph::binary_ir::Attribute attribute;
+        const auto offset = header.attributes.offset + i * sizeof(attribute);
+        ASSERT_LE(offset + sizeof(attribute), content.size());
+        std::memcpy(&attribute, content.data() + offset, sizeof(attribute));
+        if (attribute.type == ngraph::binary_ir::AttributeType::weights && attribute.value.count > 0) {
+            attribute.value.count--;
+            std::memcpy(&content[offset], &attribute, sizeof(attribute));
+            patched++;
+        }
+    }
+    ASSERT_GT(patched, 0);
+
+    const std::string irb_path = "binary_ir_small_weights.irb";
+    const std::string bin_path = "binary_ir_small_weights.bin";
+    {
+        std::ofstream out(irb_path, std::ios::binary);
+        out.write(content.data(), content.size());
+        const auto weights = bin.str();
+        std::ofstream outBin(bin_path, std::ios::binary);
+        outBin.write(weights.data(), weights.size());
+    }
+    try {
+        ie.ReadNetwork(irb_path, bin_path);
+        FAIL() << "The inconsistent weights size is not detected";
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        ASSERT_NE(std::string(e.what()).find("Attribute and shape size are inconsistent"), std::string::npos) << e.what();
+    }
+    std::remove(irb_path.c_str());
+    std::remove(bin_path.c_str());
+}
@@ -2,11 +2,15 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
 #include "gtest/gtest.h"
 #include "ie_core.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/opsets/opset6.hpp"
 #include "transformations/serialize.hpp"
 
 #ifndef IR_SERIALIZATION_MODELS_PATH  // should be already defined by cmake
@@ -55,3 +59,50 @@ TEST_F(SerializationTransformationTest, PassManagerInstantiation) {
     ASSERT_TRUE(xml.good());
     ASSERT_TRUE(bin.good());
 }
+
+TEST(SerializationConstantsTest, IdenticalConstantsAreWrittenOnce) {
+    std::vector<float> values(64, 1.f);
+    auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{64});
+    auto add = std::make_shared<ngraph::opset6::Add>(
+        input, ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{64}, values));
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(
+        add, ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{64}, values));
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{mul}, ngraph::ParameterVector{input});
+
+    std::stringstream xml, bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(function);
+    ASSERT_EQ(values.size() * sizeof(float), bin.str().size());
+
+    InferenceEngine::Core ie;
+    auto weights = InferenceEngine::make_shared_blob<uint8_t>(
+        {InferenceEngine::Precision::U8, {bin.str().size()}, InferenceEngine::Layout::C});
+    weights->allocate();
+    std::memcpy(weights->buffer(), bin.str().data(), bin.str().size());
+    auto result = ie.ReadNetwork(xml.str(), weights).getFunction();
+    auto ops = result->get_ops();
+    ASSERT_EQ(2, std::count_if(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& op) {
+        return ngraph::op::is_constant(op);
+    }));
+}
+
+TEST(SerializationConstantsTest, BinSinkGetsConstantsData) {
+    std::vector<float> values{1.f, 2.f, 3.f, 4.f};
+    auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{4});
+    auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{4}, values);
+    auto add = std::make_shared<ngraph::opset6::Add>(input, constant);
+    auto function = std::make_shared<ngraph::Function>(ngraph::NodeVector{add}, ngraph::ParameterVector{input});
+
+    std::stringstream xml;
+    std::vector<const char*> chunks;
+    std::size_t size = 0;
+    ngraph::pass::Serialize(xml, [&](const char* data, std::size_t chunk_size) {
+        chunks.push_back(data);
+        size += chunk_size;
+    }).run_on_function(function);
+
+    ASSERT_EQ(1u, chunks.size());
+    // the data is not copied
+    ASSERT_EQ(constant->get_data_ptr<char>(), chunks.front());
+    ASSERT_EQ(values.size() * sizeof(float), size);
+    ASSERT_NE(std::string::npos, xml.str().find("</net>"));
+}
@@ -4,11 +4,14 @@
 
 #include <tuple>
 #include <algorithm>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <gtest/gtest.h>
 
 #include <legacy/details/ie_cnn_network_tools.h>
+#include <ngraph/op/constant.hpp>
 
 #include "common_test_utils/test_common.hpp"
 #include "common_test_utils/unicode_utils.hpp"
@@ -57,6 +60,16 @@ protected:
         CommonTestUtils::removeIRFiles(_modelPath, _weightsPath);
     }
 
+    static std::vector<std::shared_ptr<ngraph::op::Constant>> getConstants(const InferenceEngine::CNNNetwork& net) {
+        std::vector<std::shared_ptr<ngraph::op::Constant>> constants;
+        for (auto&& op : net.getFunction()->get_ordered_ops()) {
+            if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(op)) {
+                constants.push_back(constant);
+            }
+        }
+        return constants;
+    }
+
     /* validates a read network with the reference map of CNN layers */
     void compareWithRef(const InferenceEngine::CNNNetwork &network,
                         const std::vector<InferenceEngine::CNNLayerPtr> &refLayersVec) {
@@ -112,6 +125,80 @@ TEST_P(NetReaderTest, ReadNetworkTwiceSeparately) {
     IE_SUPPRESS_DEPRECATED_END
 }
 
+TEST_P(NetReaderTest, ReadNetworkTwiceCached) {
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(READ_NETWORK_CACHE), CONFIG_VALUE(YES)}});
+
+    InferenceEngine::CNNNetwork network;
+    read(_modelPath, _weightsPath, ie, network);
+
+    InferenceEngine::CNNNetwork network2;
+    read(_modelPath, _weightsPath, ie, network2);
+
+    ASSERT_NE(network.getFunction(), network2.getFunction());
+    ASSERT_NO_THROW(FuncTestUtils::compareCNNNetworks(network, network2));
+
+    // the copies share the weights
+    auto constants = getConstants(network), constants2 = getConstants(network2);
+    ASSERT_EQ(constants.size(), constants2.size());
+    for (size_t i = 0; i < constants.size(); ++i) {
+        ASSERT_NE(constants[i], constants2[i]);
+        ASSERT_EQ(constants[i]->get_data_ptr(), constants2[i]->get_data_ptr());
+    }
+
+    // the changes of a copy are not visible in the other copies
+    network.getInputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::U8);
+    InferenceEngine::CNNNetwork network3;
+    read(_modelPath, _weightsPath, ie, network3);
+    ASSERT_EQ(network2.getInputsInfo().begin()->second->getPrecision(),
+              network3.getInputsInfo().begin()->second->getPrecision());
+}
+
+TEST_P(NetReaderTest, ReadNetworkFromMemoryCachedComparesContent) {
+    InferenceEngine::Core ie;
+    ie.SetConfig({{CONFIG_KEY(READ_NETWORK_CACHE), CONFIG_VALUE(YES)}});
+
+    std::ifstream modelFile(_modelPath);
+    std::string model((std::istreambuf_iterator<char>(modelFile)), std::istreambuf_iterator<char>());
+    std::ifstream weightsFile(_weightsPath, std::ios::binary);
+    std::vector<char> weightsData((std::istreambuf_iterator<char>(weightsFile)), std::istreambuf_iterator<char>());
+    ASSERT_FALSE(weightsData.empty());
+    // the unused tail makes the weights longer than the sampled bytes of the cache key
+    weightsData.resize(weightsData.size() + 16 * 1024, 0);
+
+    auto makeWeights = [&] {
+        auto blob = InferenceEngine::make_shared_blob<uint8_t>(
+            {InferenceEngine::Precision::U8, {weightsData.size()}, InferenceEngine::Layout::C});
+        blob->allocate();
+        std::copy(weightsData.begin(), weightsData.end(), blob->buffer().as<char*>());
+        return blob;
+    };
+
+    auto weights = makeWeights();
+    auto network = ie.ReadNetwork(model, weights);
+    auto constants = getConstants(network);
+    ASSERT_FALSE(constants.empty());
+
+    // the same weights are a hit, the copies share the Constant data
+    auto network2 = ie.ReadNetwork(model, weights);
+    auto constants2 = getConstants(network2);
+    ASSERT_EQ(constants.size(), constants2.size());
+    for (size_t i = 0; i < constants.size(); ++i) {
+        ASSERT_EQ(constants[i]->get_data_ptr(), constants2[i]->get_data_ptr());
+    }
+
+    // the weights of the same size with the same first and last bytes have the same cache key,
+    // the network is read again from the new weights
+    auto weights3 = makeWeights();
+    weights3->buffer().as<char*>()[weightsData.size() / 2] ^= 1;
+    auto network3 = ie.ReadNetwork(model, weights3);
+    auto constants3 = getConstants(network3);
+    ASSERT_EQ(constants.size(), constants3.size());
+    for (size_t i = 0; i < constants.size(); ++i) {
+        ASSERT_NE(constants[i]->get_data_ptr(), constants3[i]->get_data_ptr());
+    }
+}
+
 #ifdef ENABLE_UNICODE_PATH_SUPPORT
 
 TEST_P(NetReaderTest, ReadCorrectModelWithWeightsUnicodePath) {
@@ -0,0 +1,106 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <sstream>
+
+#include <ngraph/opsets/opset6.hpp>
+#include <transformations/serialize.hpp>
+
+#include "ngraph_reader_tests.hpp"
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+namespace {
+
+// many independent branches, so that the layers are decoded by the different threads
+std::shared_ptr<ngraph::Function> makeWideFunction(size_t branches) {
+    auto input = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 8});
+    input->set_friendly_name("input");
+    ngraph::OutputVector concatInputs;
+    for (size_t i = 0; i < branches; ++i) {
+        std::vector<float> values(8, static_cast<float>(i));
+        auto constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 8}, values);
+        constant->set_friendly_name("const_" + std::to_string(i));
+        auto add = std::make_shared<ngraph::opset6::Add>(input, constant);
+        add->set_friendly_name("add_" + std::to_string(i));
+        auto relu = std::make_shared<ngraph::opset6::Relu>(add);
+        relu->set_friendly_name("relu_" + std::to_string(i));
+        concatInputs.push_back(relu);
+    }
+    auto concat = std::make_shared<ngraph::opset6::Concat>(concatInputs, 0);
+    concat->set_friendly_name("concat");
+    auto result = std::make_shared<ngraph::opset6::Result>(concat);
+    return std::make_shared<ngraph::Function>(ngraph::ResultVector{result}, ngraph::ParameterVector{input}, "wide");
+}
+
+}  // namespace
+
+TEST_F(NGraphReaderTests, ReadWideNetworkInParallel) {
+    auto expected = makeWideFunction(256);
+
+    std::stringstream xml, bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(expected);
+    const auto binData = bin.str();
+    auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {binData.size()}, Layout::C));
+    weights->allocate();
+    std::copy(binData.begin(), binData.end(), weights->buffer().as<char*>());
+
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(READ_NETWORK_PARALLEL), CONFIG_VALUE(YES)}});
+    auto network = ie.ReadNetwork(xml.str(), weights);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(network.getFunction(), expected, true, false, true, true);
+    ASSERT_TRUE(success) << message;
+}
+
+TEST_F(NGraphReaderTests, ReadWideNetworkWithUnknownOperationThrows) {
+    std::stringstream xml, bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(makeWideFunction(64));
+    const auto binData = bin.str();
+    auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {binData.size()}, Layout::C));
+    weights->allocate();
+    std::copy(binData.begin(), binData.end(), weights->buffer().as<char*>());
+
+    // the error of the concurrently decoded layer is reported to the caller
+    auto model = xml.str();
+    auto layer = model.find("name=\"relu_42\"");
+    ASSERT_NE(std::string::npos, layer);
+    auto type = model.find("type=\"Relu\"", layer);
+    ASSERT_NE(std::string::npos, type);
+    model.replace(type, std::string("type=\"Relu\"").size(), "type=\"UnknownRelu\"");
+
+    Core ie;
+    ie.SetConfig({{CONFIG_KEY(READ_NETWORK_PARALLEL), CONFIG_VALUE(YES)}});
+    try {
+        ie.ReadNetwork(model, weights);
+        FAIL() << "The network with the unknown operation is read";
+    } catch (const InferenceEngine::details::InferenceEngineException& e) {
+        ASSERT_NE(std::string::npos, std::string(e.what()).find("UnknownRelu"));
+    }
+}
+
+TEST_F(NGraphReaderTests, ParallelReadMatchesSequentialRead) {
+    auto expected = makeWideFunction(64);
+
+    std::stringstream xml, bin;
+    ngraph::pass::Serialize(xml, bin).run_on_function(expected);
+    const auto binData = bin.str();
+    auto weights = make_shared_blob<uint8_t>(TensorDesc(Precision::U8, {binData.size()}, Layout::C));
+    weights->allocate();
+    std::copy(binData.begin(), binData.end(), weights->buffer().as<char*>());
+
+    Core ie;
+    auto sequential = ie.ReadNetwork(xml.str(), weights);
+    ie.SetConfig({{CONFIG_KEY(READ_NETWORK_PARALLEL), CONFIG_VALUE(YES)}});
+    auto parallel = ie.ReadNetwork(xml.str(), weights);
+
+    bool success;
+    std::string message;
+    std::tie(success, message) = compare_functions(sequential.getFunction(), parallel.getFunction(), true, false, true, true);
+    ASSERT_TRUE(success) << message;
+
+    ASSERT_THROW(ie.SetConfig({{CONFIG_KEY(READ_NETWORK_PARALLEL), "ON"}}), InferenceEngine::details::InferenceEngineException);
+}
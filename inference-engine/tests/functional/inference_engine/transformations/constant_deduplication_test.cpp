@@ -0,0 +1,99 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <ngraph/function.hpp>
+#include <ngraph/opsets/opset6.hpp>
+#include <ngraph/pass/manager.hpp>
+#include <transformations/common_optimizations/constant_deduplication.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/rt_info/fused_names_attribute.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+
+TEST(TransformationTests, ConstantDeduplication) {
+    std::shared_ptr<ngraph::Function> f(nullptr), f_ref(nullptr);
+    {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto const1 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        const1->set_friendly_name("const1");
+        auto const2 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        const2->set_friendly_name("const2");
+        auto const3 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 4});
+        auto add = std::make_shared<ngraph::opset6::Add>(data, const1);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, const2);
+        auto sub = std::make_shared<ngraph::opset6::Subtract>(mul, const3);
+
+        f = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+
+        ngraph::pass::Manager manager;
+        manager.register_pass<ngraph::pass::InitNodeInfo>();
+        manager.register_pass<ngraph::pass::ConstantDeduplication>();
+        manager.run_passes(f);
+        ASSERT_NO_THROW(check_rt_info(f));
+
+        ASSERT_EQ(add->input_value(1).get_node(), mul->input_value(1).get_node());
+        auto fused_names = ngraph::getFusedNamesVector(add->get_input_node_shared_ptr(1));
+        ASSERT_EQ(2u, fused_names.size());
+    }
+
+    {
+        auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 3});
+        auto const1 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 3});
+        auto const3 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1, 3}, {1, 2, 4});
+        auto add = std::make_shared<ngraph::opset6::Add>(data, const1);
+        auto mul = std::make_shared<ngraph::opset6::Multiply>(add, const1);
+        auto sub = std::make_shared<ngraph::opset6::Subtract>(mul, const3);
+
+        f_ref = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConstantDeduplicationDifferentTypes) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::i32, ngraph::Shape{2});
+    auto const1 = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{2}, {0, 0});
+    auto const2 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{2}, {0, 0});
+    auto const3 = ngraph::opset6::Constant::create(ngraph::element::i32, ngraph::Shape{1, 2}, {0, 0});
+    auto add = std::make_shared<ngraph::opset6::Add>(data, const1);
+    auto convert = std::make_shared<ngraph::opset6::Convert>(add, ngraph::element::f32);
+    auto mul = std::make_shared<ngraph::opset6::Multiply>(convert, const2);
+    auto reshape = std::make_shared<ngraph::opset6::Reshape>(mul, ngraph::opset6::Constant::create(
+        ngraph::element::i64, ngraph::Shape{2}, {1, 2}), false);
+    auto sub = std::make_shared<ngraph::opset6::Subtract>(
+        std::make_shared<ngraph::opset6::Convert>(reshape, ngraph::element::i32), const3);
+
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{sub}, ngraph::ParameterVector{data});
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::ConstantDeduplication>();
+    manager.run_passes(f);
+
+    ASSERT_EQ(const1, add->get_input_node_shared_ptr(1));
+    ASSERT_EQ(const2, mul->get_input_node_shared_ptr(1));
+    ASSERT_EQ(const3, sub->get_input_node_shared_ptr(1));
+}
+
+TEST(TransformationTests, ConstantDeduplicationKeepsOutputs) {
+    auto const1 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1});
+    const1->set_friendly_name("out1");
+    auto const2 = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {1});
+    const2->set_friendly_name("out2");
+    auto f = std::make_shared<ngraph::Function>(ngraph::NodeVector{const1, const2}, ngraph::ParameterVector{});
+
+    ngraph::pass::Manager manager;
+    manager.register_pass<ngraph::pass::ConstantDeduplication>();
+    manager.run_passes(f);
+
+    ASSERT_EQ(const1, f->get_results()[0]->get_input_node_shared_ptr(0));
+    ASSERT_EQ(const2, f->get_results()[1]->get_input_node_shared_ptr(0));
+}
@@ -0,0 +1,16 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include "multi/multi_scheduling_tests.hpp"
+#include "common_test_utils/test_constants.hpp"
+
+const std::vector<DevicesNames> device_names_for_scheduling {
+        {CPU},
+        {CPU, CommonTestUtils::DEVICE_TEMPLATE},
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_SchedulingMultiCPU, MultiDevice_SchedulingTest,
+        ::testing::ValuesIn(device_names_for_scheduling), MultiDevice_SchedulingTest::getTestCaseName);
@@ -105,6 +105,16 @@ const auto testCasesAxis_6 = ::testing::Combine(
     ::testing::Values(CommonTestUtils::DEVICE_CPU)
 );
 
+// long lines along the innermost axis are scanned in blocks
+const auto testCasesLongAxis = ::testing::Combine(
+    ::testing::Values(std::vector<size_t>{1, 65536}, std::vector<size_t>{3, 20001}),
+    ::testing::Values(InferenceEngine::Precision::I32, InferenceEngine::Precision::FP32),
+    ::testing::Values(negativeAxes[0]),
+    ::testing::ValuesIn(exclusive),
+    ::testing::ValuesIn(reverse),
+    ::testing::Values(CommonTestUtils::DEVICE_CPU)
+);
+
 INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_negative_axis, CumSumLayerTest, testCasesNegativeAxis, CumSumLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_axis_0, CumSumLayerTest, testCasesAxis_0, CumSumLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_axis_1, CumSumLayerTest, testCasesAxis_1, CumSumLayerTest::getTestCaseName);
@@ -113,3 +123,4 @@ INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_axis_3, CumSumLayerTest, testCa
 INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_axis_4, CumSumLayerTest, testCasesAxis_4, CumSumLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_axis_5, CumSumLayerTest, testCasesAxis_5, CumSumLayerTest::getTestCaseName);
 INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_axis_6, CumSumLayerTest, testCasesAxis_6, CumSumLayerTest::getTestCaseName);
+INSTANTIATE_TEST_CASE_P(smoke_MKLDNN_TestsCumSum_long_axis, CumSumLayerTest, testCasesLongAxis, CumSumLayerTest::getTestCaseName);
@@ -73,4 +73,28 @@ INSTANTIATE_TEST_CASE_P(
         LogSoftmaxLayerTest::getTestCaseName
 );
 
+const std::vector<InferenceEngine::SizeVector> inputShapesLongAxis = {
+    InferenceEngine::SizeVector {1, 50000},
+    InferenceEngine::SizeVector {2, 32003},
+};
+
+const auto paramsLongAxis = testing::Combine(
+    testing::ValuesIn(netPrecisions),
+    testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+    testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+    testing::Values(InferenceEngine::Layout::ANY),
+    testing::Values(InferenceEngine::Layout::ANY),
+    testing::ValuesIn(inputShapesLongAxis),
+    testing::Values(-1),
+    testing::Values(CommonTestUtils::DEVICE_CPU),
+    testing::Values(std::map<std::string, std::string>())
+);
+
+INSTANTIATE_TEST_CASE_P(
+        smoke_LogSoftmaxLongAxis,
+        LogSoftmaxLayerTest,
+        paramsLongAxis,
+        LogSoftmaxLayerTest::getTestCaseName
+);
+
 }  // namespace
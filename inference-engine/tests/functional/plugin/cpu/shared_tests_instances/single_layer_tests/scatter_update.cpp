@@ -27,6 +27,7 @@ const std::vector<InferenceEngine::Precision> idxPrecisions = {
 std::map<std::vector<size_t>, std::map<std::vector<size_t>, std::vector<int>>> axesShapeInShape {
     {{10, 16, 12, 15}, {{{2, 4}, {0, 1, 2, 3}}, {{8}, {-1, -2, -3, -4}}}},
     {{10, 9, 10, 9, 10}, {{{8}, {-3, -1, 0, 2, 4}}, {{4, 2}, {-2, 2}}}},
+    {{1, 4, 65536}, {{{2}, {1, -2}}}},
 };
 //indices should not be random value
 const std::vector<std::vector<int64_t>> idxValue = {
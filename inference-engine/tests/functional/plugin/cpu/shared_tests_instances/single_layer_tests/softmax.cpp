@@ -75,4 +75,47 @@ INSTANTIATE_TEST_CASE_P(
         SoftMaxLayerTest::getTestCaseName
 );
 
+const auto params4DNHWC = testing::Combine(
+    testing::ValuesIn(netPrecisions),
+    testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+    testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+    testing::Values(InferenceEngine::Layout::NHWC),
+    testing::Values(InferenceEngine::Layout::ANY),
+    testing::ValuesIn(inputShapes4D),
+    testing::ValuesIn(axis4D),
+    testing::Values(CommonTestUtils::DEVICE_CPU),
+    testing::Values(std::map<std::string, std::string>())
+);
+
+INSTANTIATE_TEST_CASE_P(
+        smoke_SoftMax4D_NHWC,
+        SoftMaxLayerTest,
+        params4DNHWC,
+        SoftMaxLayerTest::getTestCaseName
+);
+
+const std::vector<InferenceEngine::SizeVector> inputShapesLongAxis = {
+    InferenceEngine::SizeVector {1, 50000},
+    InferenceEngine::SizeVector {2, 32003},
+};
+
+const auto paramsLongAxis = testing::Combine(
+    testing::ValuesIn(netPrecisions),
+    testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+    testing::Values(InferenceEngine::Precision::UNSPECIFIED),
+    testing::ValuesIn(inputLayouts2D),
+    testing::Values(InferenceEngine::Layout::ANY),
+    testing::ValuesIn(inputShapesLongAxis),
+    testing::Values(1),
+    testing::Values(CommonTestUtils::DEVICE_CPU),
+    testing::Values(std::map<std::string, std::string>())
+);
+
+INSTANTIATE_TEST_CASE_P(
+        smoke_SoftMaxLongAxis,
+        SoftMaxLayerTest,
+        paramsLongAxis,
+        SoftMaxLayerTest::getTestCaseName
+);
+
 }  // namespace
@@ -4,7 +4,8 @@
 
 #include <shared_test_classes/single_layer/reduce_ops.hpp>
 #include "ngraph_functions/builders.hpp"
-#include "test_utils/cpu_test_utils.hpp"
+#include "test_utils/fusing_test_utils.hpp"
+#include <algorithm>
 
 using namespace InferenceEngine;
 using namespace CPUTestUtils;
@@ -12,20 +13,22 @@ using namespace LayerTestsDefinitions;
 
 namespace CPULayerTestsDefinitions {
 
-typedef std::tuple<reduceMeanParams, CPUSpecificParams> ReduceLayerCPUTestParamSet;
+typedef std::tuple<reduceMeanParams, CPUSpecificParams, fusingSpecificParams> ReduceLayerCPUTestParamSet;
 
 class ReduceCPULayerTest : public testing::WithParamInterface<ReduceLayerCPUTestParamSet>,
-                           virtual public LayerTestsUtils::LayerTestsCommon, public CPUTestsBase {
+                           virtual public LayerTestsUtils::LayerTestsCommon, public CpuTestWithFusing {
 public:
     static std::string getTestCaseName(testing::TestParamInfo<ReduceLayerCPUTestParamSet> obj) {
         reduceMeanParams basicParamsSet;
         CPUSpecificParams cpuParams;
-        std::tie(basicParamsSet, cpuParams) = obj.param;
+        fusingSpecificParams fusingParams;
+        std::tie(basicParamsSet, cpuParams, fusingParams) = obj.param;
 
         std::ostringstream result;
         result << LayerTestsDefinitions::ReduceOpsLayerTest::getTestCaseName(testing::TestParamInfo<reduceMeanParams>(
                 basicParamsSet, 0));
         result << CPUTestsBase::getTestCaseName(cpuParams);
+        result << CpuTestWithFusing::getTestCaseName(fusingParams);
 
         return result.str();
     }
@@ -33,9 +36,11 @@ protected:
     void SetUp() override {
         reduceMeanParams basicParamsSet;
         CPUSpecificParams cpuParams;
-        std::tie(basicParamsSet, cpuParams) = this->GetParam();
+        fusingSpecificParams fusingParams;
+        std::tie(basicParamsSet, cpuParams, fusingParams) = this->GetParam();
 
         std::tie(inFmts, outFmts, priority, selectedType) = cpuParams;
+        std::tie(postOpMgrPtr, fusedOps) = fusingParams;
 
         InferenceEngine::Precision netPrecision;
         bool keepDims;
@@ -70,10 +75,7 @@ protected:
 
         selectedType = getPrimitiveType() + "_" + inPrc.name();
 
-        reduce->get_rt_info() = getCPUInfo();
-
-        const ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(reduce)};
-        function = std::make_shared<ngraph::Function>(results, params, "Reduce");
+        function = makeNgraphFunction(ngPrc, params, reduce, "Reduce");
     }
     InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
         if (ngraph::helpers::ReductionType::Prod == reductionType) {
@@ -104,7 +106,11 @@ TEST_P(ReduceCPULayerTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
 
     auto ops = function->get_ordered_ops();
-    std::string name = (*(++ops.rbegin()))->get_type_name();
+    auto reduce = std::find_if(ops.begin(), ops.end(), [](const std::shared_ptr<ngraph::Node>& op) {
+        return std::string(op->get_type_name()).find("Reduce") == 0;
+    });
+    ASSERT_NE(ops.end(), reduce);
+    std::string name = (*reduce)->get_type_name();
 
     if ("ReduceLogicalAnd" == name) {
         name = "ReduceAnd";
@@ -192,7 +198,8 @@ const auto paramsOneAxis = ::testing::Combine(
             testing::Values(InferenceEngine::Layout::ANY),
             testing::ValuesIn(inputShapes),
             testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::Values(emptyCPUSpec));
+        testing::Values(emptyCPUSpec),
+        testing::Values(emptyFusingSpec));
 
 const auto paramsOneAxisLogical = testing::Combine(
         testing::Combine(
@@ -206,7 +213,8 @@ const auto paramsOneAxisLogical = testing::Combine(
             testing::Values(InferenceEngine::Layout::ANY),
             testing::ValuesIn(inputShapes),
             testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::Values(emptyCPUSpec));
+        testing::Values(emptyCPUSpec),
+        testing::Values(emptyFusingSpec));
 
 const auto params_MultiAxis = testing::Combine(
         testing::Combine(
@@ -220,7 +228,8 @@ const auto params_MultiAxis = testing::Combine(
             testing::Values(InferenceEngine::Layout::ANY),
             testing::Values(std::vector<size_t>{2, 9, 2, 9}),
             testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::Values(emptyCPUSpec));
+        testing::Values(emptyCPUSpec),
+        testing::Values(emptyFusingSpec));
 
 const auto params_MultiAxis_4D = testing::Combine(
         testing::Combine(
@@ -234,7 +243,8 @@ const auto params_MultiAxis_4D = testing::Combine(
                 testing::Values(InferenceEngine::Layout::ANY),
                 testing::Values(std::vector<size_t>{2, 19, 2, 9}),
                 testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)));
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+        testing::Values(emptyFusingSpec));
 
 const auto params_MultiAxis_5D = testing::Combine(
         testing::Combine(
@@ -248,7 +258,29 @@ const auto params_MultiAxis_5D = testing::Combine(
                 testing::Values(InferenceEngine::Layout::ANY),
                 testing::Values(std::vector<size_t>{2, 19, 7, 2, 9}),
                 testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::ValuesIn(filterCPUSpecificParams(cpuParams_5D)));
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_5D)),
+        testing::Values(emptyFusingSpec));
+
+const std::vector<fusingSpecificParams> fusingParamsSet {
+        fusingRelu,
+        fusingScaleShift,
+        fusingFakeQuantizePerChannelRelu
+};
+
+const auto params_MultiAxis_4D_Fusing = testing::Combine(
+        testing::Combine(
+                testing::Values(std::vector<int>{1}, std::vector<int>{2, 3}, std::vector<int>{1, 2, 3}),
+                testing::Values(opTypes[1]),
+                testing::Values(true),
+                testing::Values(ngraph::helpers::ReductionType::Min, ngraph::helpers::ReductionType::L2),
+                testing::Values(InferenceEngine::Precision::FP32),
+                testing::Values(InferenceEngine::Precision::FP32),
+                testing::Values(InferenceEngine::Precision::FP32),
+                testing::Values(InferenceEngine::Layout::ANY),
+                testing::Values(std::vector<size_t>{2, 19, 2, 9}),
+                testing::Values(CommonTestUtils::DEVICE_CPU)),
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+        testing::ValuesIn(fusingParamsSet));
 
 const auto params_MultiAxisLogical = testing::Combine(
         testing::Combine(
@@ -262,7 +294,8 @@ const auto params_MultiAxisLogical = testing::Combine(
             testing::Values(InferenceEngine::Layout::ANY),
             testing::Values(std::vector<size_t>{2, 9, 2, 9}),
             testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::Values(emptyCPUSpec));
+        testing::Values(emptyCPUSpec),
+        testing::Values(emptyFusingSpec));
 
 const auto params_MultiAxisLogical4D = testing::Combine(
         testing::Combine(
@@ -276,7 +309,8 @@ const auto params_MultiAxisLogical4D = testing::Combine(
                 testing::Values(InferenceEngine::Layout::ANY),
                 testing::Values(std::vector<size_t>{2, 19, 2, 9}),
                 testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)));
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_4D)),
+        testing::Values(emptyFusingSpec));
 
 const auto params_MultiAxisLogical5D = testing::Combine(
         testing::Combine(
@@ -290,7 +324,8 @@ const auto params_MultiAxisLogical5D = testing::Combine(
                 testing::Values(InferenceEngine::Layout::ANY),
                 testing::Values(std::vector<size_t>{2, 19, 7, 2, 9}),
                 testing::Values(CommonTestUtils::DEVICE_CPU)),
-        testing::ValuesIn(filterCPUSpecificParams(cpuParams_5D)));
+        testing::ValuesIn(filterCPUSpecificParams(cpuParams_5D)),
+        testing::Values(emptyFusingSpec));
 
 INSTANTIATE_TEST_CASE_P(
         smoke_ReduceOneAxis_CPU,
@@ -327,6 +362,13 @@ INSTANTIATE_TEST_CASE_P(
         ReduceCPULayerTest::getTestCaseName
 );
 
+INSTANTIATE_TEST_CASE_P(
+        smoke_Reduce_ReductionTypes4D_Fusing_CPU,
+        ReduceCPULayerTest,
+        params_MultiAxis_4D_Fusing,
+        ReduceCPULayerTest::getTestCaseName
+);
+
 INSTANTIATE_TEST_CASE_P(
         smoke_ReduceLogical_ReductionTypes_CPU,
         ReduceCPULayerTest,
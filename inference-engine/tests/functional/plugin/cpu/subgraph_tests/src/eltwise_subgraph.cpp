@@ -0,0 +1,153 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <tuple>
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using ngraph::helpers::EltwiseTypes;
+using ngraph::helpers::ActivationTypes;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class EltwiseSubgraphType {
+    Branches,       // (relu(x * c0)) - (x * c0 + c1)
+    SharedInput,    // tanh(x + c0) * x
+    MultipleUses    // ((x - c0) * (x - c0)) * (x - c0) + (x - c0)
+};
+
+typedef std::tuple<
+        EltwiseSubgraphType,                     // Subgraph topology
+        std::vector<size_t>,                     // Input shape
+        std::string                              // Device name
+> EltwiseSubgraphTuple;
+
+/* All the elementwise operations of the subgraph are expected to be computed by a single Eltwise node, e.g. Branches:
+
+        Input  Const
+           \    /
+          Multiply   Const
+           /    \     /
+         Relu    Add
+           \     /
+          Subtract
+              |
+           Output
+*/
+class EltwiseSubgraphTest : public testing::WithParamInterface<EltwiseSubgraphTuple>,
+                            virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<EltwiseSubgraphTuple> &obj) {
+        EltwiseSubgraphType subgraphType;
+        std::vector<size_t> inputShape;
+        std::string targetName;
+        std::tie(subgraphType, inputShape, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "Subgraph=" << static_cast<int>(subgraphType) << "_";
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        EltwiseSubgraphType subgraphType;
+        std::vector<size_t> inputShape;
+        std::tie(subgraphType, inputShape, targetDevice) = this->GetParam();
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape});
+
+        auto makeConst = [&]() {
+            return ngraph::builder::makeConstant(ngPrc, inputShape, std::vector<float>{}, true);
+        };
+
+        std::shared_ptr<ngraph::Node> output;
+        switch (subgraphType) {
+            case EltwiseSubgraphType::Branches: {
+                auto scaled = ngraph::builder::makeEltwise(params[0], makeConst(), EltwiseTypes::MULTIPLY);
+                auto relu = ngraph::builder::makeActivation(scaled, ngPrc, ActivationTypes::Relu);
+                auto shifted = ngraph::builder::makeEltwise(scaled, makeConst(), EltwiseTypes::ADD);
+                output = ngraph::builder::makeEltwise(relu, shifted, EltwiseTypes::SUBTRACT);
+                break;
+            }
+            case EltwiseSubgraphType::SharedInput: {
+                auto shifted = ngraph::builder::makeEltwise(params[0], makeConst(), EltwiseTypes::ADD);
+                auto tanh = ngraph::builder::makeActivation(shifted, ngPrc, ActivationTypes::Tanh);
+                output = ngraph::builder::makeEltwise(tanh, params[0], EltwiseTypes::MULTIPLY);
+                break;
+            }
+            case EltwiseSubgraphType::MultipleUses: {
+                auto shifted = ngraph::builder::makeEltwise(params[0], makeConst(), EltwiseTypes::SUBTRACT);
+                auto square = ngraph::builder::makeEltwise(shifted, shifted, EltwiseTypes::MULTIPLY);
+                auto cube = ngraph::builder::makeEltwise(square, shifted, EltwiseTypes::MULTIPLY);
+                output = ngraph::builder::makeEltwise(cube, shifted, EltwiseTypes::ADD);
+                break;
+            }
+        }
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(output)};
+        function = std::make_shared<ngraph::Function>(results, params, "eltwise_subgraph");
+    }
+
+    void CheckEltwiseCount(size_t expectedEltwiseCount) {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto function = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, function);
+        size_t actualEltwiseCount = 0;
+        for (const auto &node : function->get_ops()) {
+            const auto & rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            auto value = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != value);
+            if (value->get() == "Eltwise") {
+                actualEltwiseCount++;
+            }
+        }
+
+        ASSERT_EQ(expectedEltwiseCount, actualEltwiseCount);
+    }
+};
+
+TEST_P(EltwiseSubgraphTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+    if (InferenceEngine::with_cpu_x86_sse42())
+        CheckEltwiseCount(1);
+}
+
+namespace {
+
+const std::vector<EltwiseSubgraphType> subgraphTypes = {
+        EltwiseSubgraphType::Branches,
+        EltwiseSubgraphType::SharedInput,
+        EltwiseSubgraphType::MultipleUses
+};
+
+const std::vector<std::vector<size_t>> inputShapes = {
+        {1, 3, 5, 7},
+        {2, 19, 4, 9},
+        {1, 16, 3, 4, 5}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_EltwiseSubgraph, EltwiseSubgraphTest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(subgraphTypes),
+                                ::testing::ValuesIn(inputShapes),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        EltwiseSubgraphTest::getTestCaseName);
+
+} // namespace
+} // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,169 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <ie_system_conf.h>
+#include <exec_graph_info.hpp>
+#include <ngraph/variant.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "common_test_utils/data_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class FQLSTMType {
+    Cell,
+    Sequence
+};
+
+typedef std::tuple<
+        FQLSTMType,                              // LSTMCell or LSTMSequence
+        size_t,                                  // Batch
+        std::pair<float, float>,                 // FakeQuantize range
+        std::string                              // Device name
+> FQLSTMTuple;
+
+/* On avx512_core the per-tensor u8 FakeQuantize of the data input is merged into the LSTM node, which runs the INT8
+   oneDNN primitive then, so no Quantize node is left in the executable graph. The hidden state is quantized with the
+   same parameters, so the FakeQuantize is kept when its range does not cover [-1, 1]:
+
+    X   FakeQuantize(256 levels)    H0  C0
+          \                         |   /
+              LSTMCell/LSTMSequence
+                  /      |      \
+                 Y       Ho      Co
+*/
+class FQLSTMTest : public testing::WithParamInterface<FQLSTMTuple>,
+                   virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FQLSTMTuple> &obj) {
+        FQLSTMType type;
+        size_t batch;
+        std::pair<float, float> range;
+        std::string targetName;
+        std::tie(type, batch, range, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << (type == FQLSTMType::Cell ? "LSTMCell" : "LSTMSequence") << "_";
+        results << "N=" << batch << "_";
+        results << "FQ=(" << range.first << "," << range.second << ")_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        FQLSTMType type;
+        size_t batch;
+        std::pair<float, float> range;
+        std::tie(type, batch, range, targetDevice) = this->GetParam();
+        isQuantizeMerged = range.first <= -1.f && range.second >= 1.f;
+
+        const size_t seqLength = 3;
+        const size_t inputSize = 32;
+        const size_t hiddenSize = 64;
+        const size_t gates = 4;
+
+        // the weights are quantized to 8 bits by the INT8 primitive
+        threshold = 0.05f;
+        // low precision transformations decompose the FakeQuantize, the test covers the plugin graph fusing
+        configuration[PluginConfigInternalParams::KEY_LP_TRANSFORMS_MODE] = PluginConfigParams::NO;
+
+        auto makeConst = [](const std::vector<size_t>& shape, int seed) {
+            auto values = CommonTestUtils::generate_float_numbers(ngraph::shape_size(shape), -0.2f, 0.2f, seed);
+            return ngraph::builder::makeConstant(ngraph::element::f32, shape, values);
+        };
+
+        const auto ngPrc = ngraph::element::f32;
+        std::shared_ptr<ngraph::Node> lstm;
+        ngraph::ParameterVector params;
+        if (type == FQLSTMType::Cell) {
+            params = ngraph::builder::makeParams(ngPrc, {{batch, inputSize}, {batch, hiddenSize}, {batch, hiddenSize}});
+            auto fq = ngraph::builder::makeFakeQuantize(params[0], ngPrc, 256, {1}, {range.first}, {range.second},
+                                                        {range.first}, {range.second});
+            lstm = std::make_shared<ngraph::opset4::LSTMCell>(fq, params[1], params[2],
+                                                              makeConst({gates * hiddenSize, inputSize}, 1),
+                                                              makeConst({gates * hiddenSize, hiddenSize}, 2),
+                                                              makeConst({gates * hiddenSize}, 3),
+                                                              hiddenSize);
+        } else {
+            params = ngraph::builder::makeParams(ngPrc,
+                                                 {{batch, seqLength, inputSize}, {batch, 1, hiddenSize}, {batch, 1, hiddenSize}});
+            auto fq = ngraph::builder::makeFakeQuantize(params[0], ngPrc, 256, {1}, {range.first}, {range.second},
+                                                        {range.first}, {range.second});
+            auto seqLengths = ngraph::builder::makeConstant(ngraph::element::i64, {batch},
+                                                            std::vector<int64_t>(batch, seqLength));
+            lstm = std::make_shared<ngraph::opset5::LSTMSequence>(fq, params[1], params[2], seqLengths,
+                                                                  makeConst({1, gates * hiddenSize, inputSize}, 1),
+                                                                  makeConst({1, gates * hiddenSize, hiddenSize}, 2),
+                                                                  makeConst({1, gates * hiddenSize}, 3),
+                                                                  hiddenSize,
+                                                                  ngraph::op::RecurrentSequenceDirection::FORWARD);
+        }
+
+        ngraph::ResultVector results;
+        for (size_t i = 0; i < lstm->get_output_size(); i++)
+            results.push_back(std::make_shared<ngraph::opset1::Result>(lstm->output(i)));
+        function = std::make_shared<ngraph::Function>(results, params, "FQLSTM");
+    }
+
+    InferenceEngine::Blob::Ptr GenerateInput(const InferenceEngine::InputInfo &info) const override {
+        // within the range of the merged FakeQuantize, so the quantized data input is not saturated
+        return FuncTestUtils::createAndFillBlob(info.getTensorDesc(), 2, -1, 100);
+    }
+
+    void CheckQuantizeFusing() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        ASSERT_NE(nullptr, execFunction);
+        size_t quantizeCount = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            ASSERT_NE(rtInfo.end(), it);
+            auto layerType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            ASSERT_NE(nullptr, layerType);
+            if (layerType->get() == "Quantize" || layerType->get() == "FakeQuantize")
+                quantizeCount++;
+        }
+        ASSERT_EQ(isQuantizeMerged ? 0u : 1u, quantizeCount);
+    }
+
+    bool isQuantizeMerged = false;
+};
+
+TEST_P(FQLSTMTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    if (!InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP() << "INT8 LSTM is used on avx512_core only";
+
+    Run();
+    CheckQuantizeFusing();
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_FQLSTM, FQLSTMTest,
+                        ::testing::Combine(
+                                ::testing::Values(FQLSTMType::Cell, FQLSTMType::Sequence),
+                                ::testing::Values(1, 4),
+                                // the last ranges do not cover the hidden state values, so they are not merged
+                                ::testing::Values(std::make_pair(-1.28f, 1.27f),
+                                                  std::make_pair(0.f, 2.55f),
+                                                  std::make_pair(-2.f, 0.5f)),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        FQLSTMTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
@@ -0,0 +1,121 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/common_utils.hpp"
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+typedef std::tuple<
+        std::vector<size_t>,                     // Input shape
+        std::string                              // Device name
+> LayoutAssignmentTuple;
+
+/* The chain mixes the blocked layout of the convolutions, the planar layout of the second input and the layouts
+   of the elementwise and pooling nodes, which support the planar, nspc and blocked formats:
+
+      Input0
+         |
+    Convolution   Input1
+           \       /
+           Multiply
+              |
+           MaxPool
+              |
+          Convolution
+              |
+            Output
+
+   The layout assignment never increases the cost of the reorders of the greedy per-node selection, the outputs
+   must not depend on the selected layouts.
+*/
+class LayoutAssignmentTest : public testing::WithParamInterface<LayoutAssignmentTuple>,
+                             virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<LayoutAssignmentTuple> &obj) {
+        std::vector<size_t> inputShape;
+        std::string targetName;
+        std::tie(inputShape, targetName) = obj.param;
+        std::ostringstream results;
+
+        results << "IS=" << CommonTestUtils::vec2str(inputShape) << "_";
+        results << "targetDevice=" << targetName;
+
+        return results.str();
+    }
+
+protected:
+    void SetUp() override {
+        std::vector<size_t> inputShape;
+        std::tie(inputShape, targetDevice) = this->GetParam();
+
+        auto ngPrc = ngraph::element::f32;
+        auto params = ngraph::builder::makeParams(ngPrc, {inputShape, inputShape});
+        const size_t channels = inputShape[1];
+
+        auto conv1 = ngraph::builder::makeConvolution(params[0], ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, channels);
+        auto mul = ngraph::builder::makeEltwise(conv1, params[1], ngraph::helpers::EltwiseTypes::MULTIPLY);
+        auto pool = ngraph::builder::makePooling(mul, {1, 1}, {1, 1}, {1, 1}, {3, 3}, ngraph::op::RoundingType::FLOOR,
+                                                 ngraph::op::PadType::EXPLICIT, false, ngraph::helpers::PoolingTypes::MAX);
+        auto conv2 = ngraph::builder::makeConvolution(pool, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ngraph::op::PadType::EXPLICIT, channels);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(conv2)};
+        function = std::make_shared<ngraph::Function>(results, params, "LayoutAssignment");
+    }
+
+    size_t CountReorders() {
+        InferenceEngine::CNNNetwork execGraphInfo = executableNetwork.GetExecGraphInfo();
+        auto execFunction = execGraphInfo.getFunction();
+        IE_ASSERT(nullptr != execFunction);
+        size_t count = 0;
+        for (const auto &node : execFunction->get_ops()) {
+            const auto &rtInfo = node->get_rt_info();
+            auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            IE_ASSERT(rtInfo.end() != it);
+            auto layerType = std::dynamic_pointer_cast<ngraph::VariantImpl<std::string>>(it->second);
+            IE_ASSERT(nullptr != layerType);
+            if (layerType->get() == "Reorder")
+                count++;
+        }
+        return count;
+    }
+};
+
+TEST_P(LayoutAssignmentTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    configuration[PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT] = PluginConfigParams::NO;
+    Run();
+    const auto greedyReorders = CountReorders();
+
+    inputs.clear();
+    configuration[PluginConfigInternalParams::KEY_CPU_LAYOUT_ASSIGNMENT] = PluginConfigParams::YES;
+    Run();
+    const auto assignedReorders = CountReorders();
+
+    ASSERT_LE(assignedReorders, greedyReorders);
+}
+
+namespace {
+
+INSTANTIATE_TEST_CASE_P(smoke_LayoutAssignment, LayoutAssignmentTest,
+                        ::testing::Combine(
+                                ::testing::Values(std::vector<size_t>{1, 16, 10, 10}, std::vector<size_t>{1, 32, 7, 7}),
+                                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+                        LayoutAssignmentTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPUSubgraphTestsDefinitions
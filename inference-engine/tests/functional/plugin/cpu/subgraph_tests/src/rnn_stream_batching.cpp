@@ -0,0 +1,146 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ie_plugin_config.hpp>
+#include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
+#include <shared_test_classes/base/layer_test_utils.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "common_test_utils/data_utils.hpp"
+#include "functional_test_utils/blob_utils.hpp"
+
+using namespace InferenceEngine;
+
+namespace CPUSubgraphTestsDefinitions {
+
+enum class RNNStreamBatchingType {
+    Cell,
+    Sequence
+};
+
+/* The batch 1 LSTM calls of the concurrent requests running in different CPU streams are gathered into one batched
+   primitive call when CPU_RNN_BATCH_LIMIT is set. The results of every request must be the same as without batching:
+
+         X   H0  C0
+          \   |   /
+        LSTMCell/LSTMSequence
+          /   |   \
+         Y    Ho   Co
+*/
+class RNNStreamBatchingTest : public testing::WithParamInterface<RNNStreamBatchingType>,
+                              virtual public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<RNNStreamBatchingType> &obj) {
+        return obj.param == RNNStreamBatchingType::Cell ? "LSTMCell" : "LSTMSequence";
+    }
+
+protected:
+    static constexpr size_t streams = 4;
+    static constexpr size_t seqLength = 5;
+    static constexpr size_t inputSize = 16;
+    static constexpr size_t hiddenSize = 32;
+
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        const auto type = GetParam();
+        const size_t gates = 4;
+
+        // small weights, so the gates are not saturated and every bit of the outputs depends on the computation
+        auto makeConst = [](const std::vector<size_t>& shape, int seed) {
+            auto values = CommonTestUtils::generate_float_numbers(ngraph::shape_size(shape), -0.2f, 0.2f, seed);
+            return ngraph::builder::makeConstant(ngraph::element::f32, shape, values);
+        };
+
+        std::shared_ptr<ngraph::Node> lstm;
+        ngraph::ParameterVector params;
+        if (type == RNNStreamBatchingType::Cell) {
+            params = ngraph::builder::makeParams(ngraph::element::f32, {{1, inputSize}, {1, hiddenSize}, {1, hiddenSize}});
+            lstm = std::make_shared<ngraph::opset4::LSTMCell>(params[0], params[1], params[2],
+                                                              makeConst({gates * hiddenSize, inputSize}, 1),
+                                                              makeConst({gates * hiddenSize, hiddenSize}, 2),
+                                                              makeConst({gates * hiddenSize}, 3),
+                                                              hiddenSize);
+        } else {
+            params = ngraph::builder::makeParams(ngraph::element::f32,
+                                                 {{1, seqLength, inputSize}, {1, 1, hiddenSize}, {1, 1, hiddenSize}});
+            auto seqLengths = ngraph::builder::makeConstant(ngraph::element::i64, {1}, std::vector<int64_t>{seqLength});
+            lstm = std::make_shared<ngraph::opset5::LSTMSequence>(params[0], params[1], params[2], seqLengths,
+                                                                  makeConst({1, gates * hiddenSize, inputSize}, 1),
+                                                                  makeConst({1, gates * hiddenSize, hiddenSize}, 2),
+                                                                  makeConst({1, gates * hiddenSize}, 3),
+                                                                  hiddenSize,
+                                                                  ngraph::op::RecurrentSequenceDirection::FORWARD);
+        }
+
+        ngraph::ResultVector results;
+        for (size_t i = 0; i < lstm->get_output_size(); i++)
+            results.push_back(std::make_shared<ngraph::opset1::Result>(lstm->output(i)));
+        function = std::make_shared<ngraph::Function>(results, params, "RNNStreamBatching");
+    }
+};
+
+TEST_P(RNNStreamBatchingTest, BatchedResultsAreEqualToSingleRequestResults) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto ie = PluginCache::get().ie();
+    CNNNetwork network(function);
+
+    const std::map<std::string, std::string> streamsConfig = {
+        {PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS, std::to_string(streams)}
+    };
+    auto batchedConfig = streamsConfig;
+    batchedConfig[PluginConfigInternalParams::KEY_CPU_RNN_BATCH_LIMIT] = std::to_string(streams);
+    // the window is long enough for all the concurrent requests to join the group, which is closed once it is full
+    batchedConfig[PluginConfigInternalParams::KEY_CPU_RNN_BATCH_TIMEOUT] = "100000";
+
+    auto execNet = ie->LoadNetwork(network, targetDevice, streamsConfig);
+    auto batchedExecNet = ie->LoadNetwork(network, targetDevice, batchedConfig);
+
+    // distinct inputs for every request, so a misplaced row of the batched call is detected
+    std::vector<InferRequest> requests, batchedRequests;
+    for (size_t r = 0; r < streams; r++) {
+        requests.push_back(execNet.CreateInferRequest());
+        batchedRequests.push_back(batchedExecNet.CreateInferRequest());
+        int seed = 1;
+        for (const auto& input : network.getInputsInfo()) {
+            auto blob = FuncTestUtils::createAndFillBlob(input.second->getTensorDesc(), 2, -1, 100,
+                                                         static_cast<int>(r * 10) + seed++);
+            requests[r].SetBlob(input.first, blob);
+            batchedRequests[r].SetBlob(input.first, blob);
+        }
+    }
+
+    // several iterations, so the requests are gathered into the groups repeatedly
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        for (auto& request : batchedRequests)
+            request.StartAsync();
+        for (auto& request : batchedRequests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+
+        for (size_t r = 0; r < streams; r++) {
+            requests[r].Infer();
+            for (const auto& output : network.getOutputsInfo()) {
+                auto expected = requests[r].GetBlob(output.first);
+                auto actual = batchedRequests[r].GetBlob(output.first);
+                ASSERT_EQ(expected->byteSize(), actual->byteSize());
+                const auto expectedData = expected->cbuffer().as<const float*>();
+                const auto actualData = actual->cbuffer().as<const float*>();
+                for (size_t i = 0; i < expected->size(); i++) {
+                    ASSERT_EQ(expectedData[i], actualData[i]) << "request " << r << ", output " << output.first
+                                                              << ", element " << i;
+                }
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_CASE_P(smoke_RNNStreamBatching, RNNStreamBatchingTest,
+                        ::testing::Values(RNNStreamBatchingType::Cell, RNNStreamBatchingType::Sequence),
+                        RNNStreamBatchingTest::getTestCaseName);
+
+}  // namespace CPUSubgraphTestsDefinitions
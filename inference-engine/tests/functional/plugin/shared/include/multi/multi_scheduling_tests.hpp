@@ -0,0 +1,107 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "base/multi/multi_helpers.hpp"
+#include "functional_test_utils/plugin_cache.hpp"
+
+using MultiDevice_SchedulingTest = MultiDevice_Test;
+
+TEST_P(MultiDevice_SchedulingTest, canInferWithLatencyAwarePolicyAndReportStatistics) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    auto exec_net = ie->LoadNetwork(net, device_names,
+        {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(LATENCY_AWARE)}});
+    ASSERT_EQ(std::string{MULTI_CONFIG_VALUE(LATENCY_AWARE)},
+              exec_net.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>());
+
+    const size_t numRequests = 4, numIterations = 8;
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+    }
+
+    std::map<std::string, std::map<std::string, float>> statistics;
+    ASSERT_NO_THROW(statistics = exec_net.GetMetric(METRIC_KEY(MULTI_DEVICE_STATISTICS))
+        .as<std::map<std::string, std::map<std::string, float>>>());
+    ASSERT_EQ(GetParam().size(), statistics.size());
+    float completed = 0.f;
+    for (auto&& deviceStatistics : statistics) {
+        const auto& values = deviceStatistics.second;
+        ASSERT_EQ(0.f, values.at("IN_FLIGHT"));
+        ASSERT_EQ(0.f, values.at("QUEUED"));
+        ASSERT_LT(0.f, values.at("REQUESTS"));
+        if (values.at("COMPLETED") > 0.f)
+            ASSERT_LT(0.f, values.at("LATENCY_MS"));
+        completed += values.at("COMPLETED");
+    }
+    ASSERT_EQ(static_cast<float>(numRequests * numIterations), completed);
+
+    ASSERT_NO_THROW(exec_net.SetConfig({{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(PRIORITY)}}));
+    ASSERT_EQ(std::string{MULTI_CONFIG_VALUE(PRIORITY)},
+              exec_net.GetConfig(MULTI_CONFIG_KEY(SCHEDULING_POLICY)).as<std::string>());
+    ASSERT_NO_THROW(requests.front().Infer());
+}
+
+TEST_P(MultiDevice_SchedulingTest, everyDeviceCompletesRequestsWithLatencyAwarePolicy) {
+    if (GetParam().size() < 2)
+        GTEST_SKIP() << "Requires at least two devices";
+
+    auto ie = PluginCache::get().ie();
+    const auto availableDevices = ie->GetAvailableDevices();
+    for (auto&& device : GetParam()) {
+        if (std::find(availableDevices.begin(), availableDevices.end(), device) == availableDevices.end())
+            GTEST_SKIP() << device << " device is not available";
+    }
+
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto exec_net = ie->LoadNetwork(net, device_names,
+        {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), MULTI_CONFIG_VALUE(LATENCY_AWARE)}});
+
+    // More requests than the devices can run at once, so the tasks are queued to the device-specific queues
+    const size_t numRequests = 16, numIterations = 16;
+    std::vector<InferRequest> requests;
+    for (size_t i = 0; i < numRequests; i++)
+        requests.push_back(exec_net.CreateInferRequest());
+    for (size_t iteration = 0; iteration < numIterations; iteration++) {
+        for (auto&& request : requests)
+            ASSERT_NO_THROW(request.StartAsync());
+        for (auto&& request : requests)
+            ASSERT_EQ(StatusCode::OK, request.Wait(IInferRequest::RESULT_READY));
+    }
+
+    auto statistics = exec_net.GetMetric(METRIC_KEY(MULTI_DEVICE_STATISTICS))
+        .as<std::map<std::string, std::map<std::string, float>>>();
+    ASSERT_EQ(GetParam().size(), statistics.size());
+
+    // the split of the requests between the devices depends on the timings, only the probing of every device
+    // and the accounting of all the requests are deterministic
+    float completed = 0.f;
+    for (auto&& deviceStatistics : statistics) {
+        const auto& values = deviceStatistics.second;
+        ASSERT_LT(0.f, values.at("COMPLETED")) << deviceStatistics.first << " device was never probed";
+        ASSERT_LT(0.f, values.at("LATENCY_MS")) << deviceStatistics.first;
+        ASSERT_EQ(0.f, values.at("IN_FLIGHT")) << deviceStatistics.first;
+        ASSERT_EQ(0.f, values.at("QUEUED")) << deviceStatistics.first;
+        completed += values.at("COMPLETED");
+    }
+    ASSERT_EQ(static_cast<float>(numRequests * numIterations), completed);
+}
+
+TEST_P(MultiDevice_SchedulingTest, cannotLoadWithUnknownSchedulingPolicy) {
+    InferenceEngine::CNNNetwork net(fn_ptr);
+    auto ie = PluginCache::get().ie();
+
+    ASSERT_THROW(ie->LoadNetwork(net, device_names, {{MULTI_CONFIG_KEY(SCHEDULING_POLICY), "UNKNOWN"}}),
+                 InferenceEngine::details::InferenceEngineException);
+}
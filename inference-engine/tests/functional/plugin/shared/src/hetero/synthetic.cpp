@@ -6,9 +6,12 @@
 #include "hetero/synthetic.hpp"
 #include <ngraph/op/util/op_types.hpp>
 #include <ngraph/variant.hpp>
+#include <hetero/hetero_plugin_config.hpp>
 #include "ngraph_functions/builders.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
+#include <functional>
 #include <random>
+#include <sstream>
 namespace HeteroTests {
 
 static std::vector<std::function<std::shared_ptr<ngraph::Function>()>> builders = {
@@ -150,4 +153,49 @@ TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallback) {
     }
 }
 
+TEST_P(HeteroSyntheticTest, someLayersToMajorPluginOthersToFallbackPipelined) {
+    auto affinities = SetUpAffinity();
+    SCOPED_TRACE(affinities);
+    configuration[HETERO_CONFIG_KEY(PIPELINE_DEPTH)] = "1";
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        ASSERT_EQ(1, executableNetwork.GetConfig(HETERO_CONFIG_KEY(PIPELINE_DEPTH)).as<int>());
+        ASSERT_FALSE(executableNetwork.GetConfig(CONFIG_KEY(EXCLUSIVE_ASYNC_REQUESTS)).as<bool>());
+    }
+}
+
+TEST_P(HeteroSyntheticTest, costModelPartitioning) {
+    // the cost model is used only when there are no affinities set by the user
+    for (auto&& node : function->get_ordered_ops()) {
+        node->get_rt_info().erase("affinity");
+    }
+    configuration[HETERO_CONFIG_KEY(PARTITIONING_POLICY)] = HETERO_CONFIG_VALUE(COST_MODEL);
+    configuration[HETERO_CONFIG_KEY(MAX_SUBGRAPHS)] = "2";
+    Run();
+    if (!FuncTestUtils::SkipTestsConfig::currentTestIsDisabled()) {
+        auto partition = executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION))
+                            .as<std::map<std::string, std::string>>();
+        for (auto&& node : function->get_ordered_ops()) {
+            ASSERT_NE(partition.end(), partition.find(node->get_friendly_name())) << node->get_friendly_name();
+        }
+        ASSERT_GT(executableNetwork.GetMetric(EXEC_NETWORK_METRIC_KEY(HETERO_PARTITION_COST)).as<float>(), 0.f);
+        ASSERT_EQ(2, executableNetwork.GetConfig(HETERO_CONFIG_KEY(MAX_SUBGRAPHS)).as<int>());
+
+        // the exported network starts with the line of the XML description of the created subnetworks,
+        // there are more subgraphs than the same device fragments when the cyclic dependencies are split
+        std::stringstream exported;
+        executableNetwork.Export(exported);
+        std::string description;
+        std::getline(exported, description);
+        std::size_t subgraphs = 0;
+        const std::string subnetworkTag = "<subnetwork ";
+        for (auto pos = description.find(subnetworkTag); pos != std::string::npos;
+                pos = description.find(subnetworkTag, pos + subnetworkTag.size())) {
+            subgraphs++;
+        }
+        ASSERT_GT(subgraphs, 0u);
+        ASSERT_LE(subgraphs, 2u);
+    }
+}
+
 }  //  namespace HeteroTests
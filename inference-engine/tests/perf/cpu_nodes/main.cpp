@@ -0,0 +1,170 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_bench.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Options {
+    std::string filter;
+    std::string jsonPath;
+    size_t warmup = 10;
+    size_t iterations = 100;
+};
+
+void showUsage() {
+    std::cout << "cpuNodeBenchmarks [OPTION]" << std::endl
+              << "Options:" << std::endl
+              << "    -h                 Print this message." << std::endl
+              << "    -filter <string>   Run only the cases whose name contains <string>." << std::endl
+              << "    -niter <number>    Number of measured iterations per configuration (default 100)." << std::endl
+              << "    -warmup <number>   Number of warmup iterations per configuration (default 10)." << std::endl
+              << "    -json <path>       Write the results in JSON format to <path>." << std::endl;
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; i++) {
+        const std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 >= argc)
+                throw std::invalid_argument("Missing value for " + arg);
+            return argv[++i];
+        };
+        if (arg == "-h" || arg == "--help") {
+            showUsage();
+            return false;
+        } else if (arg == "-filter") {
+            options.filter = value();
+        } else if (arg == "-niter") {
+            options.iterations = std::stoul(value());
+        } else if (arg == "-warmup") {
+            options.warmup = std::stoul(value());
+        } else if (arg == "-json") {
+            options.jsonPath = value();
+        } else {
+            throw std::invalid_argument("Unknown option " + arg);
+        }
+    }
+    if (options.iterations == 0)
+        throw std::invalid_argument("-niter must be positive");
+    return true;
+}
+
+std::string shapeToString(const ngraph::Shape& shape) {
+    std::ostringstream ss;
+    for (size_t i = 0; i < shape.size(); i++)
+        ss << (i ? "x" : "") << shape[i];
+    return ss.str();
+}
+
+std::string escapeJson(const std::string& str) {
+    std::string escaped;
+    for (char c : str) {
+        switch (c) {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\n': escaped += "\\n"; break;
+            default: escaped += c;
+        }
+    }
+    return escaped;
+}
+
+void dumpJson(const std::vector<NodeBench::BenchResult>& results, const std::string& path) {
+    std::ofstream out(path);
+    if (!out.is_open())
+        throw std::runtime_error("Cannot open " + path + " for writing");
+
+    out << "{" << std::endl
+        << "  \"isa\": \"" << NodeBench::hostIsa() << "\"," << std::endl
+        << "  \"benchmarks\": [" << std::endl;
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& r = results[i];
+        out << "    {"
+            << "\"name\": \"" << escapeJson(r.caseName) << "\", "
+            << "\"shape\": \"" << shapeToString(r.config.shape) << "\", "
+            << "\"layout\": \"" << NodeBench::toString(r.config.layout) << "\", "
+            << "\"precision\": \"" << NodeBench::toString(r.config.precision) << "\", "
+            << "\"isa\": \"" << r.isa << "\", "
+            << "\"skipped\": " << (r.skipped ? "true" : "false") << ", ";
+        if (r.skipped) {
+            out << "\"message\": \"" << escapeJson(r.message) << "\"";
+        } else {
+            out << "\"exec_type\": \"" << escapeJson(r.execType) << "\", "
+                << "\"node_time_us\": " << r.nodeTimeUs << ", "
+                << "\"infer_time_us\": " << r.inferTimeUs << ", "
+                << "\"gflops\": " << r.gflops << ", "
+                << "\"gbytes_per_sec\": " << r.gbytes;
+        }
+        out << "}" << (i + 1 < results.size() ? "," : "") << std::endl;
+    }
+    out << "  ]" << std::endl
+        << "}" << std::endl;
+}
+
+void printResult(const NodeBench::BenchResult& r) {
+    std::cout << std::left
+              << std::setw(28) << r.caseName
+              << std::setw(18) << shapeToString(r.config.shape)
+              << std::setw(9) << NodeBench::toString(r.config.layout)
+              << std::setw(6) << NodeBench::toString(r.config.precision);
+    if (r.skipped) {
+        std::cout << "skipped: " << r.message << std::endl;
+        return;
+    }
+    std::cout << std::setw(24) << r.execType
+              << std::right << std::fixed << std::setprecision(2)
+              << std::setw(12) << r.nodeTimeUs
+              << std::setw(12) << r.inferTimeUs
+              << std::setw(10) << r.gflops
+              << std::setw(10) << r.gbytes << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        Options options;
+        if (!parseOptions(argc, argv, options))
+            return EXIT_SUCCESS;
+
+        std::cout << "Host ISA: " << NodeBench::hostIsa() << std::endl;
+        std::cout << std::left
+                  << std::setw(28) << "case" << std::setw(18) << "shape" << std::setw(9) << "layout"
+                  << std::setw(6) << "prc" << std::setw(24) << "impl"
+                  << std::right << std::setw(12) << "node, us" << std::setw(12) << "infer, us"
+                  << std::setw(10) << "GFLOP/s" << std::setw(10) << "GB/s" << std::endl;
+
+        std::vector<NodeBench::BenchResult> results;
+        for (const auto& benchCase : NodeBench::getBenchCases()) {
+            if (!options.filter.empty() && benchCase.name.find(options.filter) == std::string::npos)
+                continue;
+            for (const auto& shape : benchCase.shapes) {
+                for (auto layout : benchCase.layouts) {
+                    for (auto precision : benchCase.precisions) {
+                        results.push_back(NodeBench::runBenchCase(benchCase, {shape, layout, precision},
+                                                                  options.warmup, options.iterations));
+                        printResult(results.back());
+                    }
+                }
+            }
+        }
+
+        if (!options.jsonPath.empty())
+            dumpJson(results, options.jsonPath);
+    } catch (const std::exception& ex) {
+        std::cerr << ex.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ngraph/function.hpp>
+#include <ngraph/node.hpp>
+
+namespace NodeBench {
+
+enum class Layout {
+    Planar,   // nchw / ncdhw
+    Nspc,     // nhwc / ndhwc
+    Blocked,  // nChw8c or nChw16c depending on the host ISA
+    Any       // the plugin is free to choose
+};
+
+enum class Precision {
+    FP32,
+    BF16,  // FP32 network executed with ENFORCE_BF16
+    I8     // FakeQuantize in front of the node, U8 network input
+};
+
+std::string toString(Layout layout);
+std::string toString(Precision precision);
+
+/**
+ * @brief Returns the name of the widest x86 ISA available on the host (sse42, avx2, avx512_core, ...).
+ */
+std::string hostIsa();
+
+/**
+ * @brief Memory format string understood by the MLKDNN(In|Out)putMemoryFormats rt_info attributes,
+ * or an empty string when the layout cannot be forced for the given rank.
+ */
+std::string memoryFormat(Layout layout, size_t rank);
+
+/**
+ * @brief Builds the node under test on top of the given data input.
+ * @param data Output producing the (possibly quantized) data tensor.
+ * @param shape Shape of the data tensor.
+ * @return The node whose execution time is measured.
+ */
+using NodeBuilder = std::function<std::shared_ptr<ngraph::Node>(const ngraph::Output<ngraph::Node>& data,
+                                                                 const ngraph::Shape& shape)>;
+
+/**
+ * @brief Estimates floating point operations done by the node for the given input shape.
+ */
+using FlopsEstimator = std::function<double(const ngraph::Shape& in, const ngraph::Shape& out)>;
+
+struct BenchCase {
+    std::string name;                  // unique case name, used by the filter
+    std::vector<std::string> types;    // layer types reported by the plugin perf counters for the node
+    std::vector<ngraph::Shape> shapes;
+    std::vector<Layout> layouts;
+    std::vector<Precision> precisions;
+    NodeBuilder builder;
+    FlopsEstimator flops;
+};
+
+struct BenchConfig {
+    ngraph::Shape shape;
+    Layout layout;
+    Precision precision;
+};
+
+struct BenchResult {
+    std::string caseName;
+    std::string isa;
+    BenchConfig config;
+    std::string execType;  // primitive implementation picked by the plugin
+    double nodeTimeUs = 0.0;  // median node time taken from perf counters
+    double inferTimeUs = 0.0;  // median wall time of the whole infer request
+    double gflops = 0.0;
+    double gbytes = 0.0;
+    bool skipped = false;
+    std::string message;
+};
+
+const std::vector<BenchCase>& getBenchCases();
+
+/**
+ * @brief Builds a single-node (or small-pattern) function for the case and measures it on the CPU plugin.
+ */
+BenchResult runBenchCase(const BenchCase& benchCase, const BenchConfig& config, size_t warmup, size_t iterations);
+
+}  // namespace NodeBench
@@ -0,0 +1,175 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_bench.hpp"
+
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph_functions/builders.hpp>
+
+#include <cmath>
+#include <numeric>
+
+using namespace ngraph;
+
+namespace NodeBench {
+
+namespace {
+
+double elementsCount(const Shape& shape) {
+    return static_cast<double>(shape_size(shape));
+}
+
+const std::vector<Shape> cnnShapes = {
+    {1, 32, 56, 56},
+    {1, 64, 112, 112},
+    {8, 256, 14, 14},
+    {1, 3, 224, 224}
+};
+
+const std::vector<Layout> allLayouts = {Layout::Planar, Layout::Nspc, Layout::Blocked};
+const std::vector<Precision> allPrecisions = {Precision::FP32, Precision::BF16, Precision::I8};
+
+std::vector<BenchCase> makeBenchCases() {
+    std::vector<BenchCase> cases;
+
+    cases.push_back({
+        "Interpolate_linear_onnx_x2", {"Interpolate"}, cnnShapes, allLayouts, allPrecisions,
+        [](const Output<Node>& data, const Shape& shape) -> std::shared_ptr<Node> {
+            const std::vector<int64_t> axes = {2, 3};
+            const std::vector<float> scales = {2.f, 2.f};
+            const std::vector<int64_t> sizes = {static_cast<int64_t>(shape[2] * 2), static_cast<int64_t>(shape[3] * 2)};
+            op::v4::Interpolate::InterpolateAttrs attrs;
+            attrs.mode = op::v4::Interpolate::InterpolateMode::linear_onnx;
+            attrs.shape_calculation_mode = op::v4::Interpolate::ShapeCalcMode::scales;
+            attrs.coordinate_transformation_mode = op::v4::Interpolate::CoordinateTransformMode::half_pixel;
+            attrs.pads_begin = {0, 0, 0, 0};
+            attrs.pads_end = {0, 0, 0, 0};
+            return std::make_shared<opset5::Interpolate>(data,
+                opset5::Constant::create(element::i64, {sizes.size()}, sizes),
+                opset5::Constant::create(element::f32, {scales.size()}, scales),
+                opset5::Constant::create(element::i64, {axes.size()}, axes),
+                attrs);
+        },
+        // 4 multiplications and 3 additions per output point
+        [](const Shape&, const Shape& out) { return 7.0 * elementsCount(out); }
+    });
+
+    cases.push_back({
+        "ReduceMean_spatial", {"ReduceMean"}, cnnShapes, allLayouts, allPrecisions,
+        [](const Output<Node>& data, const Shape&) -> std::shared_ptr<Node> {
+            auto axes = opset5::Constant::create(element::i64, {2}, std::vector<int64_t>{2, 3});
+            return builder::makeReduce(data, axes, true, helpers::ReductionType::Mean);
+        },
+        [](const Shape& in, const Shape&) { return elementsCount(in); }
+    });
+
+    cases.push_back({
+        "ReduceSum_channel", {"ReduceSum"}, cnnShapes, allLayouts, allPrecisions,
+        [](const Output<Node>& data, const Shape&) -> std::shared_ptr<Node> {
+            auto axes = opset5::Constant::create(element::i64, {1}, std::vector<int64_t>{1});
+            return builder::makeReduce(data, axes, true, helpers::ReductionType::Sum);
+        },
+        [](const Shape& in, const Shape&) { return elementsCount(in); }
+    });
+
+    cases.push_back({
+        "MVN_across_spatial", {"MVN"}, cnnShapes, allLayouts, allPrecisions,
+        [](const Output<Node>& data, const Shape&) -> std::shared_ptr<Node> {
+            return builder::makeMVN(data, false, true, 1e-9);
+        },
+        // mean, variance and normalization passes
+        [](const Shape& in, const Shape&) { return 5.0 * elementsCount(in); }
+    });
+
+    cases.push_back({
+        "Eltwise_add_per_channel", {"Eltwise"}, cnnShapes, allLayouts, allPrecisions,
+        [](const Output<Node>& data, const Shape& shape) -> std::shared_ptr<Node> {
+            Shape constShape(shape.size(), 1);
+            constShape[1] = shape[1];
+            auto bias = builder::makeConstant<float>(element::f32, constShape, {}, true);
+            return builder::makeEltwise(data, bias, helpers::EltwiseTypes::ADD);
+        },
+        [](const Shape&, const Shape& out) { return elementsCount(out); }
+    });
+
+    cases.push_back({
+        "Eltwise_gelu_chain", {"Eltwise"}, cnnShapes, allLayouts, {Precision::FP32, Precision::BF16},
+        [](const Output<Node>& data, const Shape& shape) -> std::shared_ptr<Node> {
+            Shape constShape(shape.size(), 1);
+            constShape[1] = shape[1];
+            auto scale = builder::makeConstant<float>(element::f32, constShape, {}, true);
+            auto mul = builder::makeEltwise(data, scale, helpers::EltwiseTypes::MULTIPLY);
+            return std::make_shared<opset5::Gelu>(mul);
+        },
+        [](const Shape&, const Shape& out) { return 12.0 * elementsCount(out); }
+    });
+
+    cases.push_back({
+        "Permute_nchw_to_nhwc", {"Permute", "Transpose"}, cnnShapes, {Layout::Planar, Layout::Nspc}, allPrecisions,
+        [](const Output<Node>& data, const Shape&) -> std::shared_ptr<Node> {
+            auto order = opset5::Constant::create(element::i64, {4}, std::vector<int64_t>{0, 2, 3, 1});
+            return std::make_shared<opset5::Transpose>(data, order);
+        },
+        [](const Shape&, const Shape&) { return 0.0; }
+    });
+
+    cases.push_back({
+        "Gather_channels", {"Gather"}, cnnShapes, {Layout::Any}, allPrecisions,
+        [](const Output<Node>& data, const Shape& shape) -> std::shared_ptr<Node> {
+            std::vector<int32_t> indices(shape[1] / 2);
+            for (size_t i = 0; i < indices.size(); i++)
+                indices[i] = static_cast<int32_t>((i * 7) % shape[1]);
+            auto indicesNode = opset5::Constant::create(element::i32, {indices.size()}, indices);
+            auto axis = opset5::Constant::create(element::i64, {}, std::vector<int64_t>{1});
+            return std::make_shared<opset5::Gather>(data, indicesNode, axis);
+        },
+        [](const Shape&, const Shape&) { return 0.0; }
+    });
+
+    cases.push_back({
+        "TopK_channels_k10", {"TopK"}, cnnShapes, {Layout::Any}, {Precision::FP32, Precision::BF16},
+        [](const Output<Node>& data, const Shape&) -> std::shared_ptr<Node> {
+            auto k = opset5::Constant::create(element::i64, {}, std::vector<int64_t>{10});
+            return std::make_shared<opset5::TopK>(data, k, 1, opset5::TopK::Mode::MAX, opset5::TopK::SortType::SORT_VALUES);
+        },
+        // one comparison per element and per heap level
+        [](const Shape& in, const Shape&) { return elementsCount(in) * std::log2(10.0); }
+    });
+
+    cases.push_back({
+        "NMS_1000_boxes", {"NonMaxSuppression", "NonMaxSuppressionIEInternal"},
+        {{1, 1, 1000}, {1, 80, 1000}, {4, 20, 5000}}, {Layout::Any}, {Precision::FP32},
+        [](const Output<Node>& scores, const Shape& shape) -> std::shared_ptr<Node> {
+            const size_t batch = shape[0], boxesNum = shape[2];
+            std::vector<float> boxes(batch * boxesNum * 4);
+            for (size_t i = 0; i < batch * boxesNum; i++) {
+                const float x = static_cast<float>((i * 37) % 512), y = static_cast<float>((i * 91) % 512);
+                const float size = static_cast<float>(16 + (i * 13) % 64);
+                boxes[i * 4 + 0] = y;
+                boxes[i * 4 + 1] = x;
+                boxes[i * 4 + 2] = y + size;
+                boxes[i * 4 + 3] = x + size;
+            }
+            auto boxesNode = opset5::Constant::create(element::f32, {batch, boxesNum, 4}, boxes);
+            return builder::makeNms(boxesNode, scores, element::i32, element::f32, 100, 0.5f, 0.05f, 0.f,
+                                    op::v5::NonMaxSuppression::BoxEncodingType::CORNER, true, element::i32);
+        },
+        // sort plus IoU against the selected boxes, per class
+        [](const Shape& in, const Shape&) {
+            const double boxesNum = static_cast<double>(in[2]);
+            return static_cast<double>(in[0] * in[1]) * (boxesNum * std::log2(boxesNum) + 100.0 * boxesNum * 10.0);
+        }
+    });
+
+    return cases;
+}
+
+}  // namespace
+
+const std::vector<BenchCase>& getBenchCases() {
+    static const std::vector<BenchCase> cases = makeBenchCases();
+    return cases;
+}
+
+}  // namespace NodeBench
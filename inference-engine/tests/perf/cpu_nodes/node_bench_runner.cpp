@@ -0,0 +1,201 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_bench.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+
+#include <ie_core.hpp>
+#include <ie_plugin_config.hpp>
+#include <ie_system_conf.h>
+#include <ngraph/opsets/opset5.hpp>
+#include <ngraph_functions/builders.hpp>
+
+#include "utils/rt_info/memory_formats_attribute.hpp"
+
+namespace NodeBench {
+
+namespace {
+
+constexpr const char benchNodeName[] = "bench_node";
+
+InferenceEngine::Core& getCore() {
+    static InferenceEngine::Core core;
+    return core;
+}
+
+size_t elementSize(Precision precision) {
+    switch (precision) {
+        case Precision::FP32: return 4;
+        case Precision::BF16: return 2;
+        case Precision::I8: return 1;
+    }
+    return 4;
+}
+
+double median(std::vector<double> values) {
+    if (values.empty())
+        return 0.0;
+    std::sort(values.begin(), values.end());
+    const size_t mid = values.size() / 2;
+    return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2.0;
+}
+
+void setMemoryFormats(const std::shared_ptr<ngraph::Node>& node, const std::string& inFormat, const std::string& outFormat) {
+    auto& rtInfo = node->get_rt_info();
+    if (!inFormat.empty()) {
+        rtInfo[ngraph::MLKDNNInputMemoryFormatsAttr] =
+            std::make_shared<ngraph::VariantWrapper<ngraph::MLKDNNInputMemoryFormats>>(ngraph::MLKDNNInputMemoryFormats(inFormat));
+    }
+    if (!outFormat.empty()) {
+        rtInfo[ngraph::MLKDNNOutputMemoryFormatsAttr] =
+            std::make_shared<ngraph::VariantWrapper<ngraph::MLKDNNOutputMemoryFormats>>(ngraph::MLKDNNOutputMemoryFormats(outFormat));
+    }
+}
+
+bool isTargetLayer(const BenchCase& benchCase, const std::string& name, const InferenceEngine::InferenceEngineProfileInfo& info) {
+    if (info.status != InferenceEngine::InferenceEngineProfileInfo::EXECUTED)
+        return false;
+    if (name == benchNodeName)
+        return true;
+    return std::find(benchCase.types.begin(), benchCase.types.end(), std::string(info.layer_type)) != benchCase.types.end();
+}
+
+}  // namespace
+
+std::string toString(Layout layout) {
+    switch (layout) {
+        case Layout::Planar: return "planar";
+        case Layout::Nspc: return "nspc";
+        case Layout::Blocked: return "blocked";
+        case Layout::Any: return "any";
+    }
+    return "undef";
+}
+
+std::string toString(Precision precision) {
+    switch (precision) {
+        case Precision::FP32: return "FP32";
+        case Precision::BF16: return "BF16";
+        case Precision::I8: return "I8";
+    }
+    return "undef";
+}
+
+std::string hostIsa() {
+    if (InferenceEngine::with_cpu_x86_bfloat16())
+        return "avx512_core_bf16";
+    if (InferenceEngine::with_cpu_x86_avx512_core())
+        return "avx512_core";
+    if (InferenceEngine::with_cpu_x86_avx512f())
+        return "avx512_common";
+    if (InferenceEngine::with_cpu_x86_avx2())
+        return "avx2";
+    if (InferenceEngine::with_cpu_x86_sse42())
+        return "sse42";
+    return "ref";
+}
+
+std::string memoryFormat(Layout layout, size_t rank) {
+    if (rank != 4 && rank != 5)
+        return {};
+    const bool is3D = rank == 5;
+    switch (layout) {
+        case Layout::Planar: return is3D ? "ncdhw" : "nchw";
+        case Layout::Nspc: return is3D ? "ndhwc" : "nhwc";
+        case Layout::Blocked:
+            if (InferenceEngine::with_cpu_x86_avx512f())
+                return is3D ? "nCdhw16c" : "nChw16c";
+            return is3D ? "nCdhw8c" : "nChw8c";
+        case Layout::Any: return {};
+    }
+    return {};
+}
+
+BenchResult runBenchCase(const BenchCase& benchCase, const BenchConfig& config, size_t warmup, size_t iterations) {
+    BenchResult result;
+    result.caseName = benchCase.name;
+    result.isa = hostIsa();
+    result.config = config;
+
+    if (config.precision == Precision::BF16 && !InferenceEngine::with_cpu_x86_avx512_core()) {
+        result.skipped = true;
+        result.message = "BF16 requires avx512_core";
+        return result;
+    }
+
+    auto params = ngraph::builder::makeParams(ngraph::element::f32, {config.shape});
+    ngraph::Output<ngraph::Node> data = params[0];
+    if (config.precision == Precision::I8) {
+        data = ngraph::builder::makeFakeQuantize(data, ngraph::element::f32, 256, {}, {0.f}, {255.f}, {0.f}, {255.f});
+    }
+
+    auto node = benchCase.builder(data, config.shape);
+    node->set_friendly_name(benchNodeName);
+
+    const auto inFormat = memoryFormat(config.layout, config.shape.size());
+    const auto outShape = node->get_output_shape(0);
+    setMemoryFormats(node, inFormat, outShape.size() == config.shape.size() ? inFormat : std::string());
+
+    ngraph::ResultVector results;
+    for (const auto& output : node->outputs())
+        results.push_back(std::make_shared<ngraph::opset5::Result>(output));
+    auto function = std::make_shared<ngraph::Function>(results, params, benchCase.name);
+
+    InferenceEngine::CNNNetwork network(function);
+    if (config.precision == Precision::I8) {
+        network.getInputsInfo().begin()->second->setPrecision(InferenceEngine::Precision::U8);
+    }
+
+    std::map<std::string, std::string> pluginConfig = {
+        {CONFIG_KEY(PERF_COUNT), CONFIG_VALUE(YES)},
+        {CONFIG_KEY(ENFORCE_BF16), config.precision == Precision::BF16 ? CONFIG_VALUE(YES) : CONFIG_VALUE(NO)}
+    };
+
+    InferenceEngine::ExecutableNetwork execNet;
+    try {
+        execNet = getCore().LoadNetwork(network, "CPU", pluginConfig);
+    } catch (const std::exception& ex) {
+        result.skipped = true;
+        result.message = ex.what();
+        return result;
+    }
+
+    auto request = execNet.CreateInferRequest();
+    for (size_t i = 0; i < warmup; i++)
+        request.Infer();
+
+    std::vector<double> nodeTimes, inferTimes;
+    nodeTimes.reserve(iterations);
+    inferTimes.reserve(iterations);
+    for (size_t i = 0; i < iterations; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        request.Infer();
+        const auto end = std::chrono::steady_clock::now();
+        inferTimes.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+        long long nodeTime = 0;
+        for (const auto& counter : request.GetPerformanceCounts()) {
+            if (isTargetLayer(benchCase, counter.first, counter.second)) {
+                nodeTime += counter.second.realTime_uSec;
+                result.execType = counter.second.exec_type;
+            }
+        }
+        nodeTimes.push_back(static_cast<double>(nodeTime));
+    }
+
+    result.nodeTimeUs = median(nodeTimes);
+    result.inferTimeUs = median(inferTimes);
+
+    const double timeUs = result.nodeTimeUs > 0.0 ? result.nodeTimeUs : result.inferTimeUs;
+    const double bytes = static_cast<double>((ngraph::shape_size(config.shape) + ngraph::shape_size(outShape)) * elementSize(config.precision));
+    result.gflops = benchCase.flops(config.shape, outShape) / (timeUs * 1e3);
+    result.gbytes = bytes / (timeUs * 1e3);
+
+    return result;
+}
+
+}  // namespace NodeBench
@@ -0,0 +1,90 @@
+// Copyright (C) 2021 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "nodes/common/rnn_batcher.h"
+#include "details/ie_exception.hpp"
+
+using MKLDNNPlugin::RNNBatcher;
+
+TEST(RNNBatcherTest, SingleCallIsExecutedByItself) {
+    RNNBatcher batcher(4, std::chrono::microseconds(100));
+
+    RNNBatcher::Request request;
+    size_t executedGroups = 0;
+    batcher.run(request, [&](const std::vector<RNNBatcher::Request*>& requests) {
+        ASSERT_EQ(1u, requests.size());
+        ASSERT_EQ(&request, requests[0]);
+        executedGroups++;
+    });
+
+    ASSERT_EQ(1u, executedGroups);
+}
+
+TEST(RNNBatcherTest, ConcurrentCallsAreGatheredIntoOneGroup) {
+    const size_t callsNum = 4;
+    // The window is large enough for all the threads to join, the group is closed as soon as it is full
+    RNNBatcher batcher(callsNum, std::chrono::seconds(10));
+
+    std::vector<RNNBatcher::Request> requests(callsNum);
+    std::atomic<size_t> executedGroups{0};
+    std::atomic<size_t> executedRequests{0};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < callsNum; i++) {
+        threads.emplace_back([&, i] {
+            batcher.run(requests[i], [&](const std::vector<RNNBatcher::Request*>& group) {
+                executedGroups++;
+                executedRequests += group.size();
+            });
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(1u, executedGroups.load());
+    ASSERT_EQ(callsNum, executedRequests.load());
+}
+
+TEST(RNNBatcherTest, GroupIsExecutedWhenWindowExpires) {
+    RNNBatcher batcher(8, std::chrono::milliseconds(1));
+
+    RNNBatcher::Request request;
+    size_t groupSize = 0;
+    batcher.run(request, [&](const std::vector<RNNBatcher::Request*>& requests) {
+        groupSize = requests.size();
+    });
+
+    ASSERT_EQ(1u, groupSize);
+}
+
+TEST(RNNBatcherTest, ExceptionIsRethrownInAllMembers) {
+    const size_t callsNum = 2;
+    RNNBatcher batcher(callsNum, std::chrono::seconds(10));
+
+    std::vector<RNNBatcher::Request> requests(callsNum);
+    std::atomic<size_t> caught{0};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < callsNum; i++) {
+        threads.emplace_back([&, i] {
+            try {
+                batcher.run(requests[i], [](const std::vector<RNNBatcher::Request*>&) {
+                    THROW_IE_EXCEPTION << "Execution failed";
+                });
+            } catch (const InferenceEngine::details::InferenceEngineException&) {
+                caught++;
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    ASSERT_EQ(callsNum, caught.load());
+}
@@ -17,6 +17,7 @@
 
 #include <cstdarg>
 #include <cstdio>
+#include <cstring>
 #include <ctime>
 
 #include <chrono>
@@ -266,6 +267,20 @@ void Blob2Img(const InferenceEngine::Blob::Ptr& blobP, cv::Mat& img, InferenceEn
             THROW_IE_EXCEPTION << "Inconsistent input layout for image processing: " << layout;
     }
 }
+
+// BF16 data stored in 16-bit matrix -> FP32 matrix
+cv::Mat bf16ToFloat(const cv::Mat& bf16) {
+    CV_Assert(bf16.depth() == CV_16U || bf16.depth() == CV_16S);
+    cv::Mat bits;
+    bf16.convertTo(bits, CV_32S);
+    cv::Mat result(bf16.size(), CV_MAKETYPE(CV_32F, bf16.channels()));
+    const auto total = bf16.total() * bf16.channels();
+    for (size_t i = 0; i < total; i++) {
+        const uint32_t value = static_cast<uint32_t>(bits.ptr<int32_t>()[i] & 0xffff) << 16;
+        std::memcpy(result.ptr<float>() + i, &value, sizeof(value));
+    }
+    return result;
+}
 } // anonymous namespace
 
 TEST_P(ResizeTestGAPI, AccuracyTest)
@@ -661,6 +676,41 @@ TEST_P(ConvertDepthTestGAPI, AccuracyTest)
 }
 //----------------------------------------------------------------------
 
+TEST_P(NormalizePlaneTestGAPI, AccuracyTest)
+{
+    const auto params = GetParam();
+    int in_depth      = std::get<0>(params);
+    int out_depth     = std::get<1>(params);
+    cv::Size sz       = std::get<2>(params);
+    double tolerance  = std::get<3>(params);
+
+    const float mean  = 127.5f;
+    const float scale = 1.f / 58.f;
+
+    initMatrixRandU(CV_MAKETYPE(in_depth, 1), sz, CV_MAKETYPE(out_depth, 1));
+
+    // G-API code //////////////////////////////////////////////////////////////
+    NormalizePlaneComputation cc(to_test(in_mat1), to_test(out_mat_gapi), mean, scale, out_depth);
+    cc.warmUp();
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ cc.apply(); },
+        400, "NormalizePlane GAPI %s to %s %dx%d", depthToString(in_depth).c_str(), depthToString(out_depth).c_str(), sz.width, sz.height);
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    {
+        in_mat1.convertTo(out_mat_ocv, CV_32F, scale, -mean * scale);
+    }
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        cv::Mat out = out_depth == CV_16U ? bf16ToFloat(out_mat_gapi) : out_mat_gapi;
+        EXPECT_LE(cv::norm(out_mat_ocv, out, cv::NORM_INF), tolerance);
+    }
+}
+//----------------------------------------------------------------------
+
 TEST_P(ResizeTestIE, AccuracyTest)
 {
     int type = 0, interp = 0;
@@ -735,6 +785,63 @@ TEST_P(ResizeTestIE, AccuracyTest)
     }
 }
 
+TEST_P(BatchedResizeTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    int batch = 0;
+    std::pair<cv::Size, cv::Size> sizes;
+    double tolerance = 0.0;
+    std::tie(batch, sizes, tolerance) = GetParam();
+
+    cv::Size sz_in, sz_out;
+    std::tie(sz_in, sz_out) = sizes;
+
+    const size_t channels = 3;
+    const size_t in_image_size = channels * sz_in.area();
+    const size_t out_image_size = channels * sz_out.area();
+
+    // Inference Engine code ///////////////////////////////////////////////////
+    const size_t N = static_cast<size_t>(batch);
+    auto in_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+        {N, channels, static_cast<size_t>(sz_in.height), static_cast<size_t>(sz_in.width)}, Layout::NHWC));
+    in_blob->allocate();
+    auto out_blob = make_shared_blob<uint8_t>(TensorDesc(Precision::U8,
+        {N, channels, static_cast<size_t>(sz_out.height), static_cast<size_t>(sz_out.width)}, Layout::NHWC));
+    out_blob->allocate();
+
+    std::vector<cv::Mat> in_mats(batch);
+    for (int i = 0; i < batch; i++) {
+        // every image wraps its own part of the input blob
+        in_mats[i] = cv::Mat(sz_in, CV_8UC3, in_blob->buffer().as<uint8_t*>() + i * in_image_size);
+        cv::randu(in_mats[i], cv::Scalar::all(0), cv::Scalar::all(255));
+    }
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+
+    // a smaller batch first: the rest of the batch items must be handled by graphs compiled on demand
+    preprocess->execute(out_blob, info, false, 1);
+    preprocess->execute(out_blob, info, false, batch);
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false, batch); },
+            100, "Batched Resize IE %d %dx%d -> %dx%d",
+            batch, sz_in.width, sz_in.height, sz_out.width, sz_out.height);
+#endif
+
+    // Comparison //////////////////////////////////////////////////////////////
+    for (int i = 0; i < batch; i++) {
+        cv::Mat out_mat(sz_out, CV_8UC3, out_blob->buffer().as<uint8_t*>() + i * out_image_size);
+        cv::Mat out_mat_ocv;
+        cv::resize(in_mats[i], out_mat_ocv, sz_out, 0, 0, cv::INTER_LINEAR);
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance) << "batch item " << i;
+    }
+}
+
 TEST_P(ColorConvertTestIE, AccuracyTest)
 {
     using namespace InferenceEngine;
@@ -1078,6 +1185,92 @@ TEST_P(MergeTestIE, AccuracyTest)
     EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
 }
 
+TEST_P(MeanValueNormalizationTestIE, AccuracyTest)
+{
+    using namespace InferenceEngine;
+    Precision out_prec;
+    ColorFormat in_fmt = ColorFormat::RAW;
+    const ColorFormat out_fmt = ColorFormat::BGR;
+    Layout out_layout = Layout::ANY;
+    std::pair<cv::Size, cv::Size> sizes;
+    double tolerance = 0.0;
+    std::tie(out_prec, in_fmt, out_layout, sizes, tolerance) = GetParam();
+
+    cv::Size in_size, out_size;
+    std::tie(in_size, out_size) = sizes;
+
+    const std::vector<float> means  = {103.94f, 116.78f, 123.68f};
+    const std::vector<float> scales = {0.017f, 0.018f, 0.019f};
+
+    cv::Mat in_mat1(in_size, CV_8UC3);
+    cv::randu(in_mat1, cv::Scalar::all(0), cv::Scalar::all(255));
+    if (in_fmt != ColorFormat::RAW && in_fmt != ColorFormat::BGR) {
+        cv::cvtColor(in_mat1, in_mat1, toCvtColorCode(in_fmt));
+    }
+
+    const bool bf16 = out_prec == Precision::BF16;
+    cv::Mat out_mat(out_size, bf16 ? CV_16SC3 : CV_32FC3);
+
+    // Inference Engine code ///////////////////////////////////////////////////
+    auto in_blob = img2Blob<Precision::U8>(in_mat1, Layout::NHWC);
+    auto out_blob = bf16 ? img2Blob<Precision::BF16>(out_mat, out_layout)
+                         : img2Blob<Precision::FP32>(out_mat, out_layout);
+
+    PreProcessDataPtr preprocess = CreatePreprocDataHelper();
+    preprocess->setRoiBlob(in_blob);
+
+    PreProcessInfo info;
+    info.setResizeAlgorithm(RESIZE_BILINEAR);
+    info.setColorFormat(in_fmt);
+    info.init(3);
+    for (size_t c = 0; c < 3; c++) {
+        info[c]->meanValue = means[c];
+        info[c]->stdScale = scales[c];
+    }
+    info.setVariant(MEAN_VALUE);
+
+    preprocess->execute(out_blob, info, false, -1, true);
+
+    if (bf16) {
+        Blob2Img<Precision::BF16>(out_blob, out_mat, out_layout);
+        out_mat = bf16ToFloat(out_mat);
+    } else {
+        Blob2Img<Precision::FP32>(out_blob, out_mat, out_layout);
+    }
+
+#if PERF_TEST
+    // iterate testing, and print performance
+    test_ms([&](){ preprocess->execute(out_blob, info, false, -1, true); },
+            100, "MeanValue IE %s %s %dx%d -> %dx%d %s",
+            bf16 ? "BF16" : "FP32", layoutToString(out_layout).c_str(),
+            in_size.width, in_size.height, out_size.width, out_size.height,
+            colorFormatToString(in_fmt).c_str());
+#endif
+
+    // OpenCV code /////////////////////////////////////////////////////////////
+    cv::Mat out_mat_ocv;
+    {
+        cv::Mat converted = in_mat1;
+        if (in_fmt != ColorFormat::RAW && in_fmt != out_fmt) {
+            cv::cvtColor(in_mat1, converted, toCvtColorCode(in_fmt, out_fmt));
+        }
+        cv::Mat resized;
+        cv::resize(converted, resized, out_size, 0, 0, cv::INTER_LINEAR);
+
+        std::vector<cv::Mat> planes;
+        cv::split(resized, planes);
+        for (size_t c = 0; c < planes.size(); c++) {
+            planes[c].convertTo(planes[c], CV_32F, scales[c], -means[c] * scales[c]);
+        }
+        cv::merge(planes, out_mat_ocv);
+    }
+
+    // Comparison //////////////////////////////////////////////////////////////
+    {
+        EXPECT_LE(cv::norm(out_mat_ocv, out_mat, cv::NORM_INF), tolerance);
+    }
+}
+
 TEST_P(PreprocTest, Performance)
 {
     using namespace InferenceEngine;
@@ -25,10 +25,21 @@ struct ConvertDepthTestGAPI: public TestParams<std::tuple<
                             cv::Size,
                             double>>   // tolerance
 {};
+struct NormalizePlaneTestGAPI: public TestParams<std::tuple<
+                            int,  // input matrix depth
+                            int,  // output matrix depth, CV_16U for BF16
+                            cv::Size,
+                            double>>   // tolerance
+{};
 //------------------------------------------------------------------------------
 
 struct ResizeTestIE: public testing::TestWithParam<std::tuple<int, int, std::pair<cv::Size, cv::Size>, double>> {};
 
+struct BatchedResizeTestIE: public testing::TestWithParam<std::tuple<int,  // batch size
+                                                                     std::pair<cv::Size, cv::Size>,
+                                                                     double>>  // tolerance
+{};
+
 struct SplitTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 struct MergeTestIE: public TestParams<std::tuple<int, cv::Size, double>> {};
 
@@ -54,6 +65,14 @@ struct PrecisionConvertTestIE: public TestParams<std::tuple<cv::Size,
                                                             double>> // tolerance
 {};
 
+struct MeanValueNormalizationTestIE:
+    public testing::TestWithParam<std::tuple<InferenceEngine::Precision,  // output precision, FP32 or BF16
+                                             InferenceEngine::ColorFormat,  // input color format
+                                             InferenceEngine::Layout,  // output layout
+                                             std::pair<cv::Size, cv::Size>,
+                                             double>>  // tolerance
+{};
+
 //------------------------------------------------------------------------------
 
 using PreprocParams = std::tuple< std::pair<InferenceEngine::Precision     // input data type
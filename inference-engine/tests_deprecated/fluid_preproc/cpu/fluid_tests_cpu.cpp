@@ -183,6 +183,18 @@ INSTANTIATE_TEST_CASE_P(ConvertDepthFluid, ConvertDepthTestGAPI,
                                        cv::Size( 320,  200)),
                                 Values(1)));
 
+INSTANTIATE_TEST_CASE_P(NormalizePlaneFluid, NormalizePlaneTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(CV_32F),
+                                Values(TEST_SIZES),
+                                Values(1e-5)));
+
+INSTANTIATE_TEST_CASE_P(NormalizePlaneFluid_BF16, NormalizePlaneTestGAPI,
+                        Combine(Values(CV_8U, CV_32F),
+                                Values(CV_16U),
+                                Values(TEST_SIZES),
+                                Values(0.01))); // BF16 keeps 8 bits of mantissa
+
 INSTANTIATE_TEST_CASE_P(ResizeRoiTestFluid, ResizeRoiTestGAPI,
                         Combine(Values(CV_8UC1, CV_8UC3),
                                 Values(cv::INTER_LINEAR),
@@ -225,6 +237,22 @@ INSTANTIATE_TEST_CASE_P(ResizeTestFluid_F32, ResizeTestIE,
                                 Values(TEST_RESIZE_PAIRS),
                                 Values(0.05))); // error within 0.05 units
 
+#if defined(__arm__) || defined(__aarch64__)
+INSTANTIATE_TEST_CASE_P(BatchedResizeTestFluid_U8, BatchedResizeTestIE,
+                        Combine(Values(2, 5, 16),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(416, 416)),
+                                       std::make_pair(cv::Size( 320,  200), cv::Size( 64,  40)),
+                                       std::make_pair(cv::Size( 113,   71), cv::Size(640, 480))),
+                                Values(4))); // error not more than 4 unit
+#else
+INSTANTIATE_TEST_CASE_P(BatchedResizeTestFluid_U8, BatchedResizeTestIE,
+                        Combine(Values(2, 5, 16),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(416, 416)),
+                                       std::make_pair(cv::Size( 320,  200), cv::Size( 64,  40)),
+                                       std::make_pair(cv::Size( 113,   71), cv::Size(640, 480))),
+                                Values(1))); // error not more than 1 unit
+#endif
+
 INSTANTIATE_TEST_CASE_P(SplitTestFluid, SplitTestIE,
                         Combine(Values(CV_8UC2, CV_8UC3, CV_8UC4,
                                        CV_32FC2, CV_32FC3, CV_32FC4),
@@ -284,6 +312,15 @@ INSTANTIATE_TEST_CASE_P(Reorder_CHW2HWC, ColorConvertTestIE,
                                 Values(TEST_SIZES),
                                 Values(0)));
 
+INSTANTIATE_TEST_CASE_P(MeanValueNormalizationFluid, MeanValueNormalizationTestIE,
+                        Combine(Values(InferenceEngine::Precision::FP32, InferenceEngine::Precision::BF16),
+                                Values(InferenceEngine::ColorFormat::BGR, InferenceEngine::ColorFormat::RGB),
+                                Values(InferenceEngine::NCHW, InferenceEngine::NHWC),
+                                Values(std::make_pair(cv::Size(1920, 1080), cv::Size(416, 416)),
+                                       std::make_pair(cv::Size( 640,  480), cv::Size(224, 224)),
+                                       std::make_pair(cv::Size( 320,  200), cv::Size(640, 480))),
+                                Values(0.1))); // a few units of U8 resize error after scaling plus BF16 rounding
+
 //------------------------------------------------------------------------------
 
 namespace IE = InferenceEngine;
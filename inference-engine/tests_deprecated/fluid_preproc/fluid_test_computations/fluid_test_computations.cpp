@@ -225,3 +225,14 @@ ConvertDepthComputation::ConvertDepthComputation(test::Mat inMat, test::Mat outM
                                })
 {}
 
+NormalizePlaneComputation::NormalizePlaneComputation(test::Mat inMat, test::Mat outMat, float mean, float scale, int depth)
+    : FluidComputation(new Priv{ [mean, scale, depth]()-> cv::GComputation {
+                                    cv::GMat in;
+                                    cv::GMat out = InferenceEngine::gapi::NormalizePlane::on(in, mean, scale, depth);
+                                    return cv::GComputation(cv::GIn(in), cv::GOut(out));
+                                 }()
+                               , {to_own(inMat)}
+                               , {to_own(outMat)}
+                               })
+{}
+
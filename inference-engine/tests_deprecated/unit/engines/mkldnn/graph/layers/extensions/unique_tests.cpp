@@ -294,6 +294,48 @@ std::vector<float>          output_uniques_value_ref_case5 = { 0.f, 1.f, 2.f, 3.
 std::vector<float>          output_indices_value_ref_case5 = { 5.f, 1.f, 2.f, 3.f, 6.f, 4.f, 7.f, 8.f, 0.f, 9.f };
 std::vector<float>          output_counts_value_ref_case5 = { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f };
 
+// case 6 - input with 20000 elements processed by several threads, non-sorted, the references are computed by a simple scan
+static std::vector<float> make_large_input() {
+    std::vector<float> input(20000);
+    for (size_t i = 0; i < input.size(); i++)
+        input[i] = static_cast<float>((i * 7919) % 1000) - 500.f;
+    return input;
+}
+
+enum unique_output { UNIQUES, INDICES, COUNTS };
+
+static std::vector<float> make_unique_ref(const std::vector<float>& input, bool sorted, unique_output output) {
+    std::vector<float> values;
+    for (auto value : input) {
+        if (std::find(values.begin(), values.end(), value) == values.end())
+            values.push_back(value);
+    }
+    if (sorted)
+        std::sort(values.begin(), values.end());
+
+    std::vector<float> uniques(input.size(), values.back());
+    std::copy(values.begin(), values.end(), uniques.begin());
+    std::vector<float> indices(input.size());
+    std::vector<float> counts(input.size(), 0.f);
+    for (size_t i = 0; i < input.size(); i++) {
+        const auto id = std::find(values.begin(), values.end(), input[i]) - values.begin();
+        indices[i] = static_cast<float>(id);
+        counts[id] += 1.f;
+    }
+    return output == UNIQUES ? uniques : output == INDICES ? indices : counts;
+}
+
+InferenceEngine::SizeVector input_shape_case6 = { 20000 };
+std::vector<float>          input_value_case6 = make_large_input();
+std::vector<float>          output_uniques_value_ref_case6 = make_unique_ref(input_value_case6, false, UNIQUES);
+std::vector<float>          output_indices_value_ref_case6 = make_unique_ref(input_value_case6, false, INDICES);
+std::vector<float>          output_counts_value_ref_case6 = make_unique_ref(input_value_case6, false, COUNTS);
+
+// case 7 - input with 20000 elements processed by several threads, sorted
+std::vector<float>          output_uniques_value_ref_case7 = make_unique_ref(input_value_case6, true, UNIQUES);
+std::vector<float>          output_indices_value_ref_case7 = make_unique_ref(input_value_case6, true, INDICES);
+std::vector<float>          output_counts_value_ref_case7 = make_unique_ref(input_value_case6, true, COUNTS);
+
 INSTANTIATE_TEST_CASE_P(
     TestsUnique, MKLDNNCPUExtUniqueTests,
     ::testing::Values(
@@ -366,5 +408,19 @@ INSTANTIATE_TEST_CASE_P(
             output_uniques_shape_case5, output_indicess_shape_case5, output_counts_shape_case5,
             output_uniques_value_ref_case5, output_indices_value_ref_case5, output_counts_value_ref_case5,
             1, MKLDNNPlugin::impl_desc_type::unknown
+        },
+        // case 10 - model2, sorted="false", input with 20000 elements where some of them repeat
+        unique_test_params{
+            model2, "FP32", "false", "true", "true", input_shape_case6, input_value_case6,
+            input_shape_case6, input_shape_case6, input_shape_case6,
+            output_uniques_value_ref_case6, output_indices_value_ref_case6, output_counts_value_ref_case6,
+            1, MKLDNNPlugin::impl_desc_type::unknown
+        },
+        // case 11 - model2, sorted="true", input with 20000 elements where some of them repeat
+        unique_test_params{
+            model2, "FP32", "true", "true", "true", input_shape_case6, input_value_case6,
+            input_shape_case6, input_shape_case6, input_shape_case6,
+            output_uniques_value_ref_case7, output_indices_value_ref_case7, output_counts_value_ref_case7,
+            1, MKLDNNPlugin::impl_desc_type::unknown
         }
 ));
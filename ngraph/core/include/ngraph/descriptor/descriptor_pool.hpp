@@ -0,0 +1,186 @@
+//*****************************************************************************
+// Copyright 2017-2021 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    namespace descriptor
+    {
+        /// \brief Storage of the input or output descriptors of a node.
+        ///
+        /// The descriptors are referenced by raw pointers from the connected nodes, so they are
+        /// never moved once constructed. Unlike std::deque, which allocates a 512 byte chunk and
+        /// a chunk map for every node, the descriptors are placed in blocks sized by reserve(),
+        /// so a node usually owns a single block holding exactly its descriptors.
+        template <typename T>
+        class DescriptorPool
+        {
+        public:
+            template <typename Value, typename BaseIterator>
+            class Iterator
+            {
+            public:
+                using iterator_category = std::forward_iterator_tag;
+                using value_type = Value;
+                using difference_type = std::ptrdiff_t;
+                using pointer = Value*;
+                using reference = Value&;
+
+                explicit Iterator(BaseIterator it)
+                    : m_it(it)
+                {
+                }
+
+                reference operator*() const { return **m_it; }
+                pointer operator->() const { return *m_it; }
+                Iterator& operator++()
+                {
+                    ++m_it;
+                    return *this;
+                }
+                Iterator operator++(int)
+                {
+                    Iterator result(*this);
+                    ++m_it;
+                    return result;
+                }
+                bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+                bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+            private:
+                BaseIterator m_it;
+            };
+
+            using iterator = Iterator<T, typename std::vector<T*>::const_iterator>;
+            using const_iterator = Iterator<const T, typename std::vector<T*>::const_iterator>;
+
+            DescriptorPool() = default;
+
+            DescriptorPool(const DescriptorPool& other) { copy_from(other); }
+            DescriptorPool& operator=(const DescriptorPool& other)
+            {
+                if (this != &other)
+                {
+                    clear();
+                    copy_from(other);
+                }
+                return *this;
+            }
+
+            ~DescriptorPool() { clear(); }
+            size_t size() const { return m_items.size(); }
+            bool empty() const { return m_items.empty(); }
+            T& operator[](size_t i) { return *m_items[i]; }
+            const T& operator[](size_t i) const { return *m_items[i]; }
+            T& at(size_t i) { return *m_items.at(i); }
+            const T& at(size_t i) const { return *m_items.at(i); }
+            iterator begin() { return iterator(m_items.cbegin()); }
+            iterator end() { return iterator(m_items.cend()); }
+            const_iterator begin() const { return const_iterator(m_items.cbegin()); }
+            const_iterator end() const { return const_iterator(m_items.cend()); }
+            /// \brief Makes room for n descriptors in total, the following emplace_back calls
+            /// up to that size do not allocate.
+            void reserve(size_t n)
+            {
+                if (n > size() + free_slots())
+                {
+                    add_block(n - size());
+                }
+                m_items.reserve(n);
+            }
+
+            template <typename... Args>
+            T& emplace_back(Args&&... args)
+            {
+                if (free_slots() == 0)
+                {
+                    // grow geometrically if the size was not reserved
+                    add_block(size() == 0 ? 1 : size());
+                }
+                // allocate the pointer before the descriptor is constructed, so push_back cannot throw
+                if (m_items.size() == m_items.capacity())
+                {
+                    m_items.reserve(m_items.empty() ? 1 : 2 * m_items.size());
+                }
+                T* item = block_data(m_block) + m_block->size;
+                new (item) T(std::forward<Args>(args)...);
+                ++m_block->size;
+                m_items.push_back(item);
+                return *item;
+            }
+
+            void clear()
+            {
+                for (T* item : m_items)
+                {
+                    item->~T();
+                }
+                m_items.clear();
+                while (m_block != nullptr)
+                {
+                    Block* next = m_block->next;
+                    ::operator delete(m_block);
+                    m_block = next;
+                }
+            }
+
+        private:
+            struct Block
+            {
+                Block* next;
+                size_t capacity;
+                size_t size;
+            };
+
+            static constexpr size_t header_size =
+                (sizeof(Block) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+            static T* block_data(Block* block)
+            {
+                return reinterpret_cast<T*>(reinterpret_cast<char*>(block) + header_size);
+            }
+
+            size_t free_slots() const
+            {
+                return m_block == nullptr ? 0 : m_block->capacity - m_block->size;
+            }
+
+            void add_block(size_t capacity)
+            {
+                void* memory = ::operator new(header_size + capacity * sizeof(T));
+                m_block = new (memory) Block{m_block, capacity, 0};
+            }
+
+            void copy_from(const DescriptorPool& other)
+            {
+                reserve(other.size());
+                for (const T* item : other.m_items)
+                {
+                    emplace_back(*item);
+                }
+            }
+
+            std::vector<T*> m_items;
+            Block* m_block{nullptr};
+        };
+    }
+}
@@ -35,6 +35,7 @@
 #include "ngraph/coordinate.hpp"
 #include "ngraph/coordinate_diff.hpp"
 #include "ngraph/deprecated.hpp"
+#include "ngraph/descriptor/descriptor_pool.hpp"
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/descriptor/tensor.hpp"
@@ -482,15 +483,20 @@ namespace ngraph
 
         std::vector<Node*> m_control_dependents;
         std::vector<std::shared_ptr<Node>> m_control_dependencies;
-        std::string m_node_type;
         size_t m_instance_id{m_next_instance_id.fetch_add(1)};
         std::string m_friendly_name;
         std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::set<std::shared_ptr<Node>> m_provenance_group;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
+        // most of the nodes never get the provenance, so it is allocated on the first use
+        struct Provenance
+        {
+            std::unordered_set<std::string> tags;
+            std::set<std::shared_ptr<Node>> group;
+        };
+        Provenance& get_provenance();
+        std::unique_ptr<Provenance> m_provenance;
+        descriptor::DescriptorPool<descriptor::Input> m_inputs;
+        descriptor::DescriptorPool<descriptor::Output> m_outputs;
         std::shared_ptr<ngraph::op::util::OpAnnotations> m_op_annotations;
         std::map<std::string, std::shared_ptr<Variant>> m_rt_info;
     };
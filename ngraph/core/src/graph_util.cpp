@@ -292,13 +292,15 @@ std::vector<std::shared_ptr<ngraph::Node>>
 {
     // for each node in topological order
     auto sorted_nodes = topological_sort(nodes);
-    for (auto node : sorted_nodes)
+    node_map.reserve(node_map.size() + sorted_nodes.size());
+    for (const auto& node : sorted_nodes)
     {
         if (node_map.count(node.get()) == 0)
         {
             // get (already) cloned arguments and clone the node
             OutputVector cloned_args;
-            for (auto input : node->inputs())
+            cloned_args.reserve(node->get_input_size());
+            for (const auto& input : node->inputs())
             {
                 Output<Node> output = input.get_source_output();
                 cloned_args.push_back(output.for_node(node_map.at(output.get_node())));
@@ -316,10 +318,13 @@ std::vector<std::shared_ptr<ngraph::Node>>
             auto cloned_node = node->copy_with_new_inputs(cloned_args, cloned_dependencies);
             // There is a friendly name for this node so copy it
             cloned_node->set_friendly_name(node->get_friendly_name());
-            auto rt_info = node->get_rt_info();
-            cloned_node->get_rt_info() = rt_info;
+            const auto& rt_info = node->get_rt_info();
+            if (!rt_info.empty())
+            {
+                cloned_node->get_rt_info() = rt_info;
+            }
 
-            for (auto tag : node->get_provenance_tags())
+            for (const auto& tag : node->get_provenance_tags())
             {
                 cloned_node->add_provenance_tag(tag);
             }
@@ -37,12 +37,10 @@ atomic<size_t> Node::m_next_instance_id(0);
 Node::Node(const Node& node)
     : m_control_dependents(node.m_control_dependents)
     , m_control_dependencies(node.m_control_dependencies)
-    // skip m_node_type -- will be generated automatically
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_friendly_name(node.m_friendly_name)
     // skip m_unique_name -- will be generated automatically
-    , m_provenance_tags(node.m_provenance_tags)
-    , m_provenance_group(node.m_provenance_group)
+    , m_provenance(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr)
     , m_inputs(node.m_inputs) // will be modified in the body
     // skip m_outputs -- should be initialized outside
     , m_op_annotations(node.m_op_annotations)
@@ -62,8 +60,7 @@ Node& Node::operator=(const Node& node)
     this->m_control_dependencies = node.m_control_dependencies;
     this->m_instance_id = m_next_instance_id.fetch_add(1);
     this->m_friendly_name = node.m_friendly_name;
-    this->m_provenance_tags = node.m_provenance_tags;
-    this->m_provenance_group = node.m_provenance_group;
+    this->m_provenance.reset(node.m_provenance ? new Provenance(*node.m_provenance) : nullptr);
     this->m_inputs = node.m_inputs;
     this->m_op_annotations = node.m_op_annotations;
     this->m_rt_info = node.m_rt_info;
@@ -146,7 +143,11 @@ std::shared_ptr<Node>
     }
     for (size_t i = 0; i < get_output_size(); i++)
     {
-        clone->get_output_tensor(i).set_names(get_output_tensor(i).get_names());
+        const auto& names = get_output_tensor(i).get_names();
+        if (!names.empty())
+        {
+            clone->get_output_tensor(i).set_names(names);
+        }
     }
     return clone;
 }
@@ -195,6 +196,7 @@ void Node::set_arguments(const NodeVector& arguments)
 void Node::set_arguments(const OutputVector& arguments)
 {
     // Add this node as a user of each argument.
+    m_inputs.reserve(m_inputs.size() + arguments.size());
     size_t i = 0;
     for (auto& output : arguments)
     {
@@ -240,6 +242,7 @@ void Node::constructor_validate_and_infer_types()
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
+    m_outputs.reserve(n);
     for (size_t i = m_outputs.size(); i < n; ++i)
     {
         // create the descriptors
@@ -308,14 +311,26 @@ void Node::set_friendly_name(const string& name)
     m_friendly_name = name;
 }
 
+Node::Provenance& Node::get_provenance()
+{
+    if (!m_provenance)
+    {
+        m_provenance.reset(new Provenance());
+    }
+    return *m_provenance;
+}
+
 void Node::add_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.insert(node);
+    get_provenance().group.insert(node);
 }
 
 void Node::remove_provenance_group_member(const shared_ptr<Node>& node)
 {
-    m_provenance_group.erase(node);
+    if (m_provenance)
+    {
+        m_provenance->group.erase(node);
+    }
 }
 
 void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
@@ -334,7 +349,8 @@ void Node::replace_provenance_group_member(const shared_ptr<Node>& current_node,
 
 const set<shared_ptr<Node>>& Node::get_provenance_group_members() const
 {
-    return m_provenance_group;
+    static const set<shared_ptr<Node>> empty_group;
+    return m_provenance ? m_provenance->group : empty_group;
 }
 
 shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& base)
@@ -366,7 +382,7 @@ shared_ptr<Node> Node::add_provenance_group_members_above(const OutputVector& ba
         add_provenance_group_member(node->shared_from_this());
         for (auto value : node->input_values())
         {
-            if (m_provenance_group.count(value.get_node_shared_ptr()) == 0)
+            if (m_provenance->group.count(value.get_node_shared_ptr()) == 0)
             {
                 todo.push_back(value.get_node());
             }
@@ -404,13 +420,15 @@ void Node::add_provenance_tags_above(const OutputVector& base,
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> empty_tags;
+    return m_provenance ? m_provenance->tags : empty_tags;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
-    for (auto node : m_provenance_group)
+    auto& provenance = get_provenance();
+    provenance.tags.insert(tag);
+    for (auto node : provenance.group)
     {
         node->add_provenance_tag(tag);
     }
@@ -418,7 +436,10 @@ void Node::add_provenance_tag(const std::string& tag)
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance)
+    {
+        m_provenance->tags.erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -113,3 +113,42 @@ TEST(node_input_output, output_create_const)
 
     EXPECT_THROW(add->output(1), std::out_of_range);
 }
+
+TEST(node_input_output, inputs_added_one_by_one)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto concat = make_shared<op::v0::Concat>();
+    concat->set_axis(0);
+    const size_t num_inputs = 33;
+    for (size_t i = 0; i < num_inputs; ++i)
+    {
+        concat->set_argument(i, x);
+    }
+    concat->validate_and_infer_types();
+
+    // the inputs keep their addresses while the node grows
+    auto targets = x->output(0).get_target_inputs();
+    ASSERT_EQ(targets.size(), num_inputs);
+    for (const auto& target : targets)
+    {
+        EXPECT_EQ(target.get_node(), concat.get());
+        EXPECT_EQ(concat->input(target.get_index()).get_source_output(), Output<Node>(x, 0));
+    }
+    EXPECT_EQ(concat->get_output_shape(0), (Shape{num_inputs, 2}));
+
+    auto clone = concat->clone_with_new_inputs(concat->input_values());
+    EXPECT_EQ(x->output(0).get_target_inputs().size(), 2 * num_inputs);
+    clone.reset();
+    EXPECT_EQ(x->output(0).get_target_inputs().size(), num_inputs);
+}
+
+TEST(node_input_output, provenance_is_empty_by_default)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2});
+    auto relu = make_shared<op::v0::Relu>(x);
+    EXPECT_TRUE(relu->get_provenance_tags().empty());
+    EXPECT_TRUE(relu->get_provenance_group_members().empty());
+    relu->remove_provenance_tag("tag");
+    relu->add_provenance_tag("tag");
+    EXPECT_EQ(relu->get_provenance_tags(), (unordered_set<string>{"tag"}));
+}